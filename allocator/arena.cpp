@@ -0,0 +1,82 @@
+#include <cstdint>
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// MonotonicArena
+
+inline MonotonicArena::MonotonicArena(std::size_t blockSize) noexcept
+  : initialBlockSize(blockSize > 0 ? blockSize : DefaultBlockSize), nextBlockSize(initialBlockSize) {}
+
+inline MonotonicArena::~MonotonicArena() {
+  Release();
+}
+
+inline void* MonotonicArena::Allocate(std::size_t bytes, std::size_t align) {
+  // Align the cursor; the subtraction is done on integers so an empty arena
+  // (null cursor and limit) simply falls through to Grow
+  std::uintptr_t current = reinterpret_cast<std::uintptr_t>(cursor);
+  std::uintptr_t aligned = (current + align - 1) & ~static_cast<std::uintptr_t>(align - 1);
+  if (cursor == nullptr || aligned + bytes > reinterpret_cast<std::uintptr_t>(limit)) {
+    Grow(bytes, align);
+    current = reinterpret_cast<std::uintptr_t>(cursor);
+    aligned = (current + align - 1) & ~static_cast<std::uintptr_t>(align - 1);
+  }
+  cursor = reinterpret_cast<std::byte*>(aligned + bytes);
+  allocated += bytes;
+  return reinterpret_cast<void*>(aligned);
+}
+
+inline void MonotonicArena::Release() noexcept {
+  while (blocks != nullptr) {
+    Block* next = blocks->next;
+    ::operator delete(static_cast<void*>(blocks));
+    blocks = next;
+  }
+  cursor = limit = nullptr;
+  nextBlockSize = initialBlockSize;
+  allocated = 0;
+}
+
+inline std::size_t MonotonicArena::Allocated() const noexcept {
+  return allocated;
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions (MonotonicArena)
+
+inline void MonotonicArena::Grow(std::size_t bytes, std::size_t align) {
+  // Room for the request plus the worst-case alignment padding
+  std::size_t needed = bytes + align;
+  std::size_t blockSize = nextBlockSize;
+  while (blockSize < needed) {
+    blockSize *= 2;
+  }
+  Block* block = static_cast<Block*>(::operator new(sizeof(Block) + blockSize));
+  block->next = blocks;
+  block->capacity = blockSize;
+  blocks = block;
+  cursor = reinterpret_cast<std::byte*>(block + 1);
+  limit = cursor + blockSize;
+  nextBlockSize = blockSize * 2; // Geometric growth of the following blocks
+}
+
+/* ************************************************************************** */
+
+// ArenaAllocator
+
+template <typename T>
+T* ArenaAllocator<T>::allocate(std::size_t count) {
+  return static_cast<T*>(arena->Allocate(count * sizeof(T), alignof(T)));
+}
+
+template <typename T>
+void ArenaAllocator<T>::deallocate(T* ptr, std::size_t count) noexcept {
+  arena->Deallocate(ptr, count * sizeof(T));
+}
+
+/* ************************************************************************** */
+
+}
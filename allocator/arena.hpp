@@ -0,0 +1,142 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+/* ************************************************************************** */
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// MonotonicArena Class
+// --------------------
+// A bump allocator: memory is carved sequentially out of large blocks and is
+// never returned piecemeal. Deallocate() is a no-op; everything obtained from
+// the arena is released at once by Release() or by the destructor.
+// Blocks grow geometrically, so the number of system allocations is logarithmic
+// in the total amount of memory requested.
+// Typical use: place all the containers of a request in one arena and drop the
+// arena when the request is done. The containers must be destroyed (or at least
+// never touched again) before the arena releases its memory.
+// Not thread-safe.
+class MonotonicArena {
+
+private:
+
+  // Header placed at the beginning of every block
+  struct Block {
+    Block* next = nullptr; // Previously allocated block
+    std::size_t capacity = 0; // Usable bytes following the header
+  };
+
+  Block* blocks = nullptr; // Most recent block (head of the block list)
+  std::byte* cursor = nullptr; // First free byte in the current block
+  std::byte* limit = nullptr; // One past the last byte of the current block
+
+  std::size_t initialBlockSize; // Size of the first block (restored by Release)
+  std::size_t nextBlockSize; // Size of the next block to request
+  std::size_t allocated = 0; // Total bytes handed out since the last Release
+
+protected:
+
+public:
+
+  static constexpr std::size_t DefaultBlockSize = 4096;
+
+  // Default constructor - no memory is requested until the first allocation
+  explicit MonotonicArena(std::size_t blockSize = DefaultBlockSize) noexcept;
+
+  // An arena owns its blocks and cannot be copied or moved
+  MonotonicArena(const MonotonicArena&) = delete;
+  MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+  // Destructor - releases every block
+  ~MonotonicArena();
+
+  /* ************************************************************************ */
+
+  // Allocate() - Returns 'bytes' bytes aligned to 'align' (a power of two)
+  // Throws std::bad_alloc if the system allocation fails
+  void* Allocate(std::size_t bytes, std::size_t align = alignof(std::max_align_t));
+
+  // Deallocate() - No-op: memory is only reclaimed by Release()
+  void Deallocate(void*, std::size_t) noexcept {}
+
+  // Release() - Frees all the blocks at once and restarts from the initial block size
+  void Release() noexcept;
+
+  // Allocated() - Bytes handed out since construction or the last Release()
+  std::size_t Allocated() const noexcept;
+
+protected:
+
+  // Auxiliary functions
+
+  void Grow(std::size_t bytes, std::size_t align); // Starts a new block large enough for the request
+
+};
+
+/* ************************************************************************** */
+
+// ArenaAllocator Class
+// --------------------
+// Standard allocator adapter over a MonotonicArena; it only stores a pointer to
+// the arena, so it is cheap to copy and to rebind (List rebinds it to its nodes).
+// Two allocators compare equal when they share the same arena. The allocator
+// propagates on copy/move/swap, so a container assigned from another one keeps
+// drawing from the source arena.
+template <typename T>
+class ArenaAllocator {
+
+private:
+
+protected:
+
+  template <typename U>
+  friend class ArenaAllocator;
+
+  MonotonicArena* arena; // Arena providing the memory
+
+public:
+
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  // Specific constructor
+  ArenaAllocator(MonotonicArena& source) noexcept : arena(&source) {}
+
+  // Rebinding constructor
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+  /* ************************************************************************ */
+
+  T* allocate(std::size_t count);
+  void deallocate(T* ptr, std::size_t count) noexcept;
+
+  MonotonicArena& Arena() const noexcept { return *arena; }
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  template <typename U>
+  bool operator==(const ArenaAllocator<U>& other) const noexcept { return arena == other.arena; }
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U>& other) const noexcept { return arena != other.arena; }
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "arena.cpp"
+
+#endif
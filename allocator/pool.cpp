@@ -0,0 +1,92 @@
+#include <bit>
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// PoolResource
+
+inline PoolResource::PoolResource(std::size_t slabBytes) noexcept
+  : slabSize(slabBytes >= MaxPooledSize ? slabBytes : MaxPooledSize) {}
+
+inline PoolResource::~PoolResource() {
+  while (slabs != nullptr) {
+    Slab* next = slabs->next;
+    ::operator delete(static_cast<void*>(slabs));
+    slabs = next;
+  }
+}
+
+inline void* PoolResource::Allocate(std::size_t bytes, std::size_t align) {
+  if (bytes > MaxPooledSize || align > alignof(std::max_align_t)) {
+    return ::operator new(bytes, std::align_val_t(align));
+  }
+  std::size_t cls = ClassOf(bytes);
+  if (freeLists[cls] == nullptr) {
+    Refill(cls);
+  }
+  FreeChunk* chunk = freeLists[cls];
+  freeLists[cls] = chunk->next;
+  return chunk;
+}
+
+inline void PoolResource::Deallocate(void* ptr, std::size_t bytes, std::size_t align) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  if (bytes > MaxPooledSize || align > alignof(std::max_align_t)) {
+    ::operator delete(ptr, std::align_val_t(align));
+    return;
+  }
+  std::size_t cls = ClassOf(bytes);
+  FreeChunk* chunk = static_cast<FreeChunk*>(ptr);
+  chunk->next = freeLists[cls];
+  freeLists[cls] = chunk;
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions (PoolResource)
+
+inline std::size_t PoolResource::ClassOf(std::size_t bytes) noexcept {
+  // Round up to a power of two no smaller than the minimum class
+  std::size_t rounded = std::bit_ceil(bytes < (std::size_t(1) << MinClassShift) ? (std::size_t(1) << MinClassShift) : bytes);
+  return std::countr_zero(rounded) - MinClassShift;
+}
+
+inline void PoolResource::Refill(std::size_t cls) {
+  std::size_t chunkSize = std::size_t(1) << (cls + MinClassShift);
+  // The header is padded to max_align_t so every chunk keeps the fundamental alignment
+  constexpr std::size_t header = (sizeof(Slab) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+  std::byte* raw = static_cast<std::byte*>(::operator new(header + slabSize));
+  Slab* slab = reinterpret_cast<Slab*>(raw);
+  slab->next = slabs;
+  slabs = slab;
+
+  // Thread the chunks onto the free list, in address order
+  std::byte* first = raw + header;
+  std::size_t count = slabSize / chunkSize;
+  for (std::size_t i = count; i > 0; --i) {
+    FreeChunk* chunk = reinterpret_cast<FreeChunk*>(first + (i - 1) * chunkSize);
+    chunk->next = freeLists[cls];
+    freeLists[cls] = chunk;
+  }
+}
+
+/* ************************************************************************** */
+
+// PoolAllocator
+
+template <typename T>
+T* PoolAllocator<T>::allocate(std::size_t count) {
+  return static_cast<T*>(pool->Allocate(count * sizeof(T), alignof(T)));
+}
+
+template <typename T>
+void PoolAllocator<T>::deallocate(T* ptr, std::size_t count) noexcept {
+  pool->Deallocate(ptr, count * sizeof(T), alignof(T));
+}
+
+/* ************************************************************************** */
+
+}
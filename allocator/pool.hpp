@@ -0,0 +1,139 @@
+#ifndef POOL_HPP
+#define POOL_HPP
+
+/* ************************************************************************** */
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// PoolResource Class
+// ------------------
+// A size-class pool: requests up to MaxPooledSize bytes are rounded up to the
+// next power of two (8, 16, ..., 512) and served from a per-class free list.
+// Free lists are refilled by carving a whole slab into equal chunks, and freed
+// chunks go back on the free list of their class, so the steady state of a
+// container that inserts and removes nodes makes no system calls at all.
+// Larger or over-aligned requests are forwarded to ::operator new.
+// Slabs are only returned to the system by the destructor.
+// Not thread-safe.
+class PoolResource {
+
+private:
+
+  static constexpr std::size_t MinClassShift = 3; // Smallest class: 8 bytes
+  static constexpr std::size_t ClassCount = 7; // Classes 8, 16, 32, 64, 128, 256, 512
+
+  // Free chunk: the link is stored inside the chunk itself
+  struct FreeChunk {
+    FreeChunk* next;
+  };
+
+  // Slab header: slabs are chained only to be released by the destructor
+  struct Slab {
+    Slab* next;
+  };
+
+  FreeChunk* freeLists[ClassCount] = {}; // One free list per size class
+  Slab* slabs = nullptr; // Every slab obtained so far
+
+  std::size_t slabSize; // Bytes carved per slab (excluding the header)
+
+protected:
+
+public:
+
+  static constexpr std::size_t MaxPooledSize = std::size_t(1) << (MinClassShift + ClassCount - 1);
+  static constexpr std::size_t DefaultSlabSize = 64 * 1024;
+
+  // Default constructor - slabs are requested lazily
+  explicit PoolResource(std::size_t slabBytes = DefaultSlabSize) noexcept;
+
+  // A pool owns its slabs and cannot be copied or moved
+  PoolResource(const PoolResource&) = delete;
+  PoolResource& operator=(const PoolResource&) = delete;
+
+  // Destructor - returns every slab to the system
+  ~PoolResource();
+
+  /* ************************************************************************ */
+
+  // Allocate() - Returns 'bytes' bytes aligned to 'align'
+  // Throws std::bad_alloc if the system allocation fails
+  void* Allocate(std::size_t bytes, std::size_t align = alignof(std::max_align_t));
+
+  // Deallocate() - Returns memory obtained from Allocate with the same size and alignment
+  void Deallocate(void* ptr, std::size_t bytes, std::size_t align = alignof(std::max_align_t)) noexcept;
+
+protected:
+
+  // Auxiliary functions
+
+  static std::size_t ClassOf(std::size_t bytes) noexcept; // Size-class index for a pooled request
+  void Refill(std::size_t cls); // Carves a new slab into chunks of the given class
+
+};
+
+/* ************************************************************************** */
+
+// PoolAllocator Class
+// -------------------
+// Standard allocator adapter over a PoolResource. Like ArenaAllocator it only
+// holds a pointer, compares equal when sharing the same resource and propagates
+// on copy/move/swap.
+template <typename T>
+class PoolAllocator {
+
+private:
+
+protected:
+
+  template <typename U>
+  friend class PoolAllocator;
+
+  PoolResource* pool; // Resource providing the memory
+
+public:
+
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  // Specific constructor
+  PoolAllocator(PoolResource& source) noexcept : pool(&source) {}
+
+  // Rebinding constructor
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U>& other) noexcept : pool(other.pool) {}
+
+  /* ************************************************************************ */
+
+  T* allocate(std::size_t count);
+  void deallocate(T* ptr, std::size_t count) noexcept;
+
+  PoolResource& Resource() const noexcept { return *pool; }
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  template <typename U>
+  bool operator==(const PoolAllocator<U>& other) const noexcept { return pool == other.pool; }
+  template <typename U>
+  bool operator!=(const PoolAllocator<U>& other) const noexcept { return pool != other.pool; }
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "pool.cpp"
+
+#endif
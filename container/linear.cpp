@@ -69,6 +69,12 @@ void LinearContainer<Data>::Traverse(TraverseFun fun) const {
   PreOrderTraverse(fun);
 }
 
+// TraverseWhile() - Early-exit traversal, front to back like Traverse
+template<typename Data>
+bool LinearContainer<Data>::TraverseWhile(PredicateFun fun) const {
+  return PreOrderTraverseWhile(fun);
+}
+
 // PreOrderTraverse() - Traverse elements from front to back (left to right)
 // For linear containers, pre-order means natural sequential order
 template<typename Data>
@@ -79,6 +85,17 @@ void LinearContainer<Data>::PreOrderTraverse(TraverseFun fun) const {
   }
 }
 
+// PreOrderTraverseWhile() - Front to back, leaving the loop at the first false
+template<typename Data>
+bool LinearContainer<Data>::PreOrderTraverseWhile(PredicateFun fun) const {
+  for (ulong index = 0; index < size; ++index) {
+    if (!fun(operator[](index))) {
+      return false;
+    }
+  }
+  return true;
+}
+
 // PostOrderTraverse() - Traverse elements from back to front (right to left)
 // For linear containers, post-order means reverse sequential order
 template<typename Data>
@@ -90,6 +107,18 @@ void LinearContainer<Data>::PostOrderTraverse(TraverseFun fun) const {
   }
 }
 
+// PostOrderTraverseWhile() - Back to front, leaving the loop at the first false
+template<typename Data>
+bool LinearContainer<Data>::PostOrderTraverseWhile(PredicateFun fun) const {
+  ulong index = size;
+  while (index > 0) {
+    if (!fun(operator[](--index))) {
+      return false;
+    }
+  }
+  return true;
+}
+
 /* ************************************************************************** */
 // MutableLinearContainer Implementation - Mapping Functions
 /* ************************************************************************** */
@@ -128,72 +157,157 @@ void MutableLinearContainer<Data>::PostOrderMap(MapFun fun) {
 /* ************************************************************************** */
 
 // Sort() - Public interface for sorting the container in ascending order
-// Uses QuickSort algorithm for efficient O(n log n) average-case performance
+// Generic path: every element access goes through the virtual operator[]
 template<typename Data>
 void SortableLinearContainer<Data>::Sort() {
-  // Only sort if there are at least 2 elements to sort
-  if (this->size > 1) {
-    QuickSort(0, this->size - 1); // Sort the entire range
-  }
+  IntroSort([this](ulong index) -> Data& { return this->operator[](index); }, this->size,
+            [](const Data& a, const Data& b) { return a < b; });
 }
 
 /* ************************************************************************** */
-// SortableLinearContainer Implementation - QuickSort Algorithm
+// SortableLinearContainer Implementation - Introsort Engine
 /* ************************************************************************** */
 
-// QuickSort() - Recursive implementation of the QuickSort algorithm
-// Divides the array into partitions around a pivot and recursively sorts each partition
-template<typename Data>
-void SortableLinearContainer<Data>::QuickSort(ulong p, ulong r) {
-  // Base case: if p >= r, the subarray has 0 or 1 elements and is already sorted
-  if (p < r) {
-    // Partition the array and get the pivot position
-    ulong q = Partition(p, r);
-    
-    // Recursively sort the left partition (elements smaller than pivot)
-    if (q > 0) {
-      QuickSort(p, q);
+// IntroSort() - Entry point: the depth limit is 2 * floor(log2(count))
+template<typename Data>
+template<typename Access, typename Less>
+void SortableLinearContainer<Data>::IntroSort(Access access, ulong count, Less less) {
+  if (count > 1) {
+    ulong depth = 2 * (std::bit_width(count) - 1);
+    IntroSortLoop(access, 0, count, depth, less);
+    InsertionSort(access, 0, count, less); // Finish the short unsorted pieces in one pass
+  }
+}
+
+// IntroSortLoop() - Quicksort down to pieces of InsertionSortCutoff elements
+// The smaller part is sorted recursively and the larger one iteratively, so the
+// stack depth stays logarithmic; when 'depth' runs out the piece is heapsorted
+template<typename Data>
+template<typename Access, typename Less>
+void SortableLinearContainer<Data>::IntroSortLoop(Access& access, ulong first, ulong last, ulong depth, Less& less) {
+  while (last - first > InsertionSortCutoff) {
+    if (depth == 0) {
+      HeapSort(access, first, last, less);
+      return;
+    }
+    --depth;
+
+    // Choose the pivot among elements of [first + 1, last) and move it to first
+    ulong count = last - first;
+    ulong mid = first + count / 2;
+    ulong pivot;
+    if (count > NintherThreshold) {
+      ulong step = count / 8;
+      ulong low = MedianOf(access, first + 1, first + 1 + step, first + 1 + 2 * step, less);
+      ulong middle = MedianOf(access, mid - step, mid, mid + step, less);
+      ulong high = MedianOf(access, last - 1 - 2 * step, last - 1 - step, last - 1, less);
+      pivot = MedianOf(access, low, middle, high, less);
+    } else {
+      pivot = MedianOf(access, first + 1, mid, last - 1, less);
+    }
+    using std::swap;
+    swap(access(first), access(pivot));
+
+    ulong cut = Partition(access, first, last, less);
+
+    if (cut - first < last - cut) {
+      IntroSortLoop(access, first, cut, depth, less);
+      first = cut;
+    } else {
+      IntroSortLoop(access, cut, last, depth, less);
+      last = cut;
     }
-    
-    // Recursively sort the right partition (elements larger than pivot)
-    QuickSort(q + 1, r);
-  }
-}
-
-// Partition() - Partitions the array around a pivot element
-// Rearranges elements so that smaller elements are on the left, larger on the right
-// Returns the final position of the pivot
-template<typename Data>
-ulong SortableLinearContainer<Data>::Partition(ulong p, ulong r) {
-  // Choose the first element as the pivot
-  Data x = this->operator[](p);
-  ulong i = p - 1; // Index for smaller elements
-  ulong j = r + 1; // Index for larger elements
-  
-  do {
-    // Move j leftward to find an element <= pivot
-    do {
-      j--;
-    } while (this->operator[](j) > x);
-    
-    // Move i rightward to find an element >= pivot
-    do {
-      i++;
-    } while (this->operator[](i) < x);
-    
-    // If pointers haven't crossed, swap the misplaced elements
-    if (i < j) {
-      // Create copies of the values for the SwapAt call
-      Data temp_i = this->operator[](i);
-      Data temp_j = this->operator[](j);
-      
-      // Use the virtual SwapAt function (implemented by derived classes)
-      // This allows different container types to handle swapping appropriately
-      SwapAt(i, j, temp_i, temp_j);
+  }
+}
+
+// MedianOf() - Index holding the median of the three elements
+template<typename Data>
+template<typename Access, typename Less>
+ulong SortableLinearContainer<Data>::MedianOf(Access& access, ulong a, ulong b, ulong c, Less& less) {
+  if (less(access(a), access(b))) {
+    if (less(access(b), access(c))) return b;
+    return less(access(a), access(c)) ? c : a;
+  }
+  if (less(access(a), access(c))) return a;
+  return less(access(b), access(c)) ? c : b;
+}
+
+// Partition() - Hoare partition without bound checks
+// The pivot is a median of elements still inside [first + 1, last), so both
+// scans are guaranteed to stop inside the range
+template<typename Data>
+template<typename Access, typename Less>
+ulong SortableLinearContainer<Data>::Partition(Access& access, ulong first, ulong last, Less& less) {
+  const Data& pivot = access(first);
+  ulong left = first + 1;
+  ulong right = last;
+  while (true) {
+    while (less(access(left), pivot)) {
+      ++left;
+    }
+    --right;
+    while (less(pivot, access(right))) {
+      --right;
     }
-  } while (i < j); // Continue until pointers cross
-  
-  return j; // Return the partition point
+    if (!(left < right)) {
+      return left;
+    }
+    using std::swap;
+    swap(access(left), access(right));
+    ++left;
+  }
+}
+
+// InsertionSort() - Shifts each element left (by moves) until it is in place
+template<typename Data>
+template<typename Access, typename Less>
+void SortableLinearContainer<Data>::InsertionSort(Access& access, ulong first, ulong last, Less& less) {
+  for (ulong index = first + 1; index < last; ++index) {
+    if (less(access(index), access(index - 1))) {
+      Data value = std::move(access(index));
+      ulong hole = index;
+      do {
+        access(hole) = std::move(access(hole - 1));
+        --hole;
+      } while (hole > first && less(value, access(hole - 1)));
+      access(hole) = std::move(value);
+    }
+  }
+}
+
+// HeapSort() - Builds a max-heap on [first, last) and repeatedly moves the maximum to the end
+template<typename Data>
+template<typename Access, typename Less>
+void SortableLinearContainer<Data>::HeapSort(Access& access, ulong first, ulong last, Less& less) {
+  ulong count = last - first;
+  for (ulong root = count / 2; root > 0; --root) {
+    SiftDown(access, first, root - 1, count, less);
+  }
+  using std::swap;
+  for (ulong end = count - 1; end > 0; --end) {
+    swap(access(first), access(first + end));
+    SiftDown(access, first, 0, end, less);
+  }
+}
+
+// SiftDown() - Moves the root value down through a hole until no child is larger
+template<typename Data>
+template<typename Access, typename Less>
+void SortableLinearContainer<Data>::SiftDown(Access& access, ulong first, ulong root, ulong count, Less& less) {
+  Data value = std::move(access(first + root));
+  ulong hole = root;
+  ulong child;
+  while ((child = 2 * hole + 1) < count) {
+    if (child + 1 < count && less(access(first + child), access(first + child + 1))) {
+      ++child;
+    }
+    if (!less(value, access(first + child))) {
+      break;
+    }
+    access(first + hole) = std::move(access(first + child));
+    hole = child;
+  }
+  access(first + hole) = std::move(value);
 }
 
 /* ************************************************************************** */
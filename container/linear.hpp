@@ -3,6 +3,9 @@
 
 /* ************************************************************************** */
 
+#include <bit>
+#include <utility>
+
 #include "mappable.hpp"
 
 /* ************************************************************************** */
@@ -80,6 +83,12 @@ public:
   // For linear containers, this typically means front-to-back traversal
   void Traverse(TraverseFun) const override;
 
+  // Import PredicateFun type from base class for type consistency
+  using typename TraversableContainer<Data>::PredicateFun;
+
+  // TraverseWhile() - Front-to-back traversal that stops when the function returns false
+  bool TraverseWhile(PredicateFun) const override;
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from PreOrderTraversableContainer)
@@ -88,6 +97,9 @@ public:
   // For linear structures, pre-order is the natural left-to-right order
   void PreOrderTraverse(TraverseFun) const override;
 
+  // PreOrderTraverseWhile() - Front to back, stopping when the function returns false
+  bool PreOrderTraverseWhile(PredicateFun) const override;
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from PostOrderTraversableContainer)
@@ -96,6 +108,9 @@ public:
   // For linear structures, post-order is the reverse order (right-to-left)
   void PostOrderTraverse(TraverseFun) const override;
 
+  // PostOrderTraverseWhile() - Back to front, stopping when the function returns false
+  bool PostOrderTraverseWhile(PredicateFun) const override;
+
 };
 
 /* ************************************************************************** */
@@ -185,7 +200,11 @@ public:
 // ----------------------------
 // Extends MutableLinearContainer with sorting capability
 // Provides functionality to arrange elements in ascending order using comparison operators
-// Uses QuickSort algorithm as the default sorting implementation
+// Sorting uses an introsort engine: quicksort with a median-of-three (ninther on
+// large ranges) pivot, insertion sort on short ranges and a heapsort fallback when
+// the recursion gets too deep, so the worst case is O(n log n) with O(log n) stack.
+// The engine reaches the elements through an accessor functor; the default Sort()
+// goes through operator[], while contiguous containers pass a direct accessor.
 template <typename Data>
 class SortableLinearContainer : virtual public MutableLinearContainer<Data> {
 
@@ -212,29 +231,46 @@ public:
 
   // Sort() - Sorts the elements in the container in ascending order
   // Uses the < operator for comparison, so Data type must support comparison
-  // Default implementation uses QuickSort algorithm for O(n log n) average performance
+  // Default implementation runs the introsort engine through operator[] (not stable)
   virtual void Sort();
 
 protected:
 
-  // Auxiliary member functions for sorting implementation
-
-  // QuickSort() - Recursive QuickSort algorithm implementation
-  // Sorts elements between indices left and right (inclusive)
-  // Parameters: left index, right index
-  void QuickSort(ulong, ulong);
-  
-  // Partition() - Helper function for QuickSort that partitions the array
-  // Rearranges elements so that elements smaller than pivot are on the left
-  // Returns the final position of the pivot element
-  // Parameters: left index, right index
-  ulong Partition(ulong, ulong);
-  
-  // SwapAt() - Swaps elements at the specified positions
-  // This is an abstract method that must be implemented by concrete derived classes
-  // The implementation depends on how the specific container stores its elements
-  // Parameters: position1, position2, reference to element1, reference to element2
-  virtual void SwapAt(ulong, ulong, const Data&, const Data&) = 0;
+  // Introsort engine
+  // Access is a callable mapping an index to a Data& and Less a strict weak ordering;
+  // elements are only ever moved or swapped, never copied.
+
+  static constexpr ulong InsertionSortCutoff = 16; // Ranges this short are insertion-sorted
+  static constexpr ulong NintherThreshold = 128; // Ranges longer than this use Tukey's ninther
+
+  // IntroSort() - Sorts the indices [0, count)
+  template <typename Access, typename Less>
+  static void IntroSort(Access, ulong, Less);
+
+  // IntroSortLoop() - Partitions [first, last) until the pieces are short or the depth runs out
+  template <typename Access, typename Less>
+  static void IntroSortLoop(Access&, ulong, ulong, ulong, Less&);
+
+  // MedianOf() - Index of the median among three indices
+  template <typename Access, typename Less>
+  static ulong MedianOf(Access&, ulong, ulong, ulong, Less&);
+
+  // Partition() - Hoare partition of [first + 1, last) around the pivot stored at first;
+  // returns the start of the right part
+  template <typename Access, typename Less>
+  static ulong Partition(Access&, ulong, ulong, Less&);
+
+  // InsertionSort() - Sorts [first, last) by insertion
+  template <typename Access, typename Less>
+  static void InsertionSort(Access&, ulong, ulong, Less&);
+
+  // HeapSort() - Sorts [first, last) by heapsort (depth-limit fallback)
+  template <typename Access, typename Less>
+  static void HeapSort(Access&, ulong, ulong, Less&);
+
+  // SiftDown() - Restores the max-heap rooted at 'root' in the heap [first, first + count)
+  template <typename Access, typename Less>
+  static void SiftDown(Access&, ulong, ulong, ulong, Less&);
 
 };
 
@@ -0,0 +1,75 @@
+#ifndef ORDER_HPP
+#define ORDER_HPP
+
+/* ************************************************************************** */
+
+#include <compare>
+#include <concepts>
+#include <functional>
+#include <type_traits>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Order: Comparator policy of the ordered containers (SetVec, SetLst, SetBTree, HeapVec, PQHeap)
+// 'Compare' is a strict weak ordering on Data, std::less<Data> by default; two
+// elements are equivalent when neither precedes the other. A custom comparator
+// (e.g. std::greater<Data> for a min-heap) replaces wrapping every element in a
+// type with inverted operators.
+template <typename Data, typename Compare = std::less<Data>>
+class Order {
+
+private:
+
+  [[no_unique_address]] Compare compare;
+
+public:
+
+  // The natural order of Data: containers keep the fast paths that rely on it
+  // (radix sort, learned lookup, operator== as the equivalence test)
+  static constexpr bool Natural = std::is_same_v<Compare, std::less<Data>> || std::is_same_v<Compare, std::less<>>;
+
+  // Natural orders with a total operator<=> are compared three-way in a single call
+  static constexpr bool NativeThreeWay = Natural && std::three_way_comparable<Data, std::weak_ordering>;
+
+  Order() = default;
+  explicit Order(const Compare& comp) : compare(comp) {}
+
+  // Less: True if the first element precedes the second
+  bool Less(const Data& a, const Data& b) const { return compare(a, b); }
+
+  // Equivalent: True if neither element precedes the other
+  bool Equivalent(const Data& a, const Data& b) const {
+    if constexpr (Natural && std::equality_comparable<Data>) {
+      return a == b;
+    } else {
+      return !compare(a, b) && !compare(b, a);
+    }
+  }
+
+  // ThreeWay: Position of the first element relative to the second
+  // One operator<=> call for natural orders, otherwise at most two comparator calls
+  std::weak_ordering ThreeWay(const Data& a, const Data& b) const {
+    if constexpr (NativeThreeWay) {
+      return a <=> b;
+    } else {
+      if (compare(a, b)) {
+        return std::weak_ordering::less;
+      }
+      return compare(b, a) ? std::weak_ordering::greater : std::weak_ordering::equivalent;
+    }
+  }
+
+  // Comparator: The wrapped comparison object
+  const Compare& Comparator() const noexcept { return compare; }
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#endif
@@ -17,20 +17,53 @@ Accumulator TraversableContainer<Data>::Fold(FoldFun<Accumulator> fun, Accumulat
   return acc; // Return the final accumulated value
 }
 
-// Exists() - Implementation that checks if a specific value exists in the container
-// Uses traversal to search through all elements until the value is found
+// TraverseWhile() - Default implementation on top of Traverse
+// Once the function returns false it is not called again, but Traverse itself
+// still runs to the end: containers that can stop their loop override this
 template <typename Data>
-bool TraversableContainer<Data>::Exists(const Data & val) const noexcept {
-  bool found = false;
-  // Traverse all elements, stopping when we find the target value
-  Traverse([&found, &val](const Data & dat) {
-    if (!found && dat == val) {
-      found = true;
+bool TraversableContainer<Data>::TraverseWhile(PredicateFun fun) const {
+  bool running = true;
+  Traverse([&fun, &running](const Data & dat) {
+    if (running) {
+      running = fun(dat);
+    }
+  });
+  return running;
+}
+
+// Any() - True as soon as one element satisfies the predicate
+template <typename Data>
+bool TraversableContainer<Data>::Any(PredicateFun fun) const {
+  return !TraverseWhile([&fun](const Data & dat) { return !fun(dat); });
+}
+
+// All() - False as soon as one element fails the predicate
+template <typename Data>
+bool TraversableContainer<Data>::All(PredicateFun fun) const {
+  return TraverseWhile(fun);
+}
+
+// FindFirst() - Remembers the address of the first matching element and stops
+template <typename Data>
+const Data * TraversableContainer<Data>::FindFirst(PredicateFun fun) const {
+  const Data * found = nullptr;
+  TraverseWhile([&fun, &found](const Data & dat) {
+    if (fun(dat)) {
+      found = &dat;
+      return false;
     }
+    return true;
   });
   return found;
 }
 
+// Exists() - Implementation that checks if a specific value exists in the container
+// Uses an early-exit traversal that stops at the first match
+template <typename Data>
+bool TraversableContainer<Data>::Exists(const Data & val) const noexcept {
+  return !TraverseWhile([&val](const Data & dat) { return !(dat == val); });
+}
+
 /* ************************************************************************** */
 // PreOrderTraversableContainer Implementation
 /* ************************************************************************** */
@@ -57,6 +90,24 @@ void PreOrderTraversableContainer<Data>::Traverse(TraverseFun fun) const {
   PreOrderTraverse(fun);
 }
 
+// PreOrderTraverseWhile() - Default implementation on top of PreOrderTraverse (cannot stop it early)
+template <typename Data>
+bool PreOrderTraversableContainer<Data>::PreOrderTraverseWhile(PredicateFun fun) const {
+  bool running = true;
+  PreOrderTraverse([&fun, &running](const Data & dat) {
+    if (running) {
+      running = fun(dat);
+    }
+  });
+  return running;
+}
+
+// TraverseWhile() - Override from TraversableContainer, implemented using pre-order traversal
+template <typename Data>
+bool PreOrderTraversableContainer<Data>::TraverseWhile(PredicateFun fun) const {
+  return PreOrderTraverseWhile(fun);
+}
+
 /* ************************************************************************** */
 // PostOrderTraversableContainer Implementation
 /* ************************************************************************** */
@@ -83,6 +134,24 @@ void PostOrderTraversableContainer<Data>::Traverse(TraverseFun fun) const {
   PostOrderTraverse(fun);
 }
 
+// PostOrderTraverseWhile() - Default implementation on top of PostOrderTraverse (cannot stop it early)
+template <typename Data>
+bool PostOrderTraversableContainer<Data>::PostOrderTraverseWhile(PredicateFun fun) const {
+  bool running = true;
+  PostOrderTraverse([&fun, &running](const Data & dat) {
+    if (running) {
+      running = fun(dat);
+    }
+  });
+  return running;
+}
+
+// TraverseWhile() - Override from TraversableContainer, implemented using post-order traversal
+template <typename Data>
+bool PostOrderTraversableContainer<Data>::TraverseWhile(PredicateFun fun) const {
+  return PostOrderTraverseWhile(fun);
+}
+
 /* ************************************************************************** */
 // InOrderTraversableContainer Implementation
 /* ************************************************************************** */
@@ -109,6 +178,24 @@ void InOrderTraversableContainer<Data>::Traverse(TraverseFun fun) const {
   InOrderTraverse(fun);
 }
 
+// InOrderTraverseWhile() - Default implementation on top of InOrderTraverse (cannot stop it early)
+template <typename Data>
+bool InOrderTraversableContainer<Data>::InOrderTraverseWhile(PredicateFun fun) const {
+  bool running = true;
+  InOrderTraverse([&fun, &running](const Data & dat) {
+    if (running) {
+      running = fun(dat);
+    }
+  });
+  return running;
+}
+
+// TraverseWhile() - Override from TraversableContainer, implemented using in-order traversal
+template <typename Data>
+bool InOrderTraversableContainer<Data>::TraverseWhile(PredicateFun fun) const {
+  return InOrderTraverseWhile(fun);
+}
+
 /* ************************************************************************** */
 // BreadthTraversableContainer Implementation
 /* ************************************************************************** */
@@ -135,6 +222,24 @@ void BreadthTraversableContainer<Data>::Traverse(TraverseFun fun) const {
   BreadthTraverse(fun);
 }
 
+// BreadthTraverseWhile() - Default implementation on top of BreadthTraverse (cannot stop it early)
+template <typename Data>
+bool BreadthTraversableContainer<Data>::BreadthTraverseWhile(PredicateFun fun) const {
+  bool running = true;
+  BreadthTraverse([&fun, &running](const Data & dat) {
+    if (running) {
+      running = fun(dat);
+    }
+  });
+  return running;
+}
+
+// TraverseWhile() - Override from TraversableContainer, implemented using breadth-first traversal
+template <typename Data>
+bool BreadthTraversableContainer<Data>::TraverseWhile(PredicateFun fun) const {
+  return BreadthTraverseWhile(fun);
+}
+
 /* ************************************************************************** */
 // Template Instantiations
 // These explicit instantiations ensure the templates are compiled for common types
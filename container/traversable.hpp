@@ -69,12 +69,30 @@ public:
   template <typename Accumulator>
   Accumulator Fold(FoldFun<Accumulator>, Accumulator) const;
 
+  // Function type for early-exit traversals and predicate queries
+  using PredicateFun = std::function<bool(const Data &)>;
+
+  // TraverseWhile() - Apply a function to the elements until it returns false
+  // Returns true if every element was visited (the function never returned false)
+  // The default implementation is built on Traverse, so it can only skip the
+  // remaining calls; concrete containers override it with a loop that exits
+  virtual bool TraverseWhile(PredicateFun) const;
+
+  // Any()/All() - Check whether some/every element satisfies the predicate
+  // Both stop at the first element that decides the answer
+  bool Any(PredicateFun) const;
+  bool All(PredicateFun) const;
+
+  // FindFirst() - Return the first element (in traversal order) satisfying the predicate
+  // Returns nullptr if there is none; the pointer is valid until the container is modified
+  const Data * FindFirst(PredicateFun) const;
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from TestableContainer)
 
   // Exists() - Implementation using traversal to check if an element exists
-  // This provides a default implementation by traversing and comparing elements
+  // Stops at the first match through TraverseWhile
   bool Exists(const Data &) const noexcept override;
 
 };
@@ -132,6 +150,13 @@ public:
   template <typename Accumulator>
   Accumulator PreOrderFold(FoldFun<Accumulator>, Accumulator) const;
 
+  // Import the PredicateFun type from the base class
+  using typename TraversableContainer<Data>::PredicateFun;
+
+  // PreOrderTraverseWhile() - Traverse in pre-order order until the function returns false
+  // The default implementation is built on PreOrderTraverse and cannot stop it early
+  virtual bool PreOrderTraverseWhile(PredicateFun) const;
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from TraversableContainer)
@@ -139,6 +164,9 @@ public:
   // Traverse() - Default implementation uses pre-order traversal
   void Traverse(TraverseFun) const override;
 
+  // TraverseWhile() - Default implementation uses pre-order traversal
+  bool TraverseWhile(PredicateFun) const override;
+
 };
 
 /* ************************************************************************** */
@@ -194,6 +222,13 @@ public:
   template <typename Accumulator>
   Accumulator PostOrderFold(FoldFun<Accumulator>, Accumulator) const;
 
+  // Import the PredicateFun type from the base class
+  using typename TraversableContainer<Data>::PredicateFun;
+
+  // PostOrderTraverseWhile() - Traverse in post-order order until the function returns false
+  // The default implementation is built on PostOrderTraverse and cannot stop it early
+  virtual bool PostOrderTraverseWhile(PredicateFun) const;
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from TraversableContainer)
@@ -201,6 +236,9 @@ public:
   // Traverse() - Default implementation uses post-order traversal
   void Traverse(TraverseFun) const override;
 
+  // TraverseWhile() - Default implementation uses post-order traversal
+  bool TraverseWhile(PredicateFun) const override;
+
 };
 
 /* ************************************************************************** */
@@ -256,6 +294,13 @@ public:
   template <typename Accumulator>
   Accumulator InOrderFold(FoldFun<Accumulator>, Accumulator) const;
 
+  // Import the PredicateFun type from the base class
+  using typename TraversableContainer<Data>::PredicateFun;
+
+  // InOrderTraverseWhile() - Traverse in in-order order until the function returns false
+  // The default implementation is built on InOrderTraverse and cannot stop it early
+  virtual bool InOrderTraverseWhile(PredicateFun) const;
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from TraversableContainer)
@@ -263,6 +308,9 @@ public:
   // Traverse() - Default implementation uses in-order traversal
   void Traverse(TraverseFun) const override;
 
+  // TraverseWhile() - Default implementation uses in-order traversal
+  bool TraverseWhile(PredicateFun) const override;
+
 };
 
 /* ************************************************************************** */
@@ -318,6 +366,13 @@ public:
   template <typename Accumulator>
   Accumulator BreadthFold(FoldFun<Accumulator>, Accumulator) const;
 
+  // Import the PredicateFun type from the base class
+  using typename TraversableContainer<Data>::PredicateFun;
+
+  // BreadthTraverseWhile() - Traverse in breadth-first order until the function returns false
+  // The default implementation is built on BreadthTraverse and cannot stop it early
+  virtual bool BreadthTraverseWhile(PredicateFun) const;
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from TraversableContainer)
@@ -325,6 +380,9 @@ public:
   // Traverse() - Default implementation uses breadth-first traversal
   void Traverse(TraverseFun) const override;
 
+  // TraverseWhile() - Default implementation uses breadth-first traversal
+  bool TraverseWhile(PredicateFun) const override;
+
 };
 
 /* ************************************************************************** */
@@ -0,0 +1,175 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// FalsePositiveRate: Absent elements are the rejected lookups plus the false positives
+inline double BloomStats::FalsePositiveRate() const noexcept {
+  ulong absent = rejected + falsePositives;
+  return (absent == 0) ? 0.0 : static_cast<double>(falsePositives) / static_cast<double>(absent);
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename Alloc, typename Hash>
+BloomFilter<Data, Alloc, Hash>::BloomFilter(const Alloc& allocator) noexcept
+  : blocks(BlockAlloc(allocator)) {}
+
+template <typename Data, typename Alloc, typename Hash>
+BloomFilter<Data, Alloc, Hash>::BloomFilter(ulong bits, const Alloc& allocator) noexcept
+  : blocks(BlockAlloc(allocator)), bitsPerKey((bits == 0) ? 1 : bits), probes(ProbesFor(bitsPerKey)) {}
+
+template <typename Data, typename Alloc, typename Hash>
+BloomFilter<Data, Alloc, Hash>::BloomFilter(BloomFilter&& other) noexcept
+  : blocks(std::move(other.blocks)), bitsPerKey(other.bitsPerKey), probes(other.probes),
+    planned(std::exchange(other.planned, 0)), added(std::exchange(other.added, 0)), stats(other.stats) {}
+
+template <typename Data, typename Alloc, typename Hash>
+BloomFilter<Data, Alloc, Hash>& BloomFilter<Data, Alloc, Hash>::operator=(BloomFilter&& other)
+  noexcept(BlockTraits::propagate_on_container_move_assignment::value || BlockTraits::is_always_equal::value) {
+  std::swap(blocks, other.blocks);
+  std::swap(bitsPerKey, other.bitsPerKey);
+  std::swap(probes, other.probes);
+  std::swap(planned, other.planned);
+  std::swap(added, other.added);
+  std::swap(stats, other.stats);
+  return *this;
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename Alloc, typename Hash>
+ulong BloomFilter<Data, Alloc, Hash>::Mix(ulong hash) noexcept {
+  hash ^= hash >> 33;
+  hash *= 0xFF51AFD7ED558CCDUL;
+  hash ^= hash >> 33;
+  hash *= 0xC4CEB9FE1A85EC53UL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+// ProbesFor: b ln 2 rounded (0.693 ~ 45/64), between 1 and the eight words of a block
+template <typename Data, typename Alloc, typename Hash>
+constexpr ulong BloomFilter<Data, Alloc, Hash>::ProbesFor(ulong bits) noexcept {
+  ulong k = (bits * 45 + 32) / 64;
+  return (k < 1) ? 1 : (k > 8) ? 8 : k;
+}
+
+// Locate: The high half of the hash scaled to the number of blocks
+template <typename Data, typename Alloc, typename Hash>
+ulong BloomFilter<Data, Alloc, Hash>::Locate(ulong hash) const noexcept {
+  return ((hash >> 32) * blocks.Size()) >> 32;
+}
+
+/* ************************************************************************** */
+
+// Build: The blocks are reused when the planned size needs as many as before
+template <typename Data, typename Alloc, typename Hash>
+void BloomFilter<Data, Alloc, Hash>::Build(const TraversableContainer<Data>& container) {
+  planned = 0;
+  ulong keys = container.Size() + container.Size() / 2;
+  keys = (keys < MinKeys) ? MinKeys : keys;
+  ulong count = (keys * bitsPerKey + 511) / 512;
+  if (blocks.Size() == count) {
+    blocks.ForEachMut([](Block& block) { block = Block(); });
+  } else {
+    Vector<Block, BlockAlloc> fresh(count, blocks.GetAllocator());
+    blocks = std::move(fresh);
+  }
+  planned = keys;
+  added = 0;
+  container.Traverse([this](const Data& element) { Add(element); });
+}
+
+template <typename Data, typename Alloc, typename Hash>
+void BloomFilter<Data, Alloc, Hash>::Add(const Data& data) noexcept {
+  if (planned == 0) {
+    return;
+  }
+  ulong hash = Mix(static_cast<ulong>(Hash()(data)));
+  Block& block = blocks.begin()[Locate(hash)];
+  std::uint32_t low = static_cast<std::uint32_t>(hash);
+  for (ulong i = 0; i < probes; ++i) {
+    std::uint32_t probe = low * Salt[i];
+    block.words[probe >> 29] |= std::uint64_t(1) << ((probe >> 23) & 63);
+  }
+  ++added;
+}
+
+template <typename Data, typename Alloc, typename Hash>
+void BloomFilter<Data, Alloc, Hash>::Invalidate() noexcept {
+  planned = 0;
+  added = 0;
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename Alloc, typename Hash>
+bool BloomFilter<Data, Alloc, Hash>::Built() const noexcept {
+  return planned != 0;
+}
+
+template <typename Data, typename Alloc, typename Hash>
+bool BloomFilter<Data, Alloc, Hash>::Fresh(ulong live) const noexcept {
+  return planned != 0 && added <= planned && 2 * live >= added;
+}
+
+template <typename Data, typename Alloc, typename Hash>
+bool BloomFilter<Data, Alloc, Hash>::MayContain(const Data& data) const noexcept {
+  if (planned == 0) {
+    return true;
+  }
+  ulong hash = Mix(static_cast<ulong>(Hash()(data)));
+  const Block& block = blocks.begin()[Locate(hash)];
+  std::uint32_t low = static_cast<std::uint32_t>(hash);
+  bool all = true;
+  for (ulong i = 0; i < probes; ++i) {
+    std::uint32_t probe = low * Salt[i];
+    all &= ((block.words[probe >> 29] >> ((probe >> 23) & 63)) & 1) != 0; // No early exit: one block, few words
+  }
+  return all;
+}
+
+template <typename Data, typename Alloc, typename Hash>
+bool BloomFilter<Data, Alloc, Hash>::Rejects(const Data& data) noexcept {
+  bool rejected = !MayContain(data);
+  ++stats.queries;
+  stats.rejected += rejected ? 1 : 0;
+  return rejected;
+}
+
+template <typename Data, typename Alloc, typename Hash>
+void BloomFilter<Data, Alloc, Hash>::Missed() noexcept {
+  ++stats.falsePositives;
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename Alloc, typename Hash>
+ulong BloomFilter<Data, Alloc, Hash>::BitsPerKey() const noexcept {
+  return bitsPerKey;
+}
+
+template <typename Data, typename Alloc, typename Hash>
+ulong BloomFilter<Data, Alloc, Hash>::Probes() const noexcept {
+  return probes;
+}
+
+template <typename Data, typename Alloc, typename Hash>
+ulong BloomFilter<Data, Alloc, Hash>::Bits() const noexcept {
+  return (planned == 0) ? 0 : blocks.Size() * 512;
+}
+
+template <typename Data, typename Alloc, typename Hash>
+const BloomStats& BloomFilter<Data, Alloc, Hash>::Stats() const noexcept {
+  return stats;
+}
+
+template <typename Data, typename Alloc, typename Hash>
+void BloomFilter<Data, Alloc, Hash>::ResetStats() noexcept {
+  stats = BloomStats();
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,179 @@
+
+/*
+ * BloomFilter - Blocked Bloom Filter
+ *
+ * This file defines an approximate membership filter used by the ordered sets
+ * (SetVec, SetLst) to answer most lookups of absent elements without searching.
+ * A query may wrongly report an element as present (a false positive), but an
+ * element added since the last build is never reported absent.
+ *
+ * Key Features:
+ * - One 512-bit block (a cache line) per query: a lookup costs one miss at most
+ * - Configurable bits per key; the number of bits set per key follows from it
+ * - Query counters reporting how many absent elements the filter let through
+ *
+ * The filter cannot forget elements: its owner adds every inserted element and
+ * rebuilds it from scratch after bulk changes or once removals pile up. The
+ * blocks come from the owner's allocator, rebound to the block type.
+ */
+
+#ifndef BLOOM_HPP
+#define BLOOM_HPP
+
+/* ************************************************************************** */
+
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "../container/traversable.hpp"
+#include "../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// BloomHashable: Elements the filter can hash with the given functor
+template <typename Data, typename Hash = std::hash<Data>>
+concept BloomHashable = std::default_initializable<Hash> && requires(const Hash& hash, const Data& data) {
+  { hash(data) } -> std::convertible_to<std::size_t>;
+};
+
+// BloomStats: Counters of the lookups that consulted a filter
+struct BloomStats {
+  ulong queries = 0;        // Lookups that consulted the filter
+  ulong rejected = 0;       // Lookups answered "absent" by the filter alone
+  ulong falsePositives = 0; // Lookups the filter let through that found nothing
+
+  // FalsePositiveRate: Share of the absent elements the filter let through (0 before any)
+  double FalsePositiveRate() const noexcept;
+};
+
+/* ************************************************************************** */
+
+/*
+ * BloomFilter Class - Blocked Bloom Filter
+ *
+ * The bits are split into 512-bit blocks of eight 64-bit words. An element's
+ * mixed hash picks one block (high half) and sets k bits in it: probe i
+ * multiplies the low half by an odd salt, whose top 3 bits pick the word and
+ * next 6 bits the bit. With b bits per key, k is about b ln 2, at most 8.
+ *
+ * Build sizes the blocks for the given elements plus half as many again, so a
+ * filter tracking a growing set stays within its planned keys for a while. Its
+ * owner decides when to rebuild: Fresh tells whether the filter still holds its
+ * planned number of keys and whether at least half of the keys it was given
+ * are still live.
+ *
+ * Performance Characteristics:
+ * - Add/MayContain: O(k) bit operations on a single block
+ * - Build: O(n), allocating about 1.5 n b bits
+ * - False-positive rate: about 1% at 10 bits per key, 0.1% at 16
+ */
+template <typename Data, typename Alloc = std::allocator<Data>, typename Hash = std::hash<Data>>
+class BloomFilter {
+
+private:
+
+  struct alignas(64) Block {
+    std::uint64_t words[8] = {};
+    bool operator==(const Block&) const = default;
+  };
+
+  // Odd multipliers spreading the low hash bits over the 512 bits of a block
+  static constexpr std::uint32_t Salt[8] = {0x47B6137BU, 0x44974D91U, 0x8824AD5BU, 0xA2B7289DU,
+                                            0x705495C7U, 0x2DF1424BU, 0x9EFC4947U, 0x5C6BFB31U};
+
+  using BlockAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Block>;
+  using BlockTraits = std::allocator_traits<BlockAlloc>;
+
+protected:
+
+  Vector<Block, BlockAlloc> blocks;    // Bit array (kept across rebuilds of the same size)
+  ulong bitsPerKey = DefaultBitsPerKey; // Configured bits per planned key
+  ulong probes = ProbesFor(DefaultBitsPerKey); // Bits set per key
+  ulong planned = 0;                   // Keys the blocks were sized for (0 until built)
+  ulong added = 0;                     // Keys added since the last build
+  BloomStats stats;
+
+  // Mix: Spreads the bits of a hash over both halves (murmur finalizer)
+  static ulong Mix(ulong) noexcept;
+
+  // ProbesFor: Bits set per key for a number of bits per key
+  static constexpr ulong ProbesFor(ulong) noexcept;
+
+  // Locate: Index of the block of a mixed hash
+  ulong Locate(ulong) const noexcept;
+
+public:
+
+  static constexpr ulong DefaultBitsPerKey = 10;
+  static constexpr ulong MinKeys = 64; // Smallest number of planned keys
+
+  // Default constructor: Unbuilt filter with the default bits per key
+  BloomFilter() = default;
+
+  // Allocator constructor: Unbuilt filter with the default bits per key, drawing its blocks from the allocator
+  explicit BloomFilter(const Alloc&) noexcept;
+
+  // Specific constructor: Unbuilt filter with the given bits per key (at least 1)
+  explicit BloomFilter(ulong, const Alloc& = Alloc()) noexcept;
+
+  /* ************************************************************************ */
+
+  // Copy constructor and assignment: Copy the bits and the statistics
+  BloomFilter(const BloomFilter&) = default;
+  BloomFilter& operator=(const BloomFilter&) = default;
+
+  // Move constructor: Takes over the blocks, leaving the other filter unbuilt
+  BloomFilter(BloomFilter&&) noexcept;
+
+  // Move assignment: Exchanges the filters (only noexcept if the blocks can change hands)
+  BloomFilter& operator=(BloomFilter&&) noexcept(BlockTraits::propagate_on_container_move_assignment::value || BlockTraits::is_always_equal::value);
+
+  /* ************************************************************************ */
+
+  // Building
+
+  void Build(const TraversableContainer<Data>&); // Sizes the blocks for the container and adds its elements
+  void Add(const Data&) noexcept; // Sets the element's bits (no-op while unbuilt)
+  void Invalidate() noexcept; // Marks the filter unbuilt; the blocks are kept for the next build
+
+  /* ************************************************************************ */
+
+  // Queries
+
+  bool Built() const noexcept; // True once built and until invalidated
+  bool Fresh(ulong) const noexcept; // True if built, within the planned keys, and the given live count is at least half the keys added
+  bool MayContain(const Data&) const noexcept; // False only for elements not added since the last build (true while unbuilt)
+
+  // Rejects: Negated MayContain, counted in the statistics
+  bool Rejects(const Data&) noexcept;
+
+  // Missed: Counts a lookup that passed the filter and found nothing
+  void Missed() noexcept;
+
+  /* ************************************************************************ */
+
+  // Configuration and statistics
+
+  ulong BitsPerKey() const noexcept;
+  ulong Probes() const noexcept; // Bits set per key
+  ulong Bits() const noexcept; // Size of the bit array (0 until built)
+
+  const BloomStats& Stats() const noexcept;
+  void ResetStats() noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "bloom.cpp"
+
+#endif
@@ -27,16 +27,20 @@ namespace lasd {
 
 // Default constructor: Creates empty heap with default vector capacity
 // Initializes underlying vector storage for immediate heap operations
-template <typename Data>
-HeapVec<Data>::HeapVec() : SortableVector<Data>() {
+template <typename Data, typename Alloc, typename Compare>
+HeapVec<Data, Alloc, Compare>::HeapVec() : SortableVector<Data, Alloc>() {
   // Inherits vector's default constructor - no heap property to establish yet
 }
 
+// Allocator constructor: Creates empty heap drawing storage from the given allocator
+template <typename Data, typename Alloc, typename Compare>
+HeapVec<Data, Alloc, Compare>::HeapVec(const Alloc& allocator) noexcept : SortableVector<Data, Alloc>(allocator) {}
+
 // Capacity constructor: Creates heap with specified initial capacity
 // Optimizes performance when expected heap size is known in advance
 // Does not establish heap property as no elements are present yet
-template <typename Data>
-HeapVec<Data>::HeapVec(const ulong newSize) : SortableVector<Data>(newSize) {
+template <typename Data, typename Alloc, typename Compare>
+HeapVec<Data, Alloc, Compare>::HeapVec(const ulong newSize, const Alloc& allocator) : SortableVector<Data, Alloc>(newSize, allocator) {
   // Underlying vector initialized with specified capacity
   // Heap property will be established when elements are added
 }
@@ -44,8 +48,8 @@ HeapVec<Data>::HeapVec(const ulong newSize) : SortableVector<Data>(newSize) {
 // Container copy constructor: Creates heap from any traversable container
 // Copies all elements from source container and establishes heap property
 // Time complexity: O(n) for copying + O(n) for heapify = O(n) total
-template <typename Data>
-HeapVec<Data>::HeapVec(const TraversableContainer<Data>& container) : SortableVector<Data>(container) {
+template <typename Data, typename Alloc, typename Compare>
+HeapVec<Data, Alloc, Compare>::HeapVec(const TraversableContainer<Data>& container, const Alloc& allocator) : SortableVector<Data, Alloc>(container, allocator) {
   // Elements copied via vector constructor, now establish heap property
   Heapify(); // O(n) bottom-up heapification more efficient than n insertions
 }
@@ -53,8 +57,8 @@ HeapVec<Data>::HeapVec(const TraversableContainer<Data>& container) : SortableVe
 // Container move constructor: Creates heap from mappable container using move semantics
 // Moves elements from source container (emptying it) and establishes heap property
 // More efficient for expensive-to-copy types, optimal resource utilization
-template <typename Data>
-HeapVec<Data>::HeapVec(MappableContainer<Data>&& container) : SortableVector<Data>(std::move(container)) {
+template <typename Data, typename Alloc, typename Compare>
+HeapVec<Data, Alloc, Compare>::HeapVec(MappableContainer<Data>&& container, const Alloc& allocator) : SortableVector<Data, Alloc>(std::move(container), allocator) {
   // Elements moved via vector constructor, now establish heap property
   Heapify(); // Required since moved elements may not satisfy heap property
 }
@@ -62,8 +66,8 @@ HeapVec<Data>::HeapVec(MappableContainer<Data>&& container) : SortableVector<Dat
 // Copy constructor: Deep copy of another heap preserving heap structure
 // No heapify needed as source heap already satisfies heap property
 // Efficient copy that maintains heap invariants without reorganization
-template <typename Data>
-HeapVec<Data>::HeapVec(const HeapVec<Data>& other) : SortableVector<Data>(other) {
+template <typename Data, typename Alloc, typename Compare>
+HeapVec<Data, Alloc, Compare>::HeapVec(const HeapVec<Data, Alloc, Compare>& other) : SortableVector<Data, Alloc>(other) {
   // Vector copy constructor handles element duplication
   // Heap property preserved since source is already a valid heap
 }
@@ -71,8 +75,8 @@ HeapVec<Data>::HeapVec(const HeapVec<Data>& other) : SortableVector<Data>(other)
 // Move constructor: Efficiently transfers ownership of heap resources
 // Optimal performance with no data copying, maintains heap property
 // Source object left in valid but unspecified state
-template <typename Data>
-HeapVec<Data>::HeapVec(HeapVec<Data>&& other) noexcept : SortableVector<Data>(std::move(other)) {
+template <typename Data, typename Alloc, typename Compare>
+HeapVec<Data, Alloc, Compare>::HeapVec(HeapVec<Data, Alloc, Compare>&& other) noexcept : SortableVector<Data, Alloc>(std::move(other)) {
   // Vector move constructor handles resource transfer
   // Heap property preserved since source was a valid heap
 }
@@ -84,18 +88,18 @@ HeapVec<Data>::HeapVec(HeapVec<Data>&& other) noexcept : SortableVector<Data>(st
 // Copy assignment: Replace current heap with deep copy of another heap
 // Handles self-assignment safely and maintains heap property
 // No heapify needed as source heap structure is preserved
-template <typename Data>
-HeapVec<Data>& HeapVec<Data>::operator=(const HeapVec<Data>& other) {
-  SortableVector<Data>::operator=(other); // Delegate to vector copy assignment
+template <typename Data, typename Alloc, typename Compare>
+HeapVec<Data, Alloc, Compare>& HeapVec<Data, Alloc, Compare>::operator=(const HeapVec<Data, Alloc, Compare>& other) {
+  SortableVector<Data, Alloc>::operator=(other); // Delegate to vector copy assignment
   return *this; // Heap property maintained through vector copy
 }
 
 // Move assignment: Efficiently replace current heap using move semantics
 // Provides strong exception safety and optimal performance
 // Maintains heap property while avoiding expensive copy operations
-template <typename Data>
-HeapVec<Data>& HeapVec<Data>::operator=(HeapVec<Data>&& other) noexcept {
-  SortableVector<Data>::operator=(std::move(other)); // Delegate to vector move assignment
+template <typename Data, typename Alloc, typename Compare>
+HeapVec<Data, Alloc, Compare>& HeapVec<Data, Alloc, Compare>::operator=(HeapVec<Data, Alloc, Compare>&& other) noexcept(SortableVector<Data, Alloc>::NothrowMoveAssign) {
+  SortableVector<Data, Alloc>::operator=(std::move(other)); // Delegate to vector move assignment
   return *this; // Heap property maintained through efficient resource transfer
 }
 
@@ -106,15 +110,15 @@ HeapVec<Data>& HeapVec<Data>::operator=(HeapVec<Data>&& other) noexcept {
 // Equality operator: Compares heap contents for exact structural match
 // Two heaps are equal if they contain same elements in same positions
 // Note: Different heap arrangements of same elements are considered different
-template <typename Data>
-bool HeapVec<Data>::operator==(const HeapVec<Data>& other) const noexcept {
-  return SortableVector<Data>::operator==(other); // Delegate to vector comparison
+template <typename Data, typename Alloc, typename Compare>
+bool HeapVec<Data, Alloc, Compare>::operator==(const HeapVec<Data, Alloc, Compare>& other) const noexcept {
+  return SortableVector<Data, Alloc>::operator==(other); // Delegate to vector comparison
 }
 
 // Inequality operator: Logical negation of equality comparison
 // Returns true if heaps differ in size or element arrangement
-template <typename Data>
-bool HeapVec<Data>::operator!=(const HeapVec<Data>& other) const noexcept {
+template <typename Data, typename Alloc, typename Compare>
+bool HeapVec<Data, Alloc, Compare>::operator!=(const HeapVec<Data, Alloc, Compare>& other) const noexcept {
   return !(*this == other); // Efficient negation of equality test
 }
 
@@ -126,19 +130,19 @@ bool HeapVec<Data>::operator!=(const HeapVec<Data>& other) const noexcept {
 // Checks that every parent satisfies ordering constraint with its children
 // Returns true if all parent-child relationships maintain heap ordering
 // Time complexity: O(n) - examines all internal nodes in the heap
-template <typename Data>
-bool HeapVec<Data>::IsHeap() const noexcept {
+template <typename Data, typename Alloc, typename Compare>
+bool HeapVec<Data, Alloc, Compare>::IsHeap() const noexcept {
   // Iterate through all nodes that have at least one child
   for (ulong i = 0; i < size; ++i) {
     // Check left child relationship if it exists
     if (HasLeftChild(i)) {
-      if (Elements[i] < Elements[GetLeftChild(i)]) {
+      if (order.Less(Elements[i], Elements[GetLeftChild(i)])) {
         return false; // Heap property violated: parent < left child
       }
     }
     // Check right child relationship if it exists
     if (HasRightChild(i)) {
-      if (Elements[i] < Elements[GetRightChild(i)]) {
+      if (order.Less(Elements[i], Elements[GetRightChild(i)])) {
         return false; // Heap property violated: parent < right child
       }
     }
@@ -150,8 +154,8 @@ bool HeapVec<Data>::IsHeap() const noexcept {
 // Converts arbitrary array into valid heap structure efficiently
 // More efficient than individual insertions: O(n) vs O(n log n)
 // Uses Floyd's heap construction algorithm
-template <typename Data>
-void HeapVec<Data>::Heapify() {
+template <typename Data, typename Alloc, typename Compare>
+void HeapVec<Data, Alloc, Compare>::Heapify() {
   // Build heap from bottom up, starting from the last non-leaf node
   if (size > 1) {
     // Last non-leaf node is at index (size/2 - 1)
@@ -171,8 +175,8 @@ void HeapVec<Data>::Heapify() {
 // Converts heap to sorted array, destroying heap property in the process
 // Time complexity: O(n log n) - optimal comparison-based sorting algorithm
 // Space complexity: O(1) - sorts in-place using existing storage
-template <typename Data>
-void HeapVec<Data>::Sort() {
+template <typename Data, typename Alloc, typename Compare>
+void HeapVec<Data, Alloc, Compare>::Sort() {
   // HeapSort algorithm: extract maximum elements repeatedly
   if (size > 1) {
     // Phase 1: Ensure we have a valid max-heap
@@ -194,11 +198,11 @@ void HeapVec<Data>::Sort() {
         ulong rightChild = GetRightChild(current);
         
         // Find largest among current node and its children
-        if (leftChild < heapSize && Elements[leftChild] > Elements[largest]) {
+        if (leftChild < heapSize && order.Less(Elements[largest], Elements[leftChild])) {
           largest = leftChild;
         }
         
-        if (rightChild < heapSize && Elements[rightChild] > Elements[largest]) {
+        if (rightChild < heapSize && order.Less(Elements[largest], Elements[rightChild])) {
           largest = rightChild;
         }
         
@@ -223,14 +227,14 @@ void HeapVec<Data>::Sort() {
 // Used after insertion to maintain heap ordering from leaf to root
 // Continues until heap property is satisfied or root is reached
 // Time complexity: O(log n) - maximum tree height traversal
-template <typename Data>
-void HeapVec<Data>::HeapifyUp(ulong index) {
+template <typename Data, typename Alloc, typename Compare>
+void HeapVec<Data, Alloc, Compare>::HeapifyUp(ulong index) {
   // Move element up the tree until heap property is satisfied
   while (index > 0) {
     ulong parentIndex = GetParent(index);
     
     // Check if heap property is violated (child > parent in max-heap)
-    if (Elements[index] > Elements[parentIndex]) {
+    if (order.Less(Elements[parentIndex], Elements[index])) {
       std::swap(Elements[index], Elements[parentIndex]);
       index = parentIndex; // Continue checking upward
     } else {
@@ -243,20 +247,20 @@ void HeapVec<Data>::HeapifyUp(ulong index) {
 // Used after root removal to maintain heap ordering from root to leaves
 // Continues until heap property is satisfied or leaf level is reached
 // Time complexity: O(log n) - maximum tree height traversal
-template <typename Data>
-void HeapVec<Data>::HeapifyDown(ulong index) {
+template <typename Data, typename Alloc, typename Compare>
+void HeapVec<Data, Alloc, Compare>::HeapifyDown(ulong index) {
   // Move element down the tree until heap property is satisfied
   while (HasLeftChild(index)) {
     // Find the largest child to potentially swap with
     ulong largestChild = GetLeftChild(index);
     
     // Check if right child exists and is larger than left child
-    if (HasRightChild(index) && Elements[GetRightChild(index)] > Elements[largestChild]) {
+    if (HasRightChild(index) && order.Less(Elements[largestChild], Elements[GetRightChild(index)])) {
       largestChild = GetRightChild(index);
     }
     
     // Check if heap property is already satisfied
-    if (Elements[index] >= Elements[largestChild]) {
+    if (!order.Less(Elements[index], Elements[largestChild])) {
       break; // Parent >= largest child, heap property satisfied
     }
     
@@ -272,24 +276,24 @@ void HeapVec<Data>::HeapifyDown(ulong index) {
 // GetParent: Calculates parent index for given node position
 // Uses the fundamental heap property: parent(i) = (i-1)/2
 // Time complexity: O(1) - simple integer division
-template <typename Data>
-ulong HeapVec<Data>::GetParent(ulong index) const noexcept {
+template <typename Data, typename Alloc, typename Compare>
+ulong HeapVec<Data, Alloc, Compare>::GetParent(ulong index) const noexcept {
   return (index - 1) / 2; // Standard binary heap parent formula
 }
 
 // GetLeftChild: Calculates left child index for given parent position
 // Uses the fundamental heap property: left_child(i) = 2*i + 1
 // Time complexity: O(1) - simple arithmetic operation
-template <typename Data>
-ulong HeapVec<Data>::GetLeftChild(ulong index) const noexcept {
+template <typename Data, typename Alloc, typename Compare>
+ulong HeapVec<Data, Alloc, Compare>::GetLeftChild(ulong index) const noexcept {
   return (2 * index) + 1; // Standard binary heap left child formula
 }
 
 // GetRightChild: Calculates right child index for given parent position
 // Uses the fundamental heap property: right_child(i) = 2*i + 2
 // Time complexity: O(1) - simple arithmetic operation
-template <typename Data>
-ulong HeapVec<Data>::GetRightChild(ulong index) const noexcept {
+template <typename Data, typename Alloc, typename Compare>
+ulong HeapVec<Data, Alloc, Compare>::GetRightChild(ulong index) const noexcept {
   return (2 * index) + 2; // Standard binary heap right child formula
 }
 
@@ -299,32 +303,19 @@ ulong HeapVec<Data>::GetRightChild(ulong index) const noexcept {
 // HasLeftChild: Checks if node has valid left child within heap bounds
 // Prevents array access violations during heap traversal operations
 // Time complexity: O(1) - simple index comparison with heap size
-template <typename Data>
-bool HeapVec<Data>::HasLeftChild(ulong index) const noexcept {
+template <typename Data, typename Alloc, typename Compare>
+bool HeapVec<Data, Alloc, Compare>::HasLeftChild(ulong index) const noexcept {
   return GetLeftChild(index) < size; // Left child index must be within bounds
 }
 
 // HasRightChild: Checks if node has valid right child within heap bounds
 // Essential for safe binary tree navigation and heap maintenance algorithms
 // Time complexity: O(1) - simple index comparison with heap size
-template <typename Data>
-bool HeapVec<Data>::HasRightChild(ulong index) const noexcept {
+template <typename Data, typename Alloc, typename Compare>
+bool HeapVec<Data, Alloc, Compare>::HasRightChild(ulong index) const noexcept {
   return GetRightChild(index) < size; // Right child index must be within bounds
 }
 
-// OPTIMIZED SWAPPING OPERATION
-
-// SwapAt: Efficiently swaps elements at two positions using pre-fetched values
-// Override of SortableLinearContainer method optimized for heap operations
-// Reduces data movement by using already-fetched values from calling context
-// Used internally by heapify algorithms to minimize memory accesses
-template <typename Data>
-void HeapVec<Data>::SwapAt(ulong i, ulong j, const Data& temp_i, const Data& temp_j) {
-  // Direct assignment using pre-fetched values (more efficient than std::swap)
-  this->Elements[i] = temp_j; // Place j's value at position i
-  this->Elements[j] = temp_i; // Place i's value at position j
-}
-
 /* ************************************************************************** */
 
 }
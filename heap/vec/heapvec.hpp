@@ -30,6 +30,7 @@
 /* ************************************************************************** */
 
 #include "../heap.hpp"
+#include "../../container/order.hpp"
 #include "../../vector/vector.hpp"
 
 /* ************************************************************************** */
@@ -51,11 +52,14 @@ namespace lasd {
  * 
  * Inheritance Structure:
  * - Heap<Data>: Provides abstract heap interface and operations
- * - SortableVector<Data>: Supplies dynamic array storage and sorting capabilities
+ * - SortableVector<Data, Alloc>: Supplies dynamic array storage and sorting capabilities
  * 
  * The dual inheritance allows HeapVec to function both as a heap for priority-based
  * operations and as a sortable container for efficient sorting algorithms.
  * 
+ * The heap is a max-heap with respect to the Compare policy (std::less by default);
+ * std::greater gives a min-heap, and Sort() then orders the elements descending.
+ * 
  * Performance Characteristics:
  * - Space Complexity: O(n) with dynamic resizing
  * - Access Root: O(1) - always at index 0
@@ -65,9 +69,9 @@ namespace lasd {
  * - Sort: O(n log n) - heapsort algorithm
  */
 
-template <typename Data>
+template <typename Data, typename Alloc = std::allocator<Data>, typename Compare = std::less<Data>>
 class HeapVec : virtual public Heap<Data>,
-                public SortableVector<Data> {
+                public SortableVector<Data, Alloc> {
 
 private:
   // No additional private members - uses inherited vector storage
@@ -78,7 +82,11 @@ protected:
   // Provides access to base class members for heap operations
   
   using Container::size;                    // Current number of elements in heap
-  using SortableVector<Data>::Elements;     // Dynamic array storing heap elements
+  using SortableVector<Data, Alloc>::Elements;     // Dynamic array storing heap elements
+
+  // Comparator policy: a max-heap with respect to Compare, so the root is the element
+  // no other precedes (the largest for std::less, the smallest for std::greater)
+  [[no_unique_address]] Order<Data, Compare> order;
 
 public:
 
@@ -88,6 +96,9 @@ public:
   // Initializes underlying vector storage for immediate use
   HeapVec();
 
+  // Allocator constructor: Creates an empty heap using the given allocator
+  explicit HeapVec(const Alloc&) noexcept;
+
   /* ************************************************************************ */
 
   // SPECIALIZED CONSTRUCTORS
@@ -96,17 +107,17 @@ public:
   // Capacity constructor: Creates heap with specified initial capacity
   // Useful for performance optimization when expected size is known
   // Parameters: initial capacity for underlying vector storage
-  explicit HeapVec(const ulong);
+  explicit HeapVec(const ulong, const Alloc& = Alloc());
   
   // Container copy constructor: Builds heap from any traversable container
   // Copies all elements and applies heapify to establish heap property
   // Time complexity: O(n) for copy + O(n) for heapify = O(n)
-  HeapVec(const TraversableContainer<Data>&);
+  HeapVec(const TraversableContainer<Data>&, const Alloc& = Alloc());
   
   // Container move constructor: Builds heap from mappable container using move semantics
   // More efficient for expensive-to-copy types, empties source container
   // Time complexity: O(n) for move + O(n) for heapify = O(n)
-  HeapVec(MappableContainer<Data>&&);
+  HeapVec(MappableContainer<Data>&&, const Alloc& = Alloc());
 
   /* ************************************************************************ */
 
@@ -138,7 +149,7 @@ public:
 
   // Move assignment: Efficiently replace current heap using move semantics
   // Provides strong exception safety and optimal performance
-  HeapVec& operator=(HeapVec&&) noexcept;
+  HeapVec& operator=(HeapVec&&) noexcept(SortableVector<Data, Alloc>::NothrowMoveAssign);
 
   /* ************************************************************************ */
 
@@ -185,12 +196,6 @@ protected:
   // HEAP MAINTENANCE OPERATIONS
   // Internal algorithms for maintaining heap property during modifications
 
-  // SwapAt: Efficiently swaps elements at two positions with value caching
-  // Override of SortableLinearContainer method optimized for heap operations
-  // Used internally by heapify algorithms to minimize data movement
-  // Parameters: two indices and their current values for optimized swapping
-  void SwapAt(ulong, ulong, const Data&, const Data&) override;
-
   // HEAP NAVIGATION AND MAINTENANCE ALGORITHMS
   // Core algorithms for heap property maintenance and tree navigation
 
@@ -1,6 +1,7 @@
 #include <type_traits>
 #include <stdexcept>
 #include <string>
+#include <memory>
 
 namespace lasd {
 
@@ -10,22 +11,98 @@ namespace lasd {
 
 // Clone() - Creates a deep copy of this node with optional next pointer
 // This is used for implementing list copy operations
-template <typename Data>
-typename List<Data>::Node* List<Data>::Node::Clone(Node* next) {
-  // Create a new node with the same element data
-  Node* temp = new Node(element);
+template <typename Data, typename Alloc>
+typename List<Data, Alloc>::Node* List<Data, Alloc>::Node::Clone(List& owner, Node* next) const {
+  Node* temp = owner.NewNode(element); // Copy the element into a node of the owner's pool
   temp->next = next; // Set the next pointer to the provided value
   return temp;
 }
 
+/* ************************************************************************** */
+// Node Pool
+/* ************************************************************************** */
+
+// NewNode() - Takes a free slot (or carves a new one) and constructs the node in it
+// The slot goes back to the free list if the element constructor throws
+template <typename Data, typename Alloc>
+template <typename... Args>
+typename List<Data, Alloc>::Node* List<Data, Alloc>::NewNode(Args&&... args) {
+  Node* node;
+  if (freeSlots != nullptr) {
+    node = reinterpret_cast<Node*>(freeSlots);
+    freeSlots = freeSlots->next;
+  } else {
+    if (carveLeft == 0) {
+      GrowPool();
+    }
+    node = carveNext++;
+    carveLeft--;
+  }
+  try {
+    NodeTraits::construct(alloc, node, std::forward<Args>(args)...);
+  } catch (...) {
+    freeSlots = ::new (static_cast<void*>(node)) FreeSlot{freeSlots};
+    throw;
+  }
+  return node;
+}
+
+// DeleteNode() - Destroys a node and pushes its slot on the free list
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::DeleteNode(Node* node) noexcept {
+  NodeTraits::destroy(alloc, node);
+  freeSlots = ::new (static_cast<void*>(node)) FreeSlot{freeSlots};
+}
+
+// GrowPool() - Allocates the next slab; slabs double in size up to MaxSlabNodes
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::GrowPool() {
+  ulong count = nextSlabSize;
+  Node* slab = NodeTraits::allocate(alloc, count + 1);
+  slabs = ::new (static_cast<void*>(slab)) SlabHeader{slabs, count};
+  carveNext = slab + 1;
+  carveLeft = count;
+  if (nextSlabSize < MaxSlabNodes) {
+    nextSlabSize *= 2;
+  }
+}
+
+// ReleasePool() - Returns all the slabs to the allocator and resets the pool
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::ReleasePool() noexcept {
+  while (slabs != nullptr) {
+    SlabHeader* prev = slabs->prev;
+    NodeTraits::deallocate(alloc, reinterpret_cast<Node*>(slabs), slabs->count + 1);
+    slabs = prev;
+  }
+  freeSlots = nullptr;
+  carveNext = nullptr;
+  carveLeft = 0;
+  nextSlabSize = MinSlabNodes;
+}
+
+// SwapPool() - Exchanges the slabs and free lists (the allocators are handled by the caller)
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::SwapPool(List& other) noexcept {
+  std::swap(slabs, other.slabs);
+  std::swap(freeSlots, other.freeSlots);
+  std::swap(carveNext, other.carveNext);
+  std::swap(carveLeft, other.carveLeft);
+  std::swap(nextSlabSize, other.nextSlabSize);
+}
+
 /* ************************************************************************** */
 // List Constructors Implementation
 /* ************************************************************************** */
 
+// Constructor with Allocator - Creates an empty list bound to the given allocator
+template <typename Data, typename Alloc>
+List<Data, Alloc>::List(const Alloc& allocator) noexcept : alloc(allocator) {}
+
 // Constructor from TraversableContainer - Copy Semantics
 // Creates a new list by copying all elements from any traversable container
-template <typename Data>
-List<Data>::List(const TraversableContainer<Data>& container) {
+template <typename Data, typename Alloc>
+List<Data, Alloc>::List(const TraversableContainer<Data>& container, const Alloc& allocator) : alloc(allocator) {
   // Use the container's traverse function to visit each element
   // and add it to the back of this list
   container.Traverse(
@@ -37,8 +114,8 @@ List<Data>::List(const TraversableContainer<Data>& container) {
 
 // Constructor from MappableContainer - Move Semantics
 // Creates a new list by moving elements from a mappable container
-template <typename Data>
-List<Data>::List(MappableContainer<Data>&& container) {
+template <typename Data, typename Alloc>
+List<Data, Alloc>::List(MappableContainer<Data>&& container, const Alloc& allocator) : alloc(allocator) {
   // Use the container's map function to access each element for moving
   container.Map(
     [this](Data& dat) {
@@ -56,8 +133,8 @@ List<Data>::List(MappableContainer<Data>&& container) {
 
 // Copy Constructor - Creates a deep copy of another list
 // All nodes and their data are copied, maintaining the same order
-template <typename Data>
-List<Data>::List(const List& other) {
+template <typename Data, typename Alloc>
+List<Data, Alloc>::List(const List& other) : alloc(NodeTraits::select_on_container_copy_construction(other.alloc)) {
   // Only proceed if the other list has elements
   if(other.size > 0) {
     // Traverse the other list manually and copy all elements
@@ -71,12 +148,13 @@ List<Data>::List(const List& other) {
 
 // Move Constructor - Transfers ownership from another list
 // This is very efficient as it just swaps pointers, no copying involved
-template <typename Data>
-List<Data>::List(List&& other) noexcept {
+template <typename Data, typename Alloc>
+List<Data, Alloc>::List(List&& other) noexcept : alloc(other.alloc) {
   // Transfer ownership of all resources using swap
   std::swap(head, other.head);   // Transfer head pointer
   std::swap(tail, other.tail);   // Transfer tail pointer
   std::swap(size, other.size);   // Transfer size count
+  SwapPool(other);               // The nodes live in the pool, so it moves with them
   // The other list is left in a valid empty state
 }
 
@@ -86,9 +164,10 @@ List<Data>::List(List&& other) noexcept {
 
 // Destructor - Properly deallocates all nodes in the list
 // Uses Clear() to handle the deallocation process
-template <typename Data>
-List<Data>::~List() {
+template <typename Data, typename Alloc>
+List<Data, Alloc>::~List() {
   Clear(); // Delegate to Clear() which handles proper node deallocation
+  ReleasePool(); // Then give the slabs back to the allocator
 }
 
 /* ************************************************************************** */
@@ -96,12 +175,20 @@ List<Data>::~List() {
 /* ************************************************************************** */
 
 // Copy Assignment - Replaces current content with a deep copy of another list
-template <typename Data>
-List<Data>& List<Data>::operator=(const List& other) {
+template <typename Data, typename Alloc>
+List<Data, Alloc>& List<Data, Alloc>::operator=(const List& other) {
   // Protect against self-assignment which would be destructive
   if(this != &other) {
     Clear(); // First clear current contents to avoid memory leaks
 
+    // Adopt the other allocator only after our slabs went back to the old one
+    if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+      if (alloc != other.alloc) {
+        ReleasePool();
+      }
+      alloc = other.alloc;
+    }
+
     // Copy all elements from the other list in order
     Node* curr = other.head;
     while(curr != nullptr) {
@@ -114,14 +201,30 @@ List<Data>& List<Data>::operator=(const List& other) {
 
 // Move Assignment - Efficiently transfers resources from another list
 // Avoids the expensive copy-and-delete cycle by simply swapping pointers
-template <typename Data>
-List<Data>& List<Data>::operator=(List&& other) noexcept {
+template <typename Data, typename Alloc>
+List<Data, Alloc>& List<Data, Alloc>::operator=(List&& other) noexcept(NothrowMoveAssign) {
   // Protect against self-assignment
   if(this != &other) {
+    // Nodes can only change hands when the allocators propagate or compare equal;
+    // otherwise the elements are moved one by one into nodes from our allocator
+    if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+      std::swap(alloc, other.alloc);
+    } else if constexpr (!NodeTraits::is_always_equal::value) {
+      if (alloc != other.alloc) {
+        Clear();
+        for (Node* curr = other.head; curr != nullptr; curr = curr->next) {
+          InsertAtBack(std::move(curr->element));
+        }
+        other.Clear();
+        return *this;
+      }
+    }
+
     // Swap all member variables - this transfers ownership efficiently
     std::swap(head, other.head);
     std::swap(tail, other.tail);
     std::swap(size, other.size);
+    SwapPool(other);
     // The 'other' list will be destroyed with our old data
   }
   return *this; // Return reference for chaining
@@ -133,8 +236,8 @@ List<Data>& List<Data>::operator=(List&& other) noexcept {
 // These operators compare the structural content of two lists
 
 // Equality operator - Returns true if both lists contain the same elements in the same order
-template <typename Data>
-bool List<Data>::operator==(const List& other) const noexcept {
+template <typename Data, typename Alloc>
+bool List<Data, Alloc>::operator==(const List& other) const noexcept {
   // Quick check: if sizes differ, lists cannot be equal
   if(size != other.size)
     return false;
@@ -160,8 +263,8 @@ bool List<Data>::operator==(const List& other) const noexcept {
 }
 
 // Inequality operator - Returns true if lists differ in size or content
-template <typename Data>
-bool List<Data>::operator!=(const List& other) const noexcept {
+template <typename Data, typename Alloc>
+bool List<Data, Alloc>::operator!=(const List& other) const noexcept {
   return !(*this == other); // Simply negate the equality result
 }
 
@@ -171,10 +274,10 @@ bool List<Data>::operator!=(const List& other) const noexcept {
 // These functions provide efficient list-specific operations for front and back insertion/removal
 
 // InsertAtFront - Copy version: Creates a copy of the data and adds it to the front
-template <typename Data>
-void List<Data>::InsertAtFront(const Data& data) {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::InsertAtFront(const Data& data) {
   // Create new node with copied data
-  Node* newNode = new Node(data);
+  Node* newNode = NewNode(data);
   
   // Link new node to current head (could be nullptr for empty list)
   newNode->next = head;
@@ -188,10 +291,10 @@ void List<Data>::InsertAtFront(const Data& data) {
 }
 
 // InsertAtFront - Move version: Transfers ownership of data and adds it to the front
-template <typename Data>
-void List<Data>::InsertAtFront(Data&& data) {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::InsertAtFront(Data&& data) {
   // Create new node with moved data (avoids unnecessary copy)
-  Node* newNode = new Node(std::move(data));
+  Node* newNode = NewNode(std::move(data));
   
   // Link new node to current head
   newNode->next = head;
@@ -206,8 +309,8 @@ void List<Data>::InsertAtFront(Data&& data) {
 
 // RemoveFromFront: Removes the first element from the list
 // Throws exception if the list is empty
-template <typename Data>
-void List<Data>::RemoveFromFront() {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::RemoveFromFront() {
   if(head == nullptr)
     throw std::length_error("Access to an empty list");
     
@@ -219,15 +322,15 @@ void List<Data>::RemoveFromFront() {
     tail = nullptr;
     
   temp->next = nullptr; // Prevent cascade deletion
-  delete temp; // Free the removed node
+  DeleteNode(temp); // Free the removed node
   
   size--; // Update size counter
 }
 
 // FrontNRemove: Returns the front element and removes it from the list
 // Combines Front() and RemoveFromFront() operations efficiently
-template <typename Data>
-Data List<Data>::FrontNRemove() {
+template <typename Data, typename Alloc>
+Data List<Data, Alloc>::FrontNRemove() {
   if(head == nullptr)
     throw std::length_error("Access to an empty list");
     
@@ -243,7 +346,7 @@ Data List<Data>::FrontNRemove() {
     tail = nullptr;
     
   temp->next = nullptr; // Prevent cascade deletion
-  delete temp; // Free the removed node
+  DeleteNode(temp); // Free the removed node
   
   size--; // Update size counter
   return result; // Return the removed element
@@ -251,10 +354,10 @@ Data List<Data>::FrontNRemove() {
 
 // InsertAtBack - Copy version: Creates a copy of the data and adds it to the back
 // More efficient than InsertAtFront for maintaining insertion order
-template <typename Data>
-void List<Data>::InsertAtBack(const Data& data) {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::InsertAtBack(const Data& data) {
   // Create new node with copied data
-  Node* newNode = new Node(data);
+  Node* newNode = NewNode(data);
   
   // Handle empty list case
   if(head == nullptr) {
@@ -270,10 +373,10 @@ void List<Data>::InsertAtBack(const Data& data) {
 }
 
 // InsertAtBack - Move version: Transfers ownership of data and adds it to the back
-template <typename Data>
-void List<Data>::InsertAtBack(Data&& data) {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::InsertAtBack(Data&& data) {
   // Create new node with moved data (avoids unnecessary copy)
-  Node* newNode = new Node(std::move(data));
+  Node* newNode = NewNode(std::move(data));
   
   // Handle empty list case
   if(head == nullptr) {
@@ -290,14 +393,14 @@ void List<Data>::InsertAtBack(Data&& data) {
 
 // RemoveFromBack: Removes the last element from the list
 // Less efficient than RemoveFromFront due to need to traverse to find previous node
-template <typename Data>
-void List<Data>::RemoveFromBack() {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::RemoveFromBack() {
   if(head == nullptr)
     throw std::length_error("Access to an empty list");
     
   if(head == tail) {
     // Single element case - both head and tail point to same node
-    delete head;
+    DeleteNode(head);
     head = nullptr;
     tail = nullptr;
   } else {
@@ -308,7 +411,7 @@ void List<Data>::RemoveFromBack() {
     }
     
     // Remove tail and update pointers
-    delete tail;
+    DeleteNode(tail);
     tail = curr;
     tail->next = nullptr;
   }
@@ -318,8 +421,8 @@ void List<Data>::RemoveFromBack() {
 
 // BackNRemove: Returns the back element and removes it from the list
 // Combines Back() and RemoveFromBack() operations
-template <typename Data>
-Data List<Data>::BackNRemove() {
+template <typename Data, typename Alloc>
+Data List<Data, Alloc>::BackNRemove() {
   if(head == nullptr)
     throw std::length_error("Access to an empty list");
     
@@ -328,7 +431,7 @@ Data List<Data>::BackNRemove() {
   
   if(head == tail) {
     // Single element case
-    delete head;
+    DeleteNode(head);
     head = nullptr;
     tail = nullptr;
   } else {
@@ -339,7 +442,7 @@ Data List<Data>::BackNRemove() {
     }
     
     // Remove tail and update pointers
-    delete tail;
+    DeleteNode(tail);
     tail = curr;
     tail->next = nullptr;
   }
@@ -355,8 +458,8 @@ Data List<Data>::BackNRemove() {
 
 // Mutable access to element at index: Returns a reference that can be modified
 // Time complexity: O(n) due to sequential traversal from head
-template <typename Data>
-Data& List<Data>::operator[](ulong index) {
+template <typename Data, typename Alloc>
+Data& List<Data, Alloc>::operator[](ulong index) {
   if(index >= size)
     throw std::out_of_range("Access at index " + std::to_string(index) + " on list of size " + std::to_string(size));
     
@@ -369,8 +472,8 @@ Data& List<Data>::operator[](ulong index) {
 }
 
 // Mutable access to front element: Returns a reference to the first element
-template <typename Data>
-Data& List<Data>::Front() {
+template <typename Data, typename Alloc>
+Data& List<Data, Alloc>::Front() {
   if(head == nullptr)
     throw std::length_error("Access to an empty list");
     
@@ -378,8 +481,8 @@ Data& List<Data>::Front() {
 }
 
 // Mutable access to back element: Returns a reference to the last element
-template <typename Data>
-Data& List<Data>::Back() {
+template <typename Data, typename Alloc>
+Data& List<Data, Alloc>::Back() {
   if(tail == nullptr)
     throw std::length_error("Access to an empty list");
     
@@ -392,8 +495,8 @@ Data& List<Data>::Back() {
 // These provide immutable (read-only) access to list elements by position
 
 // Immutable access to element at index: Returns a const reference for read-only access
-template <typename Data>
-const Data& List<Data>::operator[](ulong index) const {
+template <typename Data, typename Alloc>
+const Data& List<Data, Alloc>::operator[](ulong index) const {
   if(index >= size)
     throw std::out_of_range("Access at index " + std::to_string(index) + " on list of size " + std::to_string(size));
     
@@ -406,8 +509,8 @@ const Data& List<Data>::operator[](ulong index) const {
 }
 
 // Immutable access to front element: Returns a const reference to the first element
-template <typename Data>
-const Data& List<Data>::Front() const {
+template <typename Data, typename Alloc>
+const Data& List<Data, Alloc>::Front() const {
   if(head == nullptr)
     throw std::length_error("Access to an empty list");
     
@@ -415,8 +518,8 @@ const Data& List<Data>::Front() const {
 }
 
 // Immutable access to back element: Returns a const reference to the last element
-template <typename Data>
-const Data& List<Data>::Back() const {
+template <typename Data, typename Alloc>
+const Data& List<Data, Alloc>::Back() const {
   if(tail == nullptr)
     throw std::length_error("Access to an empty list");
     
@@ -428,8 +531,8 @@ const Data& List<Data>::Back() const {
 // Specific member function (inherited from MappableContainer)
 // Provides the default mapping behavior using pre-order traversal
 
-template <typename Data>
-void List<Data>::Map(MapFun fun) {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::Map(MapFun fun) {
   PreOrderMap(fun); // Default to pre-order mapping (front to back)
 }
 
@@ -438,24 +541,24 @@ void List<Data>::Map(MapFun fun) {
 // Specific member function (inherited from PreOrderMappableContainer)
 // Applies a function to each element in order from front to back
 
-template <typename Data>
-void List<Data>::PreOrderMap(MapFun fun) {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::PreOrderMap(MapFun fun) {
   PreOrderMap(fun, head); // Start mapping from the head node
 }
 
 // Specific member function (inherited from PostOrderMappableContainer)
 // Applies a function to each element in reverse order (back to front)
 
-template <typename Data>
-void List<Data>::PostOrderMap(MapFun fun) {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::PostOrderMap(MapFun fun) {
   PostOrderMap(fun, head); // Start post-order mapping from head (recursively handles order)
 }
 
 // Specific member function (inherited from TraversableContainer)
 // Provides the default traversal behavior using pre-order traversal
 
-template <typename Data>
-void List<Data>::Traverse(TraverseFun fun) const {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::Traverse(TraverseFun fun) const {
   PreOrderTraverse(fun); // Default to pre-order traversal (front to back)
 }
 
@@ -464,34 +567,62 @@ void List<Data>::Traverse(TraverseFun fun) const {
 // Specific member function (inherited from PreOrderTraversableContainer)
 // Traverses elements from front to back, applying a read-only function to each
 
-template <typename Data>
-void List<Data>::PreOrderTraverse(TraverseFun fun) const {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::PreOrderTraverse(TraverseFun fun) const {
   PreOrderTraverse(fun, head); // Start traversal from the head node
 }
 
 // Specific member function (inherited from PostOrderTraversableContainer)
 // Traverses elements from back to front, applying a read-only function to each
 
-template <typename Data>
-void List<Data>::PostOrderTraverse(TraverseFun fun) const {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::PostOrderTraverse(TraverseFun fun) const {
   PostOrderTraverse(fun, head); // Start post-order traversal from head (recursively handles order)
 }
 
 /* ************************************************************************** */
 
+// Early-exit traversals (inherited from LinearContainer)
+
+template <typename Data, typename Alloc>
+bool List<Data, Alloc>::TraverseWhile(PredicateFun fun) const {
+  return PreOrderTraverseWhile(fun); // Default to pre-order (front to back)
+}
+
+template <typename Data, typename Alloc>
+bool List<Data, Alloc>::PreOrderTraverseWhile(PredicateFun fun) const {
+  for (const Node* curr = head; curr != nullptr; curr = curr->next) {
+    if (!fun(curr->element)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Data, typename Alloc>
+bool List<Data, Alloc>::PostOrderTraverseWhile(PredicateFun fun) const {
+  return PostOrderTraverseWhile(fun, head);
+}
+
+/* ************************************************************************** */
+
 // Specific member function (inherited from ClearableContainer)
 // Removes all elements from the list and frees associated memory
 
-template <typename Data>
-void List<Data>::Clear() {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::Clear() {
   if(head != nullptr) {
+    // Destroy the nodes and chain their slots in list order, so that the
+    // next inserts reuse them front to back (keeping traversal locality)
+    FreeSlot* rest = freeSlots;
     Node* curr = head;
     while(curr != nullptr) {
       Node* temp = curr;
       curr = curr->next;
-      temp->next = nullptr; // Detach to prevent cascade deletion issues
-      delete temp; // Free each node individually
+      NodeTraits::destroy(alloc, temp);
+      ::new (static_cast<void*>(temp)) FreeSlot{curr != nullptr ? reinterpret_cast<FreeSlot*>(curr) : rest};
     }
+    freeSlots = reinterpret_cast<FreeSlot*>(head);
     
     // Reset list to empty state
     head = nullptr;
@@ -507,8 +638,8 @@ void List<Data>::Clear() {
 
 // Insert - Copy version: Adds an element only if it doesn't already exist
 // Returns true if element was inserted, false if it already existed
-template <typename Data>
-bool List<Data>::Insert(const Data& data) {
+template <typename Data, typename Alloc>
+bool List<Data, Alloc>::Insert(const Data& data) {
   // Check if the element already exists in the list
   Node* curr = head;
   while(curr != nullptr) {
@@ -524,8 +655,8 @@ bool List<Data>::Insert(const Data& data) {
 
 // Insert - Move version: Adds an element only if it doesn't already exist
 // More efficient as it avoids copying when the element doesn't exist
-template <typename Data>
-bool List<Data>::Insert(Data&& data) {
+template <typename Data, typename Alloc>
+bool List<Data, Alloc>::Insert(Data&& data) {
   // Create a copy to compare (since we might move the original)
   Data temp = data;
   Node* curr = head;
@@ -542,8 +673,8 @@ bool List<Data>::Insert(Data&& data) {
 
 // Remove: Removes the first occurrence of the specified element
 // Returns true if element was found and removed, false otherwise
-template <typename Data>
-bool List<Data>::Remove(const Data& data) {
+template <typename Data, typename Alloc>
+bool List<Data, Alloc>::Remove(const Data& data) {
   if(head == nullptr)
     return false; // Empty list - nothing to remove
     
@@ -567,7 +698,7 @@ bool List<Data>::Remove(const Data& data) {
         tail = prev;
         
       curr->next = nullptr; // Prevent cascade deletion
-      delete curr;
+      DeleteNode(curr);
       size--;
       
       return true; // Successfully removed
@@ -582,8 +713,8 @@ bool List<Data>::Remove(const Data& data) {
 
 // InsertAll from TraversableContainer: Attempts to insert all elements from another container
 // Returns true only if ALL elements were successfully inserted (none were duplicates)
-template <typename Data>
-bool List<Data>::InsertAll(const TraversableContainer<Data>& container) {
+template <typename Data, typename Alloc>
+bool List<Data, Alloc>::InsertAll(const TraversableContainer<Data>& container) {
   bool allInserted = true;
   container.Traverse(
     [this, &allInserted](const Data& data) {
@@ -594,8 +725,8 @@ bool List<Data>::InsertAll(const TraversableContainer<Data>& container) {
 }
 
 // InsertAll from MappableContainer (move version): More efficient for movable elements
-template <typename Data>
-bool List<Data>::InsertAll(MappableContainer<Data>&& container) {
+template <typename Data, typename Alloc>
+bool List<Data, Alloc>::InsertAll(MappableContainer<Data>&& container) {
   bool allInserted = true;
   container.Map(
     [this, &allInserted](Data& data) {
@@ -607,8 +738,8 @@ bool List<Data>::InsertAll(MappableContainer<Data>&& container) {
 
 // RemoveAll: Removes all elements that exist in the given container
 // Returns true if at least one element was removed
-template <typename Data>
-bool List<Data>::RemoveAll(const TraversableContainer<Data>& container) {
+template <typename Data, typename Alloc>
+bool List<Data, Alloc>::RemoveAll(const TraversableContainer<Data>& container) {
   // Record initial size to detect if any removals occurred
   ulong initialSize = size;
   
@@ -625,8 +756,8 @@ bool List<Data>::RemoveAll(const TraversableContainer<Data>& container) {
 
 // InsertSome from TraversableContainer: Inserts elements that don't already exist
 // Returns true if at least one element was successfully inserted
-template <typename Data>
-bool List<Data>::InsertSome(const TraversableContainer<Data>& container) {
+template <typename Data, typename Alloc>
+bool List<Data, Alloc>::InsertSome(const TraversableContainer<Data>& container) {
   // Track whether any insertions succeeded
   bool inserted = false;
   
@@ -642,8 +773,8 @@ bool List<Data>::InsertSome(const TraversableContainer<Data>& container) {
 }
 
 // InsertSome from MappableContainer (move version): More efficient version
-template <typename Data>
-bool List<Data>::InsertSome(MappableContainer<Data>&& container) {
+template <typename Data, typename Alloc>
+bool List<Data, Alloc>::InsertSome(MappableContainer<Data>&& container) {
   // Track whether any insertions succeeded
   bool inserted = false;
   
@@ -660,8 +791,8 @@ bool List<Data>::InsertSome(MappableContainer<Data>&& container) {
 
 // RemoveSome: Removes elements that exist in both containers
 // Returns true if at least one element was successfully removed
-template <typename Data>
-bool List<Data>::RemoveSome(const TraversableContainer<Data>& container) {
+template <typename Data, typename Alloc>
+bool List<Data, Alloc>::RemoveSome(const TraversableContainer<Data>& container) {
   // Track whether any removals succeeded
   bool removed = false;
   
@@ -683,8 +814,8 @@ bool List<Data>::RemoveSome(const TraversableContainer<Data>& container) {
 
 // Protected auxiliary method for PreOrderMap: Applies function from front to back
 // Uses iterative approach for better performance and stack safety
-template <typename Data>
-void List<Data>::PreOrderMap(MapFun fun, Node* curr) {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::PreOrderMap(MapFun fun, Node* curr) {
   while(curr != nullptr) {
     fun(curr->element); // Apply function to current element
     curr = curr->next;   // Move to next node
@@ -693,8 +824,8 @@ void List<Data>::PreOrderMap(MapFun fun, Node* curr) {
 
 // Protected auxiliary method for PostOrderMap: Applies function from back to front
 // Uses recursive approach to achieve reverse order traversal
-template <typename Data>
-void List<Data>::PostOrderMap(MapFun fun, Node* curr) {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::PostOrderMap(MapFun fun, Node* curr) {
   if(curr != nullptr) {
     PostOrderMap(fun, curr->next); // Recursively process rest of list first
     fun(curr->element);            // Then apply function to current element
@@ -708,8 +839,8 @@ void List<Data>::PostOrderMap(MapFun fun, Node* curr) {
 
 // Protected auxiliary method for PreOrderTraverse: Traverses from front to back
 // Uses iterative approach for efficiency
-template <typename Data>
-void List<Data>::PreOrderTraverse(TraverseFun fun, const Node* curr) const {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::PreOrderTraverse(TraverseFun fun, const Node* curr) const {
   while(curr != nullptr) {
     fun(curr->element); // Apply const function to current element
     curr = curr->next;   // Move to next node
@@ -718,14 +849,212 @@ void List<Data>::PreOrderTraverse(TraverseFun fun, const Node* curr) const {
 
 // Protected auxiliary method for PostOrderTraverse: Traverses from back to front
 // Uses recursive approach to achieve reverse order
-template <typename Data>
-void List<Data>::PostOrderTraverse(TraverseFun fun, const Node* curr) const {
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::PostOrderTraverse(TraverseFun fun, const Node* curr) const {
   if(curr != nullptr) {
     PostOrderTraverse(fun, curr->next); // Recursively process rest of list first
     fun(curr->element);                 // Then apply const function to current element
   }
 }
 
+// Protected auxiliary method for PostOrderTraverseWhile: Like PostOrderTraverse, but
+// once the function returns false no further element is visited on the way back
+template <typename Data, typename Alloc>
+bool List<Data, Alloc>::PostOrderTraverseWhile(const PredicateFun& fun, const Node* curr) const {
+  if (curr == nullptr) {
+    return true;
+  }
+  return PostOrderTraverseWhile(fun, curr->next) && fun(curr->element);
+}
+
+/* ************************************************************************** */
+// Sorting
+/* ************************************************************************** */
+
+// Sort: Bottom-up merge sort on the node chain
+// Nodes are taken one at a time from the front and carried through a binary
+// counter of sorted runs (bins[k] holds a run of 2^k nodes), merging equal-sized
+// runs as they form; a final sweep merges the leftover runs. Runs in higher bins
+// always hold earlier nodes, so taking ties from them keeps the sort stable.
+// Extra space is a fixed array of 64 pointers, enough for any list size.
+// If a comparison throws, every run is linked back into the list (in an
+// unspecified order) before the exception is rethrown.
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::Sort() {
+  if (size < 2) {
+    return;
+  }
+
+  Node* bins[64] = {};
+  ulong used = 0;
+  Node* carry = nullptr;
+  Node* result = nullptr;
+  try {
+    while (head != nullptr) {
+      carry = head;
+      head = head->next;
+      carry->next = nullptr;
+
+      ulong bin = 0;
+      for (; bin < used && bins[bin] != nullptr; ++bin) {
+        Merge(bins[bin], carry);
+        carry = bins[bin];
+        bins[bin] = nullptr;
+      }
+      bins[bin] = carry;
+      carry = nullptr;
+      if (bin == used) {
+        ++used;
+      }
+    }
+
+    for (ulong bin = 0; bin < used; ++bin) {
+      if (bins[bin] != nullptr) {
+        Merge(bins[bin], result);
+        result = bins[bin];
+        bins[bin] = nullptr;
+      }
+    }
+  } catch (...) {
+    // Every node is on exactly one of these chains: relink them all
+    Node* relinked = nullptr;
+    Node** link = &relinked;
+    auto append = [&link](Node* chain) {
+      *link = chain;
+      while (*link != nullptr) {
+        link = &(*link)->next;
+      }
+    };
+    append(result);
+    for (ulong bin = 0; bin < used; ++bin) {
+      append(bins[bin]);
+    }
+    append(carry);
+    append(head);
+    head = relinked;
+    tail = relinked;
+    while (tail->next != nullptr) {
+      tail = tail->next;
+    }
+    throw;
+  }
+
+  head = result;
+  tail = result;
+  while (tail->next != nullptr) {
+    tail = tail->next;
+  }
+}
+
+// Merge: Links the nodes of 'second' into the sorted chain 'first', preferring 'first' on ties
+// On return 'first' holds the merged chain; if a comparison throws, it holds all the
+// nodes of both chains (merged prefix, then the rest of each) and 'second' is null
+template <typename Data, typename Alloc>
+void List<Data, Alloc>::Merge(Node*& first, Node*& second) {
+  Node* merged = nullptr;
+  Node** link = &merged;
+  try {
+    while (first != nullptr && second != nullptr) {
+      if (second->element < first->element) {
+        *link = second;
+        second = second->next;
+      } else {
+        *link = first;
+        first = first->next;
+      }
+      link = &(*link)->next;
+    }
+  } catch (...) {
+    *link = first;
+    while (*link != nullptr) {
+      link = &(*link)->next;
+    }
+    *link = second;
+    first = merged;
+    second = nullptr;
+    throw;
+  }
+  *link = (first != nullptr) ? first : second;
+  first = merged;
+  second = nullptr;
+}
+
+/* ************************************************************************** */
+// Inlinable Traversal
+/* ************************************************************************** */
+
+// ForEach: Applies a read-only callable to every element, front to back
+template <typename Data, typename Alloc>
+template <typename Fun>
+void List<Data, Alloc>::ForEach(Fun&& fun) const {
+  for(const Node* curr = head; curr != nullptr; curr = curr->next) {
+    fun(curr->element);
+  }
+}
+
+// ForEachMut: Applies a mutating callable to every element, front to back
+template <typename Data, typename Alloc>
+template <typename Fun>
+void List<Data, Alloc>::ForEachMut(Fun&& fun) {
+  for(Node* curr = head; curr != nullptr; curr = curr->next) {
+    fun(curr->element);
+  }
+}
+
+// Reduce: Folds the elements front to back with the same argument order as Fold
+template <typename Data, typename Alloc>
+template <typename Accumulator, typename Fun>
+Accumulator List<Data, Alloc>::Reduce(Fun&& fun, Accumulator acc) const {
+  for(const Node* curr = head; curr != nullptr; curr = curr->next) {
+    acc = fun(curr->element, acc);
+  }
+  return acc;
+}
+
+/* ************************************************************************** */
+// STL-compatible Iteration
+/* ************************************************************************** */
+
+template <typename Data, typename Alloc>
+typename List<Data, Alloc>::iterator List<Data, Alloc>::begin() noexcept {
+  return iterator(head);
+}
+
+template <typename Data, typename Alloc>
+typename List<Data, Alloc>::iterator List<Data, Alloc>::end() noexcept {
+  return iterator();
+}
+
+template <typename Data, typename Alloc>
+typename List<Data, Alloc>::const_iterator List<Data, Alloc>::begin() const noexcept {
+  return const_iterator(head);
+}
+
+template <typename Data, typename Alloc>
+typename List<Data, Alloc>::const_iterator List<Data, Alloc>::end() const noexcept {
+  return const_iterator();
+}
+
+template <typename Data, typename Alloc>
+typename List<Data, Alloc>::const_iterator List<Data, Alloc>::cbegin() const noexcept {
+  return const_iterator(head);
+}
+
+template <typename Data, typename Alloc>
+typename List<Data, Alloc>::const_iterator List<Data, Alloc>::cend() const noexcept {
+  return const_iterator();
+}
+
+/* ************************************************************************** */
+// Allocator Access
+/* ************************************************************************** */
+
+// GetAllocator() - Returns the node allocator rebound back to Data
+template <typename Data, typename Alloc>
+Alloc List<Data, Alloc>::GetAllocator() const noexcept {
+  return Alloc(alloc);
+}
+
 /* ************************************************************************** */
 
 }
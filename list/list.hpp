@@ -3,6 +3,11 @@
 
 /* ************************************************************************** */
 
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
 #include "../container/linear.hpp"
 #include "../container/dictionary.hpp"
 
@@ -18,7 +23,13 @@ namespace lasd {
 // with dictionary operations. This provides efficient insertion/removal at both ends
 // and supports all standard linear container operations like indexed access and traversal.
 // The list maintains both head and tail pointers for O(1) operations at both ends.
-template <typename Data>
+// Nodes are obtained from 'Alloc' rebound to the node type (std::allocator by default),
+// so a whole list can live in an arena or pool allocator (see allocator/).
+// Each list owns a node pool: nodes are carved from slabs of geometrically growing
+// size and removed nodes go on a free list for reuse, so inserts and removals
+// rarely reach the allocator and consecutive inserts get adjacent nodes.
+// Slabs are returned to the allocator only when the list is destroyed.
+template <typename Data, typename Alloc = std::allocator<Data>>
 class List : virtual public ClearableContainer, 
              virtual public MutableLinearContainer<Data>,
              virtual public DictionaryContainer<Data> {
@@ -30,6 +41,18 @@ protected:
   // Inherit size tracking from the base Container class
   using Container::size;
 
+  struct Node;
+
+  // Node allocator: the list allocator rebound to Node
+  using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+  using NodeTraits = std::allocator_traits<NodeAlloc>;
+
+  [[no_unique_address]] NodeAlloc alloc; // Allocator providing the nodes
+
+  // Move assignment only hands nodes over when the allocators propagate or always compare equal;
+  // otherwise it allocates new nodes, so it may throw
+  static constexpr bool NothrowMoveAssign = NodeTraits::propagate_on_container_move_assignment::value || NodeTraits::is_always_equal::value;
+
   // Node Structure
   // --------------
   // Internal node structure for the singly-linked list
@@ -66,8 +89,8 @@ protected:
 
     /* ********************************************************************** */
 
-    // Node Destructor
-    virtual ~Node() = default;
+    // Node Destructor - non-virtual: nodes carry no vtable pointer
+    ~Node() = default;
 
     /* ********************************************************************** */
 
@@ -88,14 +111,86 @@ protected:
     // Node Specific Functions
 
     // Clone() - Creates a deep copy of this node and potentially links it to another
+    // The copy is allocated from the node pool of the given list
     // Used for implementing list copy operations
-    virtual Node* Clone(Node* next = nullptr);
+    Node* Clone(List&, Node* next = nullptr) const;
 
   };
 
   Node* head = nullptr; // Pointer to the first node in the list (null when empty)
   Node* tail = nullptr; // Pointer to the last node in the list (null when empty)
 
+  // Iterator Class
+  // --------------
+  // Forward iterator over the nodes (models std::forward_iterator).
+  // Const selects the read-only variant; a mutable iterator converts to a const one.
+  // An iterator stays valid until the node it refers to is removed.
+  template <bool Const>
+  class Iterator {
+
+  private:
+
+    template <bool>
+    friend class Iterator;
+
+    friend class List;
+
+    using NodePtr = std::conditional_t<Const, const Node*, Node*>;
+
+    NodePtr node = nullptr; // Current node (null for end())
+
+    explicit Iterator(NodePtr ptr) noexcept : node(ptr) {}
+
+  public:
+
+    using iterator_category = std::forward_iterator_tag;
+    using iterator_concept = std::forward_iterator_tag;
+    using value_type = Data;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const Data*, Data*>;
+    using reference = std::conditional_t<Const, const Data&, Data&>;
+
+    Iterator() = default;
+
+    // Conversion from the mutable to the const iterator
+    template <bool OtherConst> requires (Const && !OtherConst)
+    Iterator(const Iterator<OtherConst>& other) noexcept : node(other.node) {}
+
+    reference operator*() const noexcept { return node->element; }
+    pointer operator->() const noexcept { return &node->element; }
+
+    Iterator& operator++() noexcept { node = node->next; return *this; }
+    Iterator operator++(int) noexcept { Iterator temp = *this; node = node->next; return temp; }
+
+    bool operator==(const Iterator& other) const noexcept { return node == other.node; }
+
+  };
+
+  // Node Pool
+  // ---------
+  // Every slab is allocated as count + 1 node slots; the first slot holds the
+  // SlabHeader linking the slabs together. Free slots hold a FreeSlot link.
+
+  struct SlabHeader {
+    SlabHeader* prev; // Previously allocated slab
+    ulong count; // Number of node slots following the header
+  };
+
+  struct FreeSlot {
+    FreeSlot* next; // Next free slot
+  };
+
+  static_assert(sizeof(SlabHeader) <= sizeof(Node) && alignof(SlabHeader) <= alignof(Node));
+
+  static constexpr ulong MinSlabNodes = 16; // Node slots in the first slab
+  static constexpr ulong MaxSlabNodes = 1UL << 16; // Upper bound on the slab growth
+
+  SlabHeader* slabs = nullptr; // Most recent slab
+  FreeSlot* freeSlots = nullptr; // Slots released by removed nodes
+  Node* carveNext = nullptr; // Next never-used slot of the most recent slab
+  ulong carveLeft = 0; // Never-used slots left in the most recent slab
+  ulong nextSlabSize = MinSlabNodes; // Node slots of the next slab
+
 public:
 
   // List Constructors
@@ -103,15 +198,18 @@ public:
   // Default constructor - creates an empty list
   List() = default;
 
+  // Allocator constructor - creates an empty list that allocates nodes from the given allocator
+  explicit List(const Alloc&) noexcept;
+
   /* ************************************************************************ */
 
   // Specific constructors
 
   // Constructor from TraversableContainer - copies all elements from another container
-  List(const TraversableContainer<Data>&);
+  List(const TraversableContainer<Data>&, const Alloc& = Alloc());
 
   // Constructor from MappableContainer - moves all elements from another container
-  List(MappableContainer<Data>&&);
+  List(MappableContainer<Data>&&, const Alloc& = Alloc());
 
   /* ************************************************************************ */
 
@@ -134,7 +232,7 @@ public:
   List& operator=(const List&);
 
   // Move assignment - replaces current content by transferring from another list
-  List& operator=(List&&) noexcept;
+  List& operator=(List&&) noexcept(NothrowMoveAssign);
 
   /* ************************************************************************ */
 
@@ -258,6 +356,17 @@ public:
 
   // PostOrderTraverse() - Process elements from back to front (read-only)
   void PostOrderTraverse(TraverseFun) const override;
+
+  /* ************************************************************************ */
+
+  // Early-exit traversals (inherited from LinearContainer)
+  // Walk the nodes directly and stop at the first false
+
+  using typename TraversableContainer<Data>::PredicateFun;
+
+  bool TraverseWhile(PredicateFun) const override; // Front to back
+  bool PreOrderTraverseWhile(PredicateFun) const override; // Front to back
+  bool PostOrderTraverseWhile(PredicateFun) const override; // Back to front
   
   /* ************************************************************************ */
 
@@ -298,8 +407,71 @@ public:
   // RemoveSome() - Remove elements, succeeding if at least one is removed
   bool RemoveSome(const TraversableContainer<Data>&) override;
 
+  /* ************************************************************************ */
+
+  // Sorting
+
+  // Sort() - Stable ascending merge sort (by operator<) in O(n log n)
+  // Only the next pointers are relinked: elements are never copied or moved, so
+  // references and iterators to them stay valid (in their new positions).
+  // Basic guarantee: if a comparison throws, the list keeps all its elements
+  // in an unspecified order
+  void Sort();
+
+  /* ************************************************************************ */
+
+  // Inlinable traversal
+  // Like Traverse/Map/Fold (front to back) but taking any callable, which is
+  // called directly in the node loop without std::function or virtual dispatch
+
+  template <typename Fun>
+  void ForEach(Fun&&) const; // Calls fun(const Data&) on every element
+  template <typename Fun>
+  void ForEachMut(Fun&&); // Calls fun(Data&) on every element
+  template <typename Accumulator, typename Fun>
+  Accumulator Reduce(Fun&&, Accumulator) const; // acc = fun(element, acc) over every element, as Fold
+
+  /* ************************************************************************ */
+
+  // STL-compatible iteration (front to back)
+
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  iterator begin() noexcept; // Iterator to the first element
+  iterator end() noexcept; // Iterator past the last element
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  /* ************************************************************************ */
+
+  // Allocator access
+
+  // GetAllocator() - Returns a copy of the allocator (rebound to Data)
+  Alloc GetAllocator() const noexcept;
+
 protected:
 
+  // Node allocation helpers: every node is created and destroyed through these
+
+  // NewNode() - Takes a slot from the node pool and constructs a node from the arguments
+  template <typename... Args>
+  Node* NewNode(Args&&...);
+
+  // DeleteNode() - Destroys a node and puts its slot on the free list
+  void DeleteNode(Node*) noexcept;
+
+  // Merge() - Stably merges the second sorted chain into the first (ties taken from the first)
+  // Both chains stay whole in the first one if a comparison throws
+  static void Merge(Node*&, Node*&);
+
+  // Node pool management
+  void GrowPool(); // Allocates a new slab to carve nodes from
+  void ReleasePool() noexcept; // Returns every slab to the allocator (no node may be alive)
+  void SwapPool(List&) noexcept; // Exchanges the node pools of two lists
+
   // Auxiliary member functions for recursive traversal operations
   
   // PreOrderTraverse() - Recursive helper for front-to-back traversal
@@ -308,6 +480,9 @@ protected:
   // PostOrderTraverse() - Recursive helper for back-to-front traversal
   void PostOrderTraverse(TraverseFun, const Node*) const;
 
+  // PostOrderTraverseWhile() - Recursive helper for back-to-front early-exit traversal
+  bool PostOrderTraverseWhile(const PredicateFun&, const Node*) const;
+
   // Auxiliary member functions for recursive mapping operations
   
   // PreOrderMap() - Recursive helper for front-to-back mapping
@@ -20,6 +20,7 @@
  */
 
 #include "pqheap.hpp"
+#include <compare>
 #include <stdexcept>
 #include <utility>
 
@@ -32,12 +33,17 @@ namespace lasd {
 /*
  * Default Constructor
  * Creates an empty priority queue with minimal initial state
- * Initializes capacity to 0 for lazy allocation strategy
+ * No storage is allocated until the first insertion (lazy allocation strategy)
  */
-template <typename Data>
-PQHeap<Data>::PQHeap() : HeapVec<Data>() {
-  capacity = 0;
-}
+template <typename Data, typename Alloc, typename Compare>
+PQHeap<Data, Alloc, Compare>::PQHeap() : HeapVec<Data, Alloc, Compare>() {}
+
+/*
+ * Allocator Constructor
+ * Empty priority queue that will allocate from the given allocator
+ */
+template <typename Data, typename Alloc, typename Compare>
+PQHeap<Data, Alloc, Compare>::PQHeap(const Alloc& allocator) noexcept : HeapVec<Data, Alloc, Compare>(allocator) {}
 
 // Specific Constructors
 
@@ -46,61 +52,49 @@ PQHeap<Data>::PQHeap() : HeapVec<Data>() {
  * Pre-allocates space for efficient insertions, avoiding early reallocations
  * Delegates heap initialization to HeapVec constructor
  */
-template <typename Data>
-PQHeap<Data>::PQHeap(const ulong newSize) : HeapVec<Data>(newSize) {
-  capacity = newSize;
-}
+template <typename Data, typename Alloc, typename Compare>
+PQHeap<Data, Alloc, Compare>::PQHeap(const ulong newSize, const Alloc& allocator) : HeapVec<Data, Alloc, Compare>(newSize, allocator) {}
 
 /*
  * Constructor from TraversableContainer
  * Creates priority queue by copying elements and applying heapification
  * HeapVec constructor handles the heapification process automatically
  */
-template <typename Data>
-PQHeap<Data>::PQHeap(const TraversableContainer<Data>& container) : HeapVec<Data>(container) {
-  capacity = this->size;
-}
+template <typename Data, typename Alloc, typename Compare>
+PQHeap<Data, Alloc, Compare>::PQHeap(const TraversableContainer<Data>& container, const Alloc& allocator) : HeapVec<Data, Alloc, Compare>(container, allocator) {}
 
 /*
  * Constructor from MappableContainer (Move Semantics)
  * More efficient construction by moving elements instead of copying
  * Particularly beneficial for containers with expensive-to-copy elements
  */
-template <typename Data>
-PQHeap<Data>::PQHeap(MappableContainer<Data>&& container) : HeapVec<Data>(std::move(container)) {
-  capacity = this->size;
-}
+template <typename Data, typename Alloc, typename Compare>
+PQHeap<Data, Alloc, Compare>::PQHeap(MappableContainer<Data>&& container, const Alloc& allocator) : HeapVec<Data, Alloc, Compare>(std::move(container), allocator) {}
 
 /*
  * Copy Constructor
  * Creates deep copy of another priority queue, preserving heap structure
- * Copies both data and capacity information for consistent behavior
+ * The copy is allocated tight: its capacity matches the number of elements
  */
-template <typename Data>
-PQHeap<Data>::PQHeap(const PQHeap<Data>& other) : HeapVec<Data>(other) {
-  capacity = other.capacity;
-}
+template <typename Data, typename Alloc, typename Compare>
+PQHeap<Data, Alloc, Compare>::PQHeap(const PQHeap<Data, Alloc, Compare>& other) : HeapVec<Data, Alloc, Compare>(other) {}
 
 /*
  * Move Constructor
  * Efficiently transfers ownership of resources from another priority queue
- * Leaves source in valid but empty state with zero capacity
+ * Leaves source in valid but empty state (storage and capacity are transferred)
  */
-template <typename Data>
-PQHeap<Data>::PQHeap(PQHeap<Data>&& other) noexcept : HeapVec<Data>(std::move(other)) {
-  capacity = other.capacity;
-  other.capacity = 0;
-}
+template <typename Data, typename Alloc, typename Compare>
+PQHeap<Data, Alloc, Compare>::PQHeap(PQHeap<Data, Alloc, Compare>&& other) noexcept : HeapVec<Data, Alloc, Compare>(std::move(other)) {}
 
 /*
  * Copy Assignment Operator
  * Replaces current contents with deep copy of another priority queue
  * HeapVec assignment handles element copying and heap property maintenance
  */
-template <typename Data>
-PQHeap<Data>& PQHeap<Data>::operator=(const PQHeap<Data>& other) {
-  HeapVec<Data>::operator=(other);
-  capacity = other.capacity;
+template <typename Data, typename Alloc, typename Compare>
+PQHeap<Data, Alloc, Compare>& PQHeap<Data, Alloc, Compare>::operator=(const PQHeap<Data, Alloc, Compare>& other) {
+  HeapVec<Data, Alloc, Compare>::operator=(other);
   return *this;
 }
 
@@ -109,11 +103,9 @@ PQHeap<Data>& PQHeap<Data>::operator=(const PQHeap<Data>& other) {
  * Efficiently transfers ownership while cleaning up current resources
  * Source priority queue is left in valid but empty state
  */
-template <typename Data>
-PQHeap<Data>& PQHeap<Data>::operator=(PQHeap<Data>&& other) noexcept {
-  HeapVec<Data>::operator=(std::move(other));
-  capacity = other.capacity;
-  other.capacity = 0;
+template <typename Data, typename Alloc, typename Compare>
+PQHeap<Data, Alloc, Compare>& PQHeap<Data, Alloc, Compare>::operator=(PQHeap<Data, Alloc, Compare>&& other) noexcept(HeapVec<Data, Alloc, Compare>::NothrowMoveAssign) {
+  HeapVec<Data, Alloc, Compare>::operator=(std::move(other));
   return *this;
 }
 
@@ -124,17 +116,17 @@ PQHeap<Data>& PQHeap<Data>::operator=(PQHeap<Data>&& other) noexcept {
  * Compares priority queues for structural equality
  * Delegates to HeapVec comparison which checks heap structure
  */
-template <typename Data>
-bool PQHeap<Data>::operator==(const PQHeap<Data>& other) const noexcept {
-  return HeapVec<Data>::operator==(other);
+template <typename Data, typename Alloc, typename Compare>
+bool PQHeap<Data, Alloc, Compare>::operator==(const PQHeap<Data, Alloc, Compare>& other) const noexcept {
+  return HeapVec<Data, Alloc, Compare>::operator==(other);
 }
 
 /*
  * Inequality Comparison Operator
  * Logical negation of equality comparison
  */
-template <typename Data>
-bool PQHeap<Data>::operator!=(const PQHeap<Data>& other) const noexcept {
+template <typename Data, typename Alloc, typename Compare>
+bool PQHeap<Data, Alloc, Compare>::operator!=(const PQHeap<Data, Alloc, Compare>& other) const noexcept {
   return !(*this == other);
 }
 
@@ -145,8 +137,8 @@ bool PQHeap<Data>::operator!=(const PQHeap<Data>& other) const noexcept {
  * Returns const reference to root element without modification
  * Root element (index 0) always contains highest priority in max-heap
  */
-template <typename Data>
-const Data& PQHeap<Data>::Tip() const {
+template <typename Data, typename Alloc, typename Compare>
+const Data& PQHeap<Data, Alloc, Compare>::Tip() const {
   if (this->size == 0)
     throw std::length_error("Priority queue is empty");
   return this->Elements[0];
@@ -162,22 +154,22 @@ const Data& PQHeap<Data>::Tip() const {
  * 3. General case: move last element to root and heapify down
  * 4. Shrink capacity if appropriate to minimize memory usage
  */
-template <typename Data>
-void PQHeap<Data>::RemoveTip() {
+template <typename Data, typename Alloc, typename Compare>
+void PQHeap<Data, Alloc, Compare>::RemoveTip() {
   if (this->size == 0)
     throw std::length_error("Priority queue is empty");
   
   if (this->size == 1) {
-    this->size = 0;
-    ShrinkCapacity();
+    this->PopBack();
+    this->ShrinkCapacity();
     return;
   }
   
-  // Move the last element to root and restore heap property
+  // Move the last element to root, destroy the vacated slot and restore heap property
   this->Elements[0] = std::move(this->Elements[this->size - 1]);
-  this->size--;
+  this->PopBack();
   this->HeapifyDown(0);
-  ShrinkCapacity();
+  this->ShrinkCapacity();
 }
 
 /*
@@ -191,22 +183,22 @@ void PQHeap<Data>::RemoveTip() {
  * 3. General case: replace root with last element and heapify
  * 4. Return the original root value
  */
-template <typename Data>
-Data PQHeap<Data>::TipNRemove() {
+template <typename Data, typename Alloc, typename Compare>
+Data PQHeap<Data, Alloc, Compare>::TipNRemove() {
   if (this->size == 0)
     throw std::length_error("Priority queue is empty");
   
-  Data result = this->Elements[0];
+  Data result = std::move(this->Elements[0]);
   
   if (this->size == 1) {
-    this->size = 0;
-    ShrinkCapacity();
+    this->PopBack();
+    this->ShrinkCapacity();
   } else {
     // Replace root with last element and restore heap property
     this->Elements[0] = std::move(this->Elements[this->size - 1]);
-    this->size--;
+    this->PopBack();
     this->HeapifyDown(0);
-    ShrinkCapacity();
+    this->ShrinkCapacity();
   }
   
   return result;
@@ -222,11 +214,9 @@ Data PQHeap<Data>::TipNRemove() {
  * 2. Place element at end of heap (last position)
  * 3. Restore heap property using HeapifyUp from insertion point
  */
-template <typename Data>
-void PQHeap<Data>::Insert(const Data& value) {
-  EnsureCapacity(this->size + 1);
-  this->Elements[this->size] = value;
-  this->size++;
+template <typename Data, typename Alloc, typename Compare>
+void PQHeap<Data, Alloc, Compare>::Insert(const Data& value) {
+  this->PushBack(value); // Amortized O(1) append with geometric growth
   this->HeapifyUp(this->size - 1);
 }
 
@@ -235,11 +225,9 @@ void PQHeap<Data>::Insert(const Data& value) {
  * More efficient insertion using move semantics
  * Particularly beneficial for expensive-to-copy data types
  */
-template <typename Data>
-void PQHeap<Data>::Insert(Data&& value) {
-  EnsureCapacity(this->size + 1);
-  this->Elements[this->size] = std::move(value);
-  this->size++;
+template <typename Data, typename Alloc, typename Compare>
+void PQHeap<Data, Alloc, Compare>::Insert(Data&& value) {
+  this->PushBack(std::move(value)); // Amortized O(1) append with geometric growth
   this->HeapifyUp(this->size - 1);
 }
 
@@ -254,10 +242,10 @@ void PQHeap<Data>::Insert(Data&& value) {
  * 3. Determine heap maintenance direction based on priority comparison
  * 4. Apply appropriate heapify operation (up or down)
  */
-template <typename Data>
-void PQHeap<Data>::Change(const Data& oldValue, const Data& newValue) {
+template <typename Data, typename Alloc, typename Compare>
+void PQHeap<Data, Alloc, Compare>::Change(const Data& oldValue, const Data& newValue) {
   ulong idx = 0;
-  while (idx < this->size && !(this->Elements[idx] == oldValue)) {
+  while (idx < this->size && !this->order.Equivalent(this->Elements[idx], oldValue)) {
     ++idx;
   }
   
@@ -268,9 +256,10 @@ void PQHeap<Data>::Change(const Data& oldValue, const Data& newValue) {
   this->Elements[idx] = newValue;
   
   // Restore heap property based on priority change direction
-  if (newValue > oldData)
+  std::weak_ordering side = this->order.ThreeWay(newValue, oldData);
+  if (side > 0)
     this->HeapifyUp(idx);        // Priority increased: bubble up
-  else if (newValue < oldData)
+  else if (side < 0)
     this->HeapifyDown(idx);      // Priority decreased: bubble down
 }
 
@@ -279,10 +268,10 @@ void PQHeap<Data>::Change(const Data& oldValue, const Data& newValue) {
  * More efficient version using move semantics for new value
  * Uses move construction to avoid unnecessary copying
  */
-template <typename Data>
-void PQHeap<Data>::Change(const Data& oldValue, Data&& newValue) {
+template <typename Data, typename Alloc, typename Compare>
+void PQHeap<Data, Alloc, Compare>::Change(const Data& oldValue, Data&& newValue) {
   ulong idx = 0;
-  while (idx < this->size && !(this->Elements[idx] == oldValue)) {
+  while (idx < this->size && !this->order.Equivalent(this->Elements[idx], oldValue)) {
     ++idx;
   }
   
@@ -294,9 +283,10 @@ void PQHeap<Data>::Change(const Data& oldValue, Data&& newValue) {
   this->Elements[idx] = std::move(newValue);
   
   // Restore heap property based on priority comparison
-  if (this->Elements[idx] > oldData)
+  std::weak_ordering side = this->order.ThreeWay(this->Elements[idx], oldData);
+  if (side > 0)
     this->HeapifyUp(idx);
-  else if (this->Elements[idx] < oldData)
+  else if (side < 0)
     this->HeapifyDown(idx);
 }
 
@@ -305,8 +295,8 @@ void PQHeap<Data>::Change(const Data& oldValue, Data&& newValue) {
  * More efficient than value-based change as it avoids linear search
  * Direct access by index provides O(log n) complexity instead of O(n)
  */
-template <typename Data>
-void PQHeap<Data>::Change(const ulong& idx, const Data& newValue) {
+template <typename Data, typename Alloc, typename Compare>
+void PQHeap<Data, Alloc, Compare>::Change(const ulong& idx, const Data& newValue) {
   if (idx >= this->size)
     throw std::out_of_range("Index out of range");
   
@@ -314,9 +304,10 @@ void PQHeap<Data>::Change(const ulong& idx, const Data& newValue) {
   this->Elements[idx] = newValue;
   
   // Determine and apply appropriate heap maintenance
-  if (newValue > oldData)
+  std::weak_ordering side = this->order.ThreeWay(newValue, oldData);
+  if (side > 0)
     this->HeapifyUp(idx);
-  else if (newValue < oldData)
+  else if (side < 0)
     this->HeapifyDown(idx);
 }
 
@@ -324,17 +315,18 @@ void PQHeap<Data>::Change(const ulong& idx, const Data& newValue) {
  * Change Element Priority by Index (Move Version)
  * Most efficient priority change operation combining direct access with move semantics
  */
-template <typename Data>
-void PQHeap<Data>::Change(const ulong& idx, Data&& newValue) {
+template <typename Data, typename Alloc, typename Compare>
+void PQHeap<Data, Alloc, Compare>::Change(const ulong& idx, Data&& newValue) {
   if (idx >= this->size)
     throw std::out_of_range("Index out of range");
   
   Data oldData = std::move(this->Elements[idx]);
   this->Elements[idx] = std::move(newValue);
   
-  if (this->Elements[idx] > oldData)
+  std::weak_ordering side = this->order.ThreeWay(this->Elements[idx], oldData);
+  if (side > 0)
     this->HeapifyUp(idx);
-  else if (this->Elements[idx] < oldData)
+  else if (side < 0)
     this->HeapifyDown(idx);
 }
 
@@ -345,11 +337,9 @@ void PQHeap<Data>::Change(const ulong& idx, Data&& newValue) {
  * Internal helper function that combines insertion with heap property maintenance
  * Used by public Insert methods and constructor implementations
  */
-template <typename Data>
-void PQHeap<Data>::InsertWithHeapify(const Data& value) {
-  EnsureCapacity(this->size + 1);
-  this->Elements[this->size] = value;
-  this->size++;
+template <typename Data, typename Alloc, typename Compare>
+void PQHeap<Data, Alloc, Compare>::InsertWithHeapify(const Data& value) {
+  this->PushBack(value); // Amortized O(1) append with geometric growth
   this->HeapifyUp(this->size - 1);
 }
 
@@ -357,11 +347,9 @@ void PQHeap<Data>::InsertWithHeapify(const Data& value) {
  * Insert with Heapify (Move Version)
  * Move semantics version for performance optimization
  */
-template <typename Data>
-void PQHeap<Data>::InsertWithHeapify(Data&& value) {
-  EnsureCapacity(this->size + 1);
-  this->Elements[this->size] = std::move(value);
-  this->size++;
+template <typename Data, typename Alloc, typename Compare>
+void PQHeap<Data, Alloc, Compare>::InsertWithHeapify(Data&& value) {
+  this->PushBack(std::move(value)); // Amortized O(1) append with geometric growth
   this->HeapifyUp(this->size - 1);
 }
 
@@ -370,98 +358,10 @@ void PQHeap<Data>::InsertWithHeapify(Data&& value) {
  * Complete cleanup function that deallocates memory and resets state
  * Used for implementing efficient assignment and destruction operations
  */
-template <typename Data>
-void PQHeap<Data>::ClearAll() {
-  // Deallocate existing elements array
-  if (this->Elements != nullptr) {
-    delete[] this->Elements;
-    this->Elements = nullptr;
-  }
-  this->size = 0;
-  capacity = 0;  // Reset capacity to enable fresh allocation strategy
-}
-
-// Dynamic Capacity Management Implementation
-
-/*
- * Ensure Minimum Capacity is Available
- * Implements exponential growth strategy for amortized O(1) insertion performance
- * 
- * Growth Strategy:
- * - Start with capacity 1 for first allocation
- * - Double capacity until minimum requirement is met
- * - This ensures amortized O(1) insertion time complexity
- * 
- * Memory Management:
- * - Creates new array with increased capacity
- * - Moves existing elements to new location
- * - Deallocates old array to prevent memory leaks
- */
-template <typename Data>
-void PQHeap<Data>::EnsureCapacity(ulong minCapacity) {
-  if (capacity < minCapacity) {
-    // Exponential growth: double capacity or use minCapacity, whichever is larger
-    ulong newCapacity = (capacity == 0) ? 1 : capacity;
-    while (newCapacity < minCapacity) {
-      newCapacity *= 2;
-    }
-    
-    // Allocate new array with increased capacity
-    Data* newElements = new Data[newCapacity]{};
-    
-    // Move existing elements to new location for efficiency
-    for (ulong i = 0; i < this->size; i++) {
-      newElements[i] = std::move(this->Elements[i]);
-    }
-    
-    // Clean up old array and update internal state
-    delete[] this->Elements;
-    this->Elements = newElements;
-    capacity = newCapacity;
-  }
-}
-
-/*
- * Shrink Capacity for Memory Optimization
- * Implements capacity reduction strategy to minimize memory usage
- * 
- * Shrinkage Strategy:
- * - Shrink when size is ≤ 1/4 of capacity and capacity > 4
- * - Reduce capacity by half to maintain reasonable buffer
- * - Prevents pathological shrinking for small priority queues
- * 
- * Memory Management:
- * - Creates new smaller array when shrinkage is beneficial
- * - Moves elements to new location efficiently
- * - Maintains minimum capacity for performance
- * 
- * Performance Considerations:
- * - Avoids frequent reallocations by using 25% threshold
- * - Maintains reasonable buffer space for future insertions
- * - Balances memory usage with performance requirements
- */
-template <typename Data>
-void PQHeap<Data>::ShrinkCapacity() {
-  // Apply shrinking policy: shrink if size ≤ 25% of capacity and capacity > 4
-  if (capacity > 4 && this->size <= capacity / 4) {
-    ulong newCapacity = capacity / 2;
-    if (newCapacity < this->size) {
-      newCapacity = this->size;  // Ensure capacity is never less than size
-    }
-    
-    // Allocate new smaller array
-    Data* newElements = new Data[newCapacity]{};
-    
-    // Move existing elements to new location
-    for (ulong i = 0; i < this->size; i++) {
-      newElements[i] = std::move(this->Elements[i]);
-    }
-    
-    // Clean up old array and update capacity
-    delete[] this->Elements;
-    this->Elements = newElements;
-    capacity = newCapacity;
-  }
+template <typename Data, typename Alloc, typename Compare>
+void PQHeap<Data, Alloc, Compare>::ClearAll() {
+  // Resizing to zero deallocates the elements array and resets the capacity
+  this->Resize(0);
 }
 
 /* ************************************************************************** */
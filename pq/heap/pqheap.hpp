@@ -51,7 +51,7 @@ namespace lasd {
  * 
  * Inheritance Structure:
  * - Virtual inheritance from PQ<Data>: Provides abstract priority queue interface
- * - Public inheritance from HeapVec<Data>: Leverages binary heap implementation
+ * - Public inheritance from HeapVec<Data, Alloc, Compare>: Leverages binary heap implementation
  * 
  * The virtual inheritance prevents diamond inheritance issues and ensures that
  * only one instance of any common base classes exists in the inheritance hierarchy.
@@ -63,19 +63,19 @@ namespace lasd {
  * - Change(): O(n) for value-based, O(log n) for index-based modification
  * - Memory: O(n) space complexity with dynamic capacity management
  * 
- * Template Parameter:
- * - Data: The type of elements stored in the priority queue, must be comparable
+ * Template Parameters:
+ * - Data: The type of elements stored in the priority queue
+ * - Alloc: Allocator providing the heap storage
+ * - Compare: Priority order; the tip is the element no other follows
+ *   (the largest for std::less, the smallest for std::greater: a min-priority queue)
  */
-template <typename Data>
+template <typename Data, typename Alloc = std::allocator<Data>, typename Compare = std::less<Data>>
 class PQHeap : virtual public PQ<Data>,
-               public HeapVec<Data> {
+               public HeapVec<Data, Alloc, Compare> {
 
 private:
 
-  // Current capacity for efficient memory management
-  // This allows the priority queue to grow and shrink dynamically
-  // while minimizing memory allocations and maintaining performance
-  ulong capacity = 0;
+  // No additional members: capacity is managed by the underlying Vector
 
 protected:
 
@@ -109,29 +109,9 @@ protected:
   void ClearAll();
   
   // Capacity Management Functions for Dynamic Memory Optimization
-  
-  /*
-   * Ensure the underlying storage has at least the specified capacity
-   * This function handles memory allocation and reallocation to maintain
-   * efficient operations while preventing unnecessary memory waste
-   * 
-   * Parameters:
-   * - minCapacity: Minimum required capacity
-   * 
-   * Time Complexity: O(n) - when reallocation is needed
-   * Space Complexity: O(n) - for the new storage allocation
-   */
-  void EnsureCapacity(ulong minCapacity);
-  
-  /*
-   * Reduce capacity when the priority queue becomes significantly smaller
-   * This function helps minimize memory usage by shrinking the underlying
-   * storage when it's much larger than needed
-   * 
-   * Time Complexity: O(n) - when reallocation occurs
-   * Space Complexity: O(n) - for the new smaller storage
-   */
-  void ShrinkCapacity();
+  // Geometric growth and quarter-full shrinking are inherited from Vector
+  using HeapVec<Data, Alloc, Compare>::EnsureCapacity;
+  using HeapVec<Data, Alloc, Compare>::ShrinkCapacity;
 
 public:
 
@@ -147,6 +127,12 @@ public:
    */
   PQHeap();
 
+  /*
+   * Allocator Constructor
+   * Creates an empty priority queue whose storage comes from the given allocator
+   */
+  explicit PQHeap(const Alloc&) noexcept;
+
   /* ************************************************************************ */
 
   // Specific Constructors for Various Initialization Scenarios
@@ -162,7 +148,7 @@ public:
    * Space Complexity: O(n) where n is the initial capacity
    * Exception Safety: Strong guarantee (may throw std::bad_alloc)
    */
-  explicit PQHeap(const ulong);
+  explicit PQHeap(const ulong, const Alloc& = Alloc());
   
   /*
    * Constructor from TraversableContainer
@@ -176,7 +162,7 @@ public:
    * Space Complexity: O(n) - for storing all elements
    * Exception Safety: Strong guarantee
    */
-  PQHeap(const TraversableContainer<Data>&);
+  PQHeap(const TraversableContainer<Data>&, const Alloc& = Alloc());
   
   /*
    * Constructor from MappableContainer (Move Semantics)
@@ -190,7 +176,7 @@ public:
    * Space Complexity: O(n) - for the moved elements
    * Exception Safety: Strong guarantee
    */
-  PQHeap(MappableContainer<Data>&&);
+  PQHeap(MappableContainer<Data>&&, const Alloc& = Alloc());
 
   /* ************************************************************************ */
 
@@ -271,7 +257,7 @@ public:
    * Space Complexity: O(1) - no additional space needed
    * Exception Safety: No-throw guarantee
    */
-  PQHeap& operator=(PQHeap&&) noexcept;
+  PQHeap& operator=(PQHeap&&) noexcept(HeapVec<Data, Alloc, Compare>::NothrowMoveAssign);
 
   /* ************************************************************************ */
 
@@ -467,12 +453,15 @@ protected:
    * - operator[]: Direct access to elements by index
    * - Front(): Access to the first element (same as Tip but different semantics)
    * - Back(): Access to the last element in the underlying array
+   * - PushBack()/PopBack(): Raw appends/removals that bypass heap maintenance
    * 
    * These are available to derived classes but not to external users.
    */
-  using HeapVec<Data>::operator[];
-  using HeapVec<Data>::Front;
-  using HeapVec<Data>::Back;
+  using HeapVec<Data, Alloc, Compare>::operator[];
+  using HeapVec<Data, Alloc, Compare>::Front;
+  using HeapVec<Data, Alloc, Compare>::Back;
+  using HeapVec<Data, Alloc, Compare>::PushBack;
+  using HeapVec<Data, Alloc, Compare>::PopBack;
 
 };
 
@@ -0,0 +1,913 @@
+
+/*
+ * SetBTree Implementation File
+ *
+ * This file contains the implementation of the SetBTree class, a B+-tree whose
+ * leaves store the elements in sorted arrays linked into a list, and whose inner
+ * nodes store separators, children and the element count of every child.
+ *
+ * Implementation highlights:
+ * - Insertions overfill a node by one slot and then split it in two halves
+ * - Every node a split needs is allocated before the tree changes
+ * - Removals refill an underfull node from a sibling, or merge the two
+ * - Traversals and iterators only walk the leaf list
+ */
+
+#include <stdexcept>
+#include <string>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// SETBTREE CONSTRUCTORS AND INITIALIZATION
+
+// Allocator constructor: Empty set drawing its nodes from the given allocator
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+SetBTree<Data, Alloc, Compare, NodeSize>::SetBTree(const Alloc& allocator) noexcept : alloc(allocator) {}
+
+// Constructor from TraversableContainer: Inserts every element, skipping duplicates
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+SetBTree<Data, Alloc, Compare, NodeSize>::SetBTree(const TraversableContainer<Data>& container, const Alloc& allocator) : alloc(allocator) {
+  container.Traverse([this](const Data& item) {
+    Insert(item);
+  });
+}
+
+// Constructor from MappableContainer: Moves every element in, then clears the source
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+SetBTree<Data, Alloc, Compare, NodeSize>::SetBTree(MappableContainer<Data>&& container, const Alloc& allocator) : alloc(allocator) {
+  container.Map([this](Data& item) {
+    Insert(std::move(item));
+  });
+
+  if (dynamic_cast<ClearableContainer*>(&container) != nullptr) {
+    dynamic_cast<ClearableContainer*>(&container)->Clear();
+  }
+}
+
+// Copy constructor: Same shape as the other tree, without any search
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+SetBTree<Data, Alloc, Compare, NodeSize>::SetBTree(const SetBTree& other)
+  : alloc(std::allocator_traits<Alloc>::select_on_container_copy_construction(other.alloc)) {
+  CopyTree(other);
+}
+
+// Move constructor: Takes the nodes and leaves the other set empty
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+SetBTree<Data, Alloc, Compare, NodeSize>::SetBTree(SetBTree&& other) noexcept : alloc(other.alloc) {
+  SwapTree(other);
+}
+
+// Destructor: Releases every node
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+SetBTree<Data, Alloc, Compare, NodeSize>::~SetBTree() {
+  if (root != nullptr) {
+    Destroy(root, 0);
+  }
+}
+
+/* ************************************************************************** */
+
+// ASSIGNMENT OPERATORS
+
+// Copy assignment: Builds the copy aside, then swaps it in (strong guarantee)
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+SetBTree<Data, Alloc, Compare, NodeSize>& SetBTree<Data, Alloc, Compare, NodeSize>::operator=(const SetBTree& other) {
+  if (this != &other) {
+    constexpr bool propagate = std::allocator_traits<Alloc>::propagate_on_container_copy_assignment::value;
+    SetBTree copy(propagate ? other.alloc : alloc);
+    copy.CopyTree(other);
+    SwapTree(copy);
+    if constexpr (propagate) {
+      std::swap(alloc, copy.alloc); // The old nodes leave with the allocator that made them
+    }
+  }
+  return *this;
+}
+
+// Move assignment: Takes the nodes when the allocators allow it, moves the elements otherwise
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+SetBTree<Data, Alloc, Compare, NodeSize>& SetBTree<Data, Alloc, Compare, NodeSize>::operator=(SetBTree&& other) noexcept(NothrowMoveAssign) {
+  if (this != &other) {
+    if constexpr (std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value) {
+      Clear();
+      alloc = other.alloc;
+      SwapTree(other);
+    } else {
+      if (alloc == other.alloc) {
+        SwapTree(other);
+      } else {
+        Clear();
+        for (Leaf* leaf = other.first; leaf != nullptr; leaf = leaf->next) {
+          for (ulong index = 0; index < leaf->count; ++index) {
+            Insert(std::move(leaf->keys[index]));
+          }
+        }
+        other.Clear();
+      }
+    }
+  }
+  return *this;
+}
+
+/* ************************************************************************** */
+
+// COMPARISON OPERATORS
+
+// Equality: Same size and equivalent elements in order, compared leaf by leaf
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+bool SetBTree<Data, Alloc, Compare, NodeSize>::operator==(const SetBTree& other) const noexcept {
+  if (size != other.size) {
+    return false;
+  }
+  const_iterator mine = begin();
+  for (const Data& item : other) {
+    if (!order.Equivalent(*mine, item)) {
+      return false;
+    }
+    ++mine;
+  }
+  return true;
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+bool SetBTree<Data, Alloc, Compare, NodeSize>::operator!=(const SetBTree& other) const noexcept {
+  return !(*this == other);
+}
+
+/* ************************************************************************** */
+
+// CLEARABLE AND TESTABLE CONTAINER
+
+// Clear: Releases every node and resets the tree to empty
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::Clear() {
+  if (root != nullptr) {
+    Destroy(root, 0);
+  }
+  root = nullptr;
+  first = last = nullptr;
+  height = 0;
+  size = 0;
+}
+
+// Exists: One descent and a binary search in the leaf
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+bool SetBTree<Data, Alloc, Compare, NodeSize>::Exists(const Data& data) const noexcept {
+  if (root == nullptr) {
+    return false;
+  }
+  const Leaf* leaf = Descend(data, nullptr);
+  ulong slot = LowerBound(leaf, data);
+  return slot < leaf->count && !order.Less(data, leaf->keys[slot]);
+}
+
+/* ************************************************************************** */
+
+// ORDERED DICTIONARY OPERATIONS
+
+// Min: First element of the first leaf
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+const Data& SetBTree<Data, Alloc, Compare, NodeSize>::Min() const {
+  if (size == 0) {
+    throw std::length_error("Access to an empty set.");
+  }
+  return first->keys[0];
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+Data SetBTree<Data, Alloc, Compare, NodeSize>::MinNRemove() {
+  Data min(Min());
+  Remove(min);
+  return min;
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::RemoveMin() {
+  Remove(Min());
+}
+
+// Max: Last element of the last leaf
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+const Data& SetBTree<Data, Alloc, Compare, NodeSize>::Max() const {
+  if (size == 0) {
+    throw std::length_error("Access to an empty set.");
+  }
+  return last->keys[last->count - 1];
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+Data SetBTree<Data, Alloc, Compare, NodeSize>::MaxNRemove() {
+  Data max(Max());
+  Remove(max);
+  return max;
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::RemoveMax() {
+  Remove(Max());
+}
+
+// Predecessor: The slot before the element's position, or the end of the previous leaf
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+const Data& SetBTree<Data, Alloc, Compare, NodeSize>::Predecessor(const Data& data) const {
+  if (root != nullptr) {
+    const Leaf* leaf = Descend(data, nullptr);
+    ulong slot = LowerBound(leaf, data);
+    if (slot > 0) {
+      return leaf->keys[slot - 1];
+    }
+    if (leaf->prev != nullptr) {
+      return leaf->prev->keys[leaf->prev->count - 1];
+    }
+  }
+  throw std::length_error("Predecessor not found.");
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+Data SetBTree<Data, Alloc, Compare, NodeSize>::PredecessorNRemove(const Data& data) {
+  Data result(Predecessor(data));
+  Remove(result);
+  return result;
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::RemovePredecessor(const Data& data) {
+  Remove(Predecessor(data));
+}
+
+// Successor: The first slot after the element, or the start of the next leaf
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+const Data& SetBTree<Data, Alloc, Compare, NodeSize>::Successor(const Data& data) const {
+  if (root != nullptr) {
+    const Leaf* leaf = Descend(data, nullptr);
+    ulong slot = Rank<true>(leaf->keys, leaf->count, data);
+    if (slot < leaf->count) {
+      return leaf->keys[slot];
+    }
+    if (leaf->next != nullptr) {
+      return leaf->next->keys[0];
+    }
+  }
+  throw std::length_error("Successor not found.");
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+Data SetBTree<Data, Alloc, Compare, NodeSize>::SuccessorNRemove(const Data& data) {
+  Data result(Successor(data));
+  Remove(result);
+  return result;
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::RemoveSuccessor(const Data& data) {
+  Remove(Successor(data));
+}
+
+/* ************************************************************************** */
+
+// DICTIONARY OPERATIONS
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+bool SetBTree<Data, Alloc, Compare, NodeSize>::Insert(const Data& data) {
+  return InsertValue(data);
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+bool SetBTree<Data, Alloc, Compare, NodeSize>::Insert(Data&& data) {
+  return InsertValue(std::move(data));
+}
+
+// Remove: Erases the element from its leaf, then rebalances the path bottom-up
+// The element may live in this set (e.g. Remove(Min())): it is not read once erased
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+bool SetBTree<Data, Alloc, Compare, NodeSize>::Remove(const Data& data) {
+  if (root == nullptr) {
+    return false;
+  }
+  Step path[MaxHeight];
+  Leaf* leaf = Descend(data, path);
+  ulong slot = LowerBound(leaf, data);
+  if (slot == leaf->count || order.Less(data, leaf->keys[slot])) {
+    return false;
+  }
+
+  std::move(leaf->keys + slot + 1, leaf->keys + leaf->count, leaf->keys + slot);
+  --leaf->count;
+  Vacate(leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+  --size;
+  for (ulong depth = 0; depth + 1 < height; ++depth) {
+    --path[depth].node->weight[path[depth].index];
+  }
+
+  if (height == 1) {
+    if (leaf->count == 0) {
+      DeleteLeaf(leaf);
+      root = nullptr;
+      first = last = nullptr;
+      height = 0;
+    }
+    return true;
+  }
+
+  // Stale separators (copies of removed elements) still route correctly, so
+  // only underfull nodes need work
+  if (leaf->count < MinSlots) {
+    FixLeaf(path[height - 2].node, path[height - 2].index);
+    for (ulong depth = height - 2; depth > 0 && path[depth].node->count < MinSlots; --depth) {
+      FixInner(path[depth - 1].node, path[depth - 1].index);
+    }
+  }
+
+  // A root left with a single child gives way to it
+  Inner* top = static_cast<Inner*>(root);
+  if (top->count == 1) {
+    root = top->child[0];
+    DeleteInner(top);
+    --height;
+  }
+  return true;
+}
+
+// Bulk operations: Element by element, with the DictionaryContainer semantics
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+bool SetBTree<Data, Alloc, Compare, NodeSize>::InsertAll(const TraversableContainer<Data>& container) {
+  return DictionaryContainer<Data>::InsertAll(container);
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+bool SetBTree<Data, Alloc, Compare, NodeSize>::InsertAll(MappableContainer<Data>&& container) {
+  return DictionaryContainer<Data>::InsertAll(std::move(container));
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+bool SetBTree<Data, Alloc, Compare, NodeSize>::RemoveAll(const TraversableContainer<Data>& container) {
+  return DictionaryContainer<Data>::RemoveAll(container);
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+bool SetBTree<Data, Alloc, Compare, NodeSize>::InsertSome(const TraversableContainer<Data>& container) {
+  return DictionaryContainer<Data>::InsertSome(container);
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+bool SetBTree<Data, Alloc, Compare, NodeSize>::InsertSome(MappableContainer<Data>&& container) {
+  return DictionaryContainer<Data>::InsertSome(std::move(container));
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+bool SetBTree<Data, Alloc, Compare, NodeSize>::RemoveSome(const TraversableContainer<Data>& container) {
+  return DictionaryContainer<Data>::RemoveSome(container);
+}
+
+/* ************************************************************************** */
+
+// LINEAR CONTAINER ACCESS
+
+// operator[]: Descends by the element counts of the children
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+const Data& SetBTree<Data, Alloc, Compare, NodeSize>::operator[](ulong index) const {
+  if (index >= size) {
+    throw std::out_of_range("Access at index " + std::to_string(index) + "; SetBTree size " + std::to_string(size) + ".");
+  }
+  const Node* node = root;
+  for (ulong depth = 0; depth + 1 < height; ++depth) {
+    const Inner* inner = static_cast<const Inner*>(node);
+    ulong child = 0;
+    while (index >= inner->weight[child]) {
+      index -= inner->weight[child];
+      ++child;
+    }
+    node = inner->child[child];
+  }
+  return static_cast<const Leaf*>(node)->keys[index];
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+const Data& SetBTree<Data, Alloc, Compare, NodeSize>::Front() const {
+  return Min();
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+const Data& SetBTree<Data, Alloc, Compare, NodeSize>::Back() const {
+  return Max();
+}
+
+/* ************************************************************************** */
+
+// TRAVERSALS OVER THE LEAF LIST
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::Traverse(TraverseFun fun) const {
+  PreOrderTraverse(fun);
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::PreOrderTraverse(TraverseFun fun) const {
+  for (const Leaf* leaf = first; leaf != nullptr; leaf = leaf->next) {
+    for (ulong slot = 0; slot < leaf->count; ++slot) {
+      fun(leaf->keys[slot]);
+    }
+  }
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::PostOrderTraverse(TraverseFun fun) const {
+  for (const Leaf* leaf = last; leaf != nullptr; leaf = leaf->prev) {
+    for (ulong slot = leaf->count; slot > 0; --slot) {
+      fun(leaf->keys[slot - 1]);
+    }
+  }
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+bool SetBTree<Data, Alloc, Compare, NodeSize>::TraverseWhile(PredicateFun fun) const {
+  return PreOrderTraverseWhile(fun);
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+bool SetBTree<Data, Alloc, Compare, NodeSize>::PreOrderTraverseWhile(PredicateFun fun) const {
+  for (const Leaf* leaf = first; leaf != nullptr; leaf = leaf->next) {
+    for (ulong slot = 0; slot < leaf->count; ++slot) {
+      if (!fun(leaf->keys[slot])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+bool SetBTree<Data, Alloc, Compare, NodeSize>::PostOrderTraverseWhile(PredicateFun fun) const {
+  for (const Leaf* leaf = last; leaf != nullptr; leaf = leaf->prev) {
+    for (ulong slot = leaf->count; slot > 0; --slot) {
+      if (!fun(leaf->keys[slot - 1])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/* ************************************************************************** */
+
+// ALLOCATOR ACCESS
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+Alloc SetBTree<Data, Alloc, Compare, NodeSize>::GetAllocator() const noexcept {
+  return alloc;
+}
+
+/* ************************************************************************** */
+
+// NODE MANAGEMENT
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+typename SetBTree<Data, Alloc, Compare, NodeSize>::Leaf* SetBTree<Data, Alloc, Compare, NodeSize>::NewLeaf() {
+  LeafAlloc nodes(alloc);
+  Leaf* leaf = LeafTraits::allocate(nodes, 1);
+  try {
+    LeafTraits::construct(nodes, leaf);
+  } catch (...) {
+    LeafTraits::deallocate(nodes, leaf, 1);
+    throw;
+  }
+  return leaf;
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+typename SetBTree<Data, Alloc, Compare, NodeSize>::Inner* SetBTree<Data, Alloc, Compare, NodeSize>::NewInner() {
+  InnerAlloc nodes(alloc);
+  Inner* inner = InnerTraits::allocate(nodes, 1);
+  try {
+    InnerTraits::construct(nodes, inner);
+  } catch (...) {
+    InnerTraits::deallocate(nodes, inner, 1);
+    throw;
+  }
+  return inner;
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::DeleteLeaf(Leaf* leaf) noexcept {
+  LeafAlloc nodes(alloc);
+  LeafTraits::destroy(nodes, leaf);
+  LeafTraits::deallocate(nodes, leaf, 1);
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::DeleteInner(Inner* inner) noexcept {
+  InnerAlloc nodes(alloc);
+  InnerTraits::destroy(nodes, inner);
+  InnerTraits::deallocate(nodes, inner, 1);
+}
+
+// Destroy: Depth-first release; the depth tells leaves from inner nodes
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::Destroy(Node* node, ulong depth) noexcept {
+  if (depth + 1 == height) {
+    DeleteLeaf(static_cast<Leaf*>(node));
+    return;
+  }
+  Inner* inner = static_cast<Inner*>(node);
+  for (ulong index = 0; index < inner->count; ++index) {
+    Destroy(inner->child[index], depth + 1);
+  }
+  DeleteInner(inner);
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::CopyTree(const SetBTree& other) {
+  if (other.root == nullptr) {
+    return;
+  }
+  Leaf* tail = nullptr;
+  height = other.height;
+  try {
+    root = CopyNode(other.root, 0, tail);
+  } catch (...) {
+    height = 0;
+    first = nullptr;
+    throw;
+  }
+  last = tail;
+  size = other.size;
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+typename SetBTree<Data, Alloc, Compare, NodeSize>::Node* SetBTree<Data, Alloc, Compare, NodeSize>::CopyNode(const Node* node, ulong depth, Leaf*& tail) {
+  if (depth + 1 == height) {
+    const Leaf* source = static_cast<const Leaf*>(node);
+    Leaf* leaf = NewLeaf();
+    try {
+      std::copy(source->keys, source->keys + source->count, leaf->keys);
+    } catch (...) {
+      DeleteLeaf(leaf);
+      throw;
+    }
+    leaf->count = source->count;
+    leaf->prev = tail;
+    if (tail != nullptr) {
+      tail->next = leaf;
+    } else {
+      first = leaf;
+    }
+    tail = leaf;
+    return leaf;
+  }
+
+  const Inner* source = static_cast<const Inner*>(node);
+  Inner* inner = NewInner();
+  ulong copied = 0;
+  try {
+    std::copy(source->keys, source->keys + source->count - 1, inner->keys);
+    for (; copied < source->count; ++copied) {
+      inner->child[copied] = CopyNode(source->child[copied], depth + 1, tail);
+    }
+  } catch (...) {
+    for (ulong index = 0; index < copied; ++index) {
+      Destroy(inner->child[index], depth + 1);
+    }
+    DeleteInner(inner);
+    throw;
+  }
+  std::copy(source->weight, source->weight + source->count, inner->weight);
+  inner->count = source->count;
+  return inner;
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::Vacate(Data* from, Data* to) noexcept {
+  if constexpr (!std::is_trivially_copyable_v<Data>) {
+    for (; from != to; ++from) {
+      *from = Data();
+    }
+  }
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::SwapTree(SetBTree& other) noexcept {
+  std::swap(root, other.root);
+  std::swap(height, other.height);
+  std::swap(first, other.first);
+  std::swap(last, other.last);
+  std::swap(size, other.size);
+}
+
+/* ************************************************************************** */
+
+// SEARCH HELPERS
+
+// Rank: The halving steps depend only on the length, and the comparison picks the
+// half through a conditional move, so random lookups do not mispredict once per level
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+template <bool Upper>
+ulong SetBTree<Data, Alloc, Compare, NodeSize>::Rank(const Data* keys, ulong count, const Data& data) const noexcept {
+  if (count == 0) {
+    return 0;
+  }
+  const Data* base = keys;
+  while (count > 1) {
+    ulong half = count / 2;
+    bool before = Upper ? !order.Less(data, base[half - 1]) : order.Less(base[half - 1], data);
+    base = before ? base + half : base;
+    count -= half;
+  }
+  bool before = Upper ? !order.Less(data, *base) : order.Less(*base, data);
+  return (base - keys) + before;
+}
+
+// ChildIndex: Number of separators not greater than the element
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+ulong SetBTree<Data, Alloc, Compare, NodeSize>::ChildIndex(const Inner* inner, const Data& data) const noexcept {
+  return Rank<true>(inner->keys, inner->count - 1, data);
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+ulong SetBTree<Data, Alloc, Compare, NodeSize>::LowerBound(const Leaf* leaf, const Data& data) const noexcept {
+  return Rank<false>(leaf->keys, leaf->count, data);
+}
+
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+typename SetBTree<Data, Alloc, Compare, NodeSize>::Leaf* SetBTree<Data, Alloc, Compare, NodeSize>::Descend(const Data& data, Step* path) const noexcept {
+  Node* node = root;
+  for (ulong depth = 0; depth + 1 < height; ++depth) {
+    Inner* inner = static_cast<Inner*>(node);
+    ulong index = ChildIndex(inner, data);
+    if (path != nullptr) {
+      path[depth] = {inner, index};
+    }
+    node = inner->child[index];
+  }
+  return static_cast<Leaf*>(node);
+}
+
+/* ************************************************************************** */
+
+// INSERTION
+
+// InsertValue: The element, the separator of a leaf split and every node the
+// splits need are made first, so a throwing copy or allocation leaves the tree
+// untouched; the rest only moves elements and pointers
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+template <typename Value>
+bool SetBTree<Data, Alloc, Compare, NodeSize>::InsertValue(Value&& value) {
+  if (root == nullptr) {
+    Leaf* leaf = NewLeaf();
+    try {
+      leaf->keys[0] = std::forward<Value>(value);
+    } catch (...) {
+      DeleteLeaf(leaf);
+      throw;
+    }
+    leaf->count = 1;
+    root = first = last = leaf;
+    height = 1;
+    size = 1;
+    return true;
+  }
+
+  Step path[MaxHeight];
+  Leaf* leaf = Descend(value, path);
+  ulong slot = LowerBound(leaf, value);
+  if (slot < leaf->count && !order.Less(value, leaf->keys[slot])) {
+    return false;
+  }
+
+  // An overfull node of Slots + 1 entries keeps the first Half of them
+  constexpr ulong Half = (Slots + 1) / 2;
+  Data item(std::forward<Value>(value));
+  Data separator;
+  Leaf* sibling = nullptr;
+  Inner* spare[MaxHeight];
+  ulong spares = 0;
+  if (leaf->count == Slots) {
+    ulong splits = 1; // The leaf, then every full ancestor in a row
+    while (splits < height && path[height - 1 - splits].node->count == Slots) {
+      ++splits;
+    }
+    ulong inners = splits - 1 + (splits == height ? 1 : 0); // A new root above a full path
+    try {
+      sibling = NewLeaf();
+      while (spares < inners) {
+        Inner* inner = NewInner();
+        spare[spares++] = inner;
+      }
+      separator = (slot == Half) ? item : leaf->keys[(slot < Half) ? Half - 1 : Half];
+    } catch (...) {
+      while (spares > 0) {
+        DeleteInner(spare[--spares]);
+      }
+      if (sibling != nullptr) {
+        DeleteLeaf(sibling);
+      }
+      throw;
+    }
+  }
+
+  std::move_backward(leaf->keys + slot, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+  leaf->keys[slot] = std::move(item);
+  ++leaf->count;
+  ++size;
+  for (ulong depth = 0; depth + 1 < height; ++depth) {
+    ++path[depth].node->weight[path[depth].index];
+  }
+  if (sibling == nullptr) {
+    return true;
+  }
+
+  // Leaf split: the upper half moves to the new leaf, linked right after
+  std::move(leaf->keys + Half, leaf->keys + leaf->count, sibling->keys);
+  sibling->count = leaf->count - Half;
+  Vacate(leaf->keys + Half, leaf->keys + leaf->count);
+  leaf->count = Half;
+  sibling->prev = leaf;
+  sibling->next = leaf->next;
+  if (leaf->next != nullptr) {
+    leaf->next->prev = sibling;
+  } else {
+    last = sibling;
+  }
+  leaf->next = sibling;
+
+  // Each parent takes the new node after the split child, splitting in turn when overfull
+  Node* right = sibling;
+  ulong leftWeight = leaf->count;
+  ulong rightWeight = sibling->count;
+  ulong used = 0;
+  for (ulong depth = height - 1; depth-- > 0;) {
+    Inner* parent = path[depth].node;
+    ulong index = path[depth].index;
+    std::move_backward(parent->keys + index, parent->keys + parent->count - 1, parent->keys + parent->count);
+    std::move_backward(parent->child + index + 1, parent->child + parent->count, parent->child + parent->count + 1);
+    std::move_backward(parent->weight + index + 1, parent->weight + parent->count, parent->weight + parent->count + 1);
+    parent->keys[index] = std::move(separator);
+    parent->child[index + 1] = right;
+    parent->weight[index] = leftWeight;
+    parent->weight[index + 1] = rightWeight;
+    if (++parent->count <= Slots) {
+      return true;
+    }
+
+    // Inner split: the separator between the halves moves up instead of being copied
+    Inner* half = spare[used++];
+    std::move(parent->keys + Half, parent->keys + parent->count - 1, half->keys);
+    std::move(parent->child + Half, parent->child + parent->count, half->child);
+    std::move(parent->weight + Half, parent->weight + parent->count, half->weight);
+    separator = std::move(parent->keys[Half - 1]);
+    Vacate(parent->keys + Half - 1, parent->keys + parent->count - 1);
+    half->count = parent->count - Half;
+    parent->count = Half;
+    leftWeight = std::accumulate(parent->weight, parent->weight + parent->count, 0UL);
+    rightWeight = std::accumulate(half->weight, half->weight + half->count, 0UL);
+    right = half;
+  }
+
+  // The root split: a new root holds the two halves
+  Inner* top = spare[used];
+  top->keys[0] = std::move(separator);
+  top->child[0] = root;
+  top->child[1] = right;
+  top->weight[0] = leftWeight;
+  top->weight[1] = rightWeight;
+  top->count = 2;
+  root = top;
+  ++height;
+  return true;
+}
+
+/* ************************************************************************** */
+
+// REBALANCING
+
+// FixLeaf: A leaf with fewer than MinSlots elements borrows the nearest element
+// of a sibling that can spare one, or merges with a sibling. The new separator
+// is copied before anything moves, so a throwing copy leaves a valid tree.
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::FixLeaf(Inner* parent, ulong index) {
+  Leaf* node = static_cast<Leaf*>(parent->child[index]);
+
+  if (index > 0) {
+    Leaf* left = static_cast<Leaf*>(parent->child[index - 1]);
+    if (left->count > MinSlots) {
+      Data separator(left->keys[left->count - 1]);
+      std::move_backward(node->keys, node->keys + node->count, node->keys + node->count + 1);
+      node->keys[0] = std::move(left->keys[left->count - 1]);
+      ++node->count;
+      --left->count;
+      Vacate(left->keys + left->count, left->keys + left->count + 1);
+      parent->keys[index - 1] = std::move(separator);
+      --parent->weight[index - 1];
+      ++parent->weight[index];
+      return;
+    }
+  }
+
+  if (index + 1 < parent->count) {
+    Leaf* right = static_cast<Leaf*>(parent->child[index + 1]);
+    if (right->count > MinSlots) {
+      Data separator(right->keys[1]);
+      node->keys[node->count++] = std::move(right->keys[0]);
+      std::move(right->keys + 1, right->keys + right->count, right->keys);
+      --right->count;
+      Vacate(right->keys + right->count, right->keys + right->count + 1);
+      parent->keys[index] = std::move(separator);
+      ++parent->weight[index];
+      --parent->weight[index + 1];
+      return;
+    }
+  }
+
+  // Merge: the right leaf of the pair empties into the left one and is released
+  ulong pair = (index > 0) ? index : index + 1;
+  Leaf* left = static_cast<Leaf*>(parent->child[pair - 1]);
+  Leaf* right = static_cast<Leaf*>(parent->child[pair]);
+  std::move(right->keys, right->keys + right->count, left->keys + left->count);
+  left->count += right->count;
+  left->next = right->next;
+  if (right->next != nullptr) {
+    right->next->prev = left;
+  } else {
+    last = left;
+  }
+  parent->weight[pair - 1] += parent->weight[pair];
+  EraseChild(parent, pair);
+  DeleteLeaf(right);
+}
+
+// FixInner: Same for an inner node, rotating children through the parent's separator
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::FixInner(Inner* parent, ulong index) noexcept {
+  Inner* node = static_cast<Inner*>(parent->child[index]);
+
+  if (index > 0) {
+    Inner* left = static_cast<Inner*>(parent->child[index - 1]);
+    if (left->count > MinSlots) {
+      ulong moved = left->weight[left->count - 1];
+      std::move_backward(node->keys, node->keys + node->count - 1, node->keys + node->count);
+      std::move_backward(node->child, node->child + node->count, node->child + node->count + 1);
+      std::move_backward(node->weight, node->weight + node->count, node->weight + node->count + 1);
+      node->keys[0] = std::move(parent->keys[index - 1]);
+      node->child[0] = left->child[left->count - 1];
+      node->weight[0] = moved;
+      ++node->count;
+      parent->keys[index - 1] = std::move(left->keys[left->count - 2]);
+      --left->count;
+      Vacate(left->keys + left->count - 1, left->keys + left->count);
+      parent->weight[index - 1] -= moved;
+      parent->weight[index] += moved;
+      return;
+    }
+  }
+
+  if (index + 1 < parent->count) {
+    Inner* right = static_cast<Inner*>(parent->child[index + 1]);
+    if (right->count > MinSlots) {
+      ulong moved = right->weight[0];
+      node->keys[node->count - 1] = std::move(parent->keys[index]);
+      node->child[node->count] = right->child[0];
+      node->weight[node->count] = moved;
+      ++node->count;
+      parent->keys[index] = std::move(right->keys[0]);
+      std::move(right->keys + 1, right->keys + right->count - 1, right->keys);
+      std::move(right->child + 1, right->child + right->count, right->child);
+      std::move(right->weight + 1, right->weight + right->count, right->weight);
+      --right->count;
+      Vacate(right->keys + right->count - 1, right->keys + right->count);
+      parent->weight[index] += moved;
+      parent->weight[index + 1] -= moved;
+      return;
+    }
+  }
+
+  // Merge: the separator comes down between the two halves
+  ulong pair = (index > 0) ? index : index + 1;
+  Inner* left = static_cast<Inner*>(parent->child[pair - 1]);
+  Inner* right = static_cast<Inner*>(parent->child[pair]);
+  left->keys[left->count - 1] = std::move(parent->keys[pair - 1]);
+  std::move(right->keys, right->keys + right->count - 1, left->keys + left->count);
+  std::move(right->child, right->child + right->count, left->child + left->count);
+  std::move(right->weight, right->weight + right->count, left->weight + left->count);
+  left->count += right->count;
+  parent->weight[pair - 1] += parent->weight[pair];
+  EraseChild(parent, pair);
+  DeleteInner(right);
+}
+
+// EraseChild: Closes the gap left by child 'index' and the separator before it
+template <typename Data, typename Alloc, typename Compare, ulong NodeSize>
+void SetBTree<Data, Alloc, Compare, NodeSize>::EraseChild(Inner* inner, ulong index) noexcept {
+  std::move(inner->keys + index, inner->keys + inner->count - 1, inner->keys + index - 1);
+  std::move(inner->child + index + 1, inner->child + inner->count, inner->child + index);
+  std::move(inner->weight + index + 1, inner->weight + inner->count, inner->weight + index);
+  --inner->count;
+  Vacate(inner->keys + inner->count - 1, inner->keys + inner->count);
+}
+
+/* ************************************************************************** */
+
+}
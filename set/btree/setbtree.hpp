@@ -0,0 +1,334 @@
+
+/*
+ * SetBTree - B+-Tree-Based Set Implementation
+ *
+ * This file defines a Set implementation based on a B+-tree. Elements live in
+ * the leaves, which hold up to a node's worth of sorted elements in a contiguous
+ * array and are linked to their neighbours; inner nodes only route searches.
+ *
+ * Key Features:
+ * - O(log n) insertion, removal and search with few, cache-friendly node visits
+ * - O(1) access to min and max elements (first and last leaf)
+ * - O(log n) access by index, from the element counts kept in the inner nodes
+ * - In-order traversal by walking the linked leaves, without touching inner nodes
+ * - Configurable node size; by default a node spans about 256 bytes of elements
+ *
+ * Suited to large sets (millions of elements and beyond), where SetVec pays O(n)
+ * shifts per update and SetLst pays a cache miss per visited node.
+ */
+
+#ifndef SETBTREE_HPP
+#define SETBTREE_HPP
+
+/* ************************************************************************** */
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+
+#include "../set.hpp"
+#include "../../container/order.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+/*
+ * SetBTree Class - B+-Tree-Based Set Implementation
+ *
+ * Leaves hold between Slots/2 and Slots elements (the root leaf at least one),
+ * inner nodes between Slots/2 and Slots children (the root at least two). The
+ * separator between two children is a copy of the first element of the right
+ * subtree, so a search descends to the right of every separator it is not less
+ * than. Each inner node also stores the number of elements under every child.
+ *
+ * Performance Characteristics:
+ * - Insert/Remove: O(log n) - one descent, then splits or merges back up the path
+ * - Exists, Predecessor, Successor: O(log n)
+ * - Min/Max, Front/Back: O(1)
+ * - operator[]: O(log n) through the per-child element counts
+ * - Traversal: O(n), sequential over the leaf arrays
+ * - Memory: between 1x and 2x the elements, plus one inner node per Slots/2 leaves
+ *
+ * Data must be default-constructible (node arrays are built in place) and
+ * should be nothrow move-assignable: a throwing move leaves the tree unusable.
+ */
+template <typename Data, typename Alloc = std::allocator<Data>, typename Compare = std::less<Data>, ulong NodeSize = 0>
+class SetBTree : virtual public Set<Data> {
+  // Must extend Set<Data>
+
+public:
+
+  // Elements per leaf and children per inner node
+  static constexpr ulong Slots = (NodeSize != 0) ? NodeSize : std::clamp<ulong>(256 / sizeof(Data), 8, 64);
+  static_assert(Slots >= 4, "SetBTree nodes need at least 4 slots");
+
+private:
+
+  // The tree is ordered by the comparator policy; equal elements are the equivalent ones
+  [[no_unique_address]] Order<Data, Compare> order;
+
+protected:
+
+  // Import base class members for easier access
+  using Container::size; // Number of elements in the set
+
+  static constexpr ulong MinSlots = Slots / 2; // Fill below which a non-root node is rebalanced
+  static constexpr ulong MaxHeight = 64;       // Far beyond any addressable size
+
+  // Both node kinds keep one spare slot, so an insertion can overfill a node
+  // before it is split in two
+  struct Node {
+    ulong count = 0; // Elements in a leaf, children in an inner node
+  };
+
+  struct Leaf : Node {
+    Leaf* prev = nullptr;
+    Leaf* next = nullptr;
+    Data keys[Slots + 1];
+  };
+
+  struct Inner : Node {
+    Data keys[Slots];          // keys[i] separates child[i] and child[i + 1]
+    Node* child[Slots + 1];
+    ulong weight[Slots + 1];   // Elements under each child
+  };
+
+  // Inner node visited by a descent, and the child taken
+  struct Step {
+    Inner* node;
+    ulong index;
+  };
+
+  using LeafAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Leaf>;
+  using LeafTraits = std::allocator_traits<LeafAlloc>;
+  using InnerAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Inner>;
+  using InnerTraits = std::allocator_traits<InnerAlloc>;
+
+  // Move assignment only takes the nodes when the allocators propagate or always compare equal;
+  // otherwise it inserts the elements into new nodes, so it may throw
+  static constexpr bool NothrowMoveAssign = std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value
+                                         || std::allocator_traits<Alloc>::is_always_equal::value;
+
+  [[no_unique_address]] Alloc alloc; // Allocator providing the nodes (rebound to each kind)
+
+  Node* root = nullptr;
+  ulong height = 0;       // Levels of the tree (0 when empty, 1 when the root is a leaf)
+  Leaf* first = nullptr;  // Leftmost leaf (smallest elements)
+  Leaf* last = nullptr;   // Rightmost leaf (largest elements)
+
+  // Node allocation and release
+  Leaf* NewLeaf();
+  Inner* NewInner();
+  void DeleteLeaf(Leaf*) noexcept;
+  void DeleteInner(Inner*) noexcept;
+
+  // Destroy: Releases a subtree whose root sits at the given depth
+  void Destroy(Node*, ulong) noexcept;
+
+  // CopyTree: Copies the nodes of another tree into this empty one
+  void CopyTree(const SetBTree&);
+
+  // CopyNode: Deep copy of a subtree at the given depth, linking the copied
+  // leaves after the given one (released again if a copy throws)
+  Node* CopyNode(const Node*, ulong, Leaf*&);
+
+  // Vacate: Resets moved-from slots, so they do not keep resources alive
+  static void Vacate(Data*, Data*) noexcept;
+
+  // Rank: Number of leading elements of a sorted array that are less than the
+  // element (or not greater, when Upper), by a binary search without data-dependent branches
+  template <bool Upper>
+  ulong Rank(const Data*, ulong, const Data&) const noexcept;
+
+  // ChildIndex: Child of an inner node whose subtree may hold the element
+  ulong ChildIndex(const Inner*, const Data&) const noexcept;
+
+  // LowerBound: First slot of a leaf whose element is not less than the given one
+  ulong LowerBound(const Leaf*, const Data&) const noexcept;
+
+  // Descend: Leaf whose range covers the element (the tree must not be empty),
+  // recording the inner nodes along the way when a path is given
+  Leaf* Descend(const Data&, Step*) const noexcept;
+
+  // InsertValue: Places a new element in its leaf unless an equivalent one exists,
+  // splitting full nodes up the path
+  template <typename Value>
+  bool InsertValue(Value&&);
+
+  // FixLeaf/FixInner: Refills the underfull child of an inner node by borrowing
+  // from a sibling, or merges it with one
+  void FixLeaf(Inner*, ulong);
+  void FixInner(Inner*, ulong) noexcept;
+
+  // EraseChild: Removes a child of an inner node together with the separator before it
+  static void EraseChild(Inner*, ulong) noexcept;
+
+  // SwapTree: Exchanges the nodes (not the allocators) with another tree
+  void SwapTree(SetBTree&) noexcept;
+
+public:
+
+  // Default constructor: Creates an empty set
+  SetBTree() = default;
+
+  // Allocator constructor: Creates an empty set whose nodes come from the given allocator
+  explicit SetBTree(const Alloc&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific constructors for creating sets from existing containers
+
+  SetBTree(const TraversableContainer<Data>& container, const Alloc& allocator = Alloc()); // Creates set by inserting all elements from traversable container
+  SetBTree(MappableContainer<Data>&& container, const Alloc& allocator = Alloc()); // Creates set by moving/inserting all elements from mappable container
+
+  /* ************************************************************************ */
+
+  // Copy constructor: Copies the tree node by node, keeping its shape
+  SetBTree(const SetBTree& other);
+
+  // Move constructor: Takes over the other tree's nodes
+  SetBTree(SetBTree&& other) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor: Releases every node
+  virtual ~SetBTree();
+
+  /* ************************************************************************ */
+
+  // Assignment operators for copying and moving set contents
+
+  SetBTree& operator=(const SetBTree& other); // Copy assignment with deep copying
+  SetBTree& operator=(SetBTree&& other) noexcept(NothrowMoveAssign); // Move assignment with resource transfer
+
+  /* ************************************************************************ */
+
+  // Comparison operators for structural equality testing
+
+  bool operator==(const SetBTree& other) const noexcept; // Returns true if sets contain same elements
+  bool operator!=(const SetBTree& other) const noexcept; // Returns true if sets differ in content
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override; // Removes all elements and releases every node
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const Data& data) const noexcept override; // Tests if element exists in set (O(log n))
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from OrderedDictionaryContainer)
+
+  const Data& Min() const override; // Returns reference to smallest element (first leaf)
+  Data MinNRemove() override; // Returns copy of smallest element and removes it
+  void RemoveMin() override; // Removes the smallest element from the set
+
+  const Data& Max() const override; // Returns reference to largest element (last leaf)
+  Data MaxNRemove() override; // Returns copy of largest element and removes it
+  void RemoveMax() override; // Removes the largest element from the set
+
+  const Data& Predecessor(const Data& data) const override; // Finds largest element < data
+  Data PredecessorNRemove(const Data& data) override; // Returns and removes largest element < data
+  void RemovePredecessor(const Data& data) override; // Removes largest element < data
+
+  const Data& Successor(const Data& data) const override; // Finds smallest element > data
+  Data SuccessorNRemove(const Data& data) override; // Returns and removes smallest element > data
+  void RemoveSuccessor(const Data& data) override; // Removes smallest element > data
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  bool Insert(const Data& data) override; // Inserts element in its leaf (copy semantics)
+  bool Insert(Data&& data) override; // Inserts element in its leaf (move semantics)
+  bool Remove(const Data& data) override; // Removes specified element if it exists
+
+  // Bulk operations for multiple elements, one element at a time
+  bool InsertAll(const TraversableContainer<Data>& container) override; // True if every element was inserted
+  bool InsertAll(MappableContainer<Data>&& container) override; // True if every element was inserted (move version)
+  bool RemoveAll(const TraversableContainer<Data>& container) override; // True if every element was removed
+
+  bool InsertSome(const TraversableContainer<Data>& container) override; // True if any element was inserted
+  bool InsertSome(MappableContainer<Data>&& container) override; // True if any element was inserted (move version)
+  bool RemoveSome(const TraversableContainer<Data>& container) override; // True if any element was removed
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](ulong index) const override; // Element of the given rank (std::out_of_range if invalid)
+  const Data& Front() const override; // Smallest element (std::length_error when empty)
+  const Data& Back() const override; // Largest element (std::length_error when empty)
+
+  /* ************************************************************************ */
+
+  // Traversals walk the linked leaves (forward for Traverse and PreOrder, backward for PostOrder)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+  using typename TraversableContainer<Data>::PredicateFun;
+
+  void Traverse(TraverseFun fun) const override;
+  void PreOrderTraverse(TraverseFun fun) const override;
+  void PostOrderTraverse(TraverseFun fun) const override;
+
+  bool TraverseWhile(PredicateFun fun) const override;
+  bool PreOrderTraverseWhile(PredicateFun fun) const override;
+  bool PostOrderTraverseWhile(PredicateFun fun) const override;
+
+  /* ************************************************************************ */
+
+  // Forward iteration in ascending order over the linked leaves
+
+  class const_iterator {
+  private:
+    const Leaf* leaf = nullptr;
+    ulong slot = 0;
+    friend class SetBTree;
+    const_iterator(const Leaf* node, ulong index) noexcept : leaf(node), slot(index) {}
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Data;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Data*;
+    using reference = const Data&;
+
+    const_iterator() = default;
+    reference operator*() const noexcept { return leaf->keys[slot]; }
+    pointer operator->() const noexcept { return &leaf->keys[slot]; }
+    const_iterator& operator++() noexcept {
+      if (++slot == leaf->count) { leaf = leaf->next; slot = 0; }
+      return *this;
+    }
+    const_iterator operator++(int) noexcept { const_iterator old = *this; ++*this; return old; }
+    bool operator==(const const_iterator&) const = default;
+  };
+
+  const_iterator begin() const noexcept { return const_iterator(first, 0); }
+  const_iterator end() const noexcept { return const_iterator(); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  /* ************************************************************************ */
+
+  // Allocator access
+
+  // GetAllocator() - Returns a copy of the allocator (rebound to Data)
+  Alloc GetAllocator() const noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "setbtree.cpp"
+
+#endif
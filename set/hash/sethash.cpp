@@ -0,0 +1,493 @@
+
+/*
+ * SetHash Implementation File
+ *
+ * This file contains the implementation of the SetHash class, an open-addressing
+ * hash table with linear probing over groups of control bytes and deletion by
+ * backward shifting.
+ *
+ * Implementation highlights:
+ * - Lookups compare a whole group of tags per step, and check only the slots
+ *   before the first empty one
+ * - Insertions fill the first empty slot of the probe, which ends the run
+ * - Removals close the gap by moving later elements of the run back
+ * - Rehashes place elements without comparing them, since they are distinct
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// SETHASH CONSTRUCTORS AND INITIALIZATION
+
+// Allocator constructor: Empty set drawing its table from the given allocator
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+SetHash<Data, Alloc, Hash, KeyEqual>::SetHash(const Alloc& allocator) noexcept : alloc(allocator) {}
+
+// Functor constructor: Empty set with the given hash and equality
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+SetHash<Data, Alloc, Hash, KeyEqual>::SetHash(const Hash& hash, const KeyEqual& keyEqual, const Alloc& allocator)
+  : hasher(hash), equal(keyEqual), alloc(allocator) {}
+
+// Constructor from TraversableContainer: The table is sized for the whole container
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+SetHash<Data, Alloc, Hash, KeyEqual>::SetHash(const TraversableContainer<Data>& container, const Alloc& allocator) : alloc(allocator) {
+  InsertAll(container);
+}
+
+// Constructor from MappableContainer: Moves every element in, then clears the source
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+SetHash<Data, Alloc, Hash, KeyEqual>::SetHash(MappableContainer<Data>&& container, const Alloc& allocator) : alloc(allocator) {
+  InsertAll(std::move(container));
+
+  if (dynamic_cast<ClearableContainer*>(&container) != nullptr) {
+    dynamic_cast<ClearableContainer*>(&container)->Clear();
+  }
+}
+
+// Copy constructor: Same slots as the other table, so nothing is hashed again
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+SetHash<Data, Alloc, Hash, KeyEqual>::SetHash(const SetHash& other)
+  : hasher(other.hasher), equal(other.equal),
+    alloc(DataTraits::select_on_container_copy_construction(other.alloc)) {
+  CopyTable(other);
+}
+
+// Move constructor: Takes the table and leaves the other set empty
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+SetHash<Data, Alloc, Hash, KeyEqual>::SetHash(SetHash&& other) noexcept
+  : hasher(other.hasher), equal(other.equal), alloc(other.alloc) {
+  SwapTable(other);
+}
+
+// Destructor: Destroys the elements and frees the table
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+SetHash<Data, Alloc, Hash, KeyEqual>::~SetHash() {
+  Release();
+}
+
+/* ************************************************************************** */
+
+// ASSIGNMENT OPERATORS
+
+// Copy assignment: Builds the copy aside, then swaps it in (strong guarantee)
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+SetHash<Data, Alloc, Hash, KeyEqual>& SetHash<Data, Alloc, Hash, KeyEqual>::operator=(const SetHash& other) {
+  if (this != &other) {
+    constexpr bool propagate = DataTraits::propagate_on_container_copy_assignment::value;
+    SetHash copy(other.hasher, other.equal, propagate ? other.alloc : alloc);
+    copy.CopyTable(other);
+    SwapTable(copy);
+    std::swap(hasher, copy.hasher);
+    std::swap(equal, copy.equal);
+    if constexpr (propagate) {
+      std::swap(alloc, copy.alloc); // The old table leaves with the allocator that made it
+    }
+  }
+  return *this;
+}
+
+// Move assignment: Takes the table when the allocators allow it, moves the elements otherwise
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+SetHash<Data, Alloc, Hash, KeyEqual>& SetHash<Data, Alloc, Hash, KeyEqual>::operator=(SetHash&& other) noexcept(NothrowMoveAssign) {
+  if (this != &other) {
+    Release();
+    hasher = other.hasher;
+    equal = other.equal;
+    if constexpr (DataTraits::propagate_on_container_move_assignment::value) {
+      alloc = other.alloc;
+      SwapTable(other);
+    } else {
+      if (alloc == other.alloc) {
+        SwapTable(other);
+      } else {
+        Reserve(other.size);
+        for (ulong slot = 0; slot < other.capacity; ++slot) {
+          if (other.control[slot] != EmptySlot) {
+            Insert(std::move(other.slots[slot]));
+          }
+        }
+        other.Release();
+      }
+    }
+  }
+  return *this;
+}
+
+/* ************************************************************************** */
+
+// COMPARISON OPERATORS
+
+// Equality: Same size, and every element of the other set found in this one
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+bool SetHash<Data, Alloc, Hash, KeyEqual>::operator==(const SetHash& other) const noexcept {
+  if (size != other.size) {
+    return false;
+  }
+  for (ulong slot = 0; slot < other.capacity; ++slot) {
+    if (other.control[slot] != EmptySlot && !Exists(other.slots[slot])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+bool SetHash<Data, Alloc, Hash, KeyEqual>::operator!=(const SetHash& other) const noexcept {
+  return !(*this == other);
+}
+
+/* ************************************************************************** */
+
+// CLEARABLE AND TESTABLE CONTAINER
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+void SetHash<Data, Alloc, Hash, KeyEqual>::Clear() {
+  Release();
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+bool SetHash<Data, Alloc, Hash, KeyEqual>::Exists(const Data& data) const noexcept {
+  if (size == 0) {
+    return false;
+  }
+  return Find(data, HashOf(data), nullptr) != capacity;
+}
+
+/* ************************************************************************** */
+
+// DICTIONARY OPERATIONS
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+bool SetHash<Data, Alloc, Hash, KeyEqual>::Insert(const Data& data) {
+  return InsertValue(data);
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+bool SetHash<Data, Alloc, Hash, KeyEqual>::Insert(Data&& data) {
+  return InsertValue(std::move(data));
+}
+
+// Remove: Backward shift over the rest of the run. An element moves into the
+// hole when its home is not after the hole (cyclically), that is when the hole
+// lies on its probe path; the emptied slot then becomes the new hole.
+// The element may live in this set: it is only read before the shift.
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+bool SetHash<Data, Alloc, Hash, KeyEqual>::Remove(const Data& data) {
+  if (size == 0) {
+    return false;
+  }
+  ulong hole = Find(data, HashOf(data), nullptr);
+  if (hole == capacity) {
+    return false;
+  }
+  const ulong mask = capacity - 1;
+  for (ulong next = (hole + 1) & mask; control[next] != EmptySlot; next = (next + 1) & mask) {
+    ulong home = Home(HashOf(slots[next]));
+    if (((next - home) & mask) >= ((next - hole) & mask)) {
+      slots[hole] = std::move(slots[next]);
+      SetControl(hole, control[next]);
+      hole = next;
+    }
+  }
+  DataTraits::destroy(alloc, slots + hole);
+  SetControl(hole, EmptySlot);
+  --size;
+  return true;
+}
+
+// Bulk insertions: One Reserve for the whole container (an upper bound when it
+// holds duplicates), then the DictionaryContainer semantics element by element
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+bool SetHash<Data, Alloc, Hash, KeyEqual>::InsertAll(const TraversableContainer<Data>& container) {
+  Reserve(size + container.Size());
+  return DictionaryContainer<Data>::InsertAll(container);
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+bool SetHash<Data, Alloc, Hash, KeyEqual>::InsertAll(MappableContainer<Data>&& container) {
+  Reserve(size + container.Size());
+  return DictionaryContainer<Data>::InsertAll(std::move(container));
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+bool SetHash<Data, Alloc, Hash, KeyEqual>::RemoveAll(const TraversableContainer<Data>& container) {
+  return DictionaryContainer<Data>::RemoveAll(container);
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+bool SetHash<Data, Alloc, Hash, KeyEqual>::InsertSome(const TraversableContainer<Data>& container) {
+  Reserve(size + container.Size());
+  return DictionaryContainer<Data>::InsertSome(container);
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+bool SetHash<Data, Alloc, Hash, KeyEqual>::InsertSome(MappableContainer<Data>&& container) {
+  Reserve(size + container.Size());
+  return DictionaryContainer<Data>::InsertSome(std::move(container));
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+bool SetHash<Data, Alloc, Hash, KeyEqual>::RemoveSome(const TraversableContainer<Data>& container) {
+  return DictionaryContainer<Data>::RemoveSome(container);
+}
+
+/* ************************************************************************** */
+
+// TRAVERSAL IN TABLE ORDER
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+void SetHash<Data, Alloc, Hash, KeyEqual>::Traverse(TraverseFun fun) const {
+  for (ulong slot = 0; slot < capacity; ++slot) {
+    if (control[slot] != EmptySlot) {
+      fun(slots[slot]);
+    }
+  }
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+bool SetHash<Data, Alloc, Hash, KeyEqual>::TraverseWhile(PredicateFun fun) const {
+  for (ulong slot = 0; slot < capacity; ++slot) {
+    if (control[slot] != EmptySlot && !fun(slots[slot])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* ************************************************************************** */
+
+// CAPACITY MANAGEMENT
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+ulong SetHash<Data, Alloc, Hash, KeyEqual>::Capacity() const noexcept {
+  return capacity;
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+void SetHash<Data, Alloc, Hash, KeyEqual>::Reserve(ulong count) {
+  ulong needed = CapacityFor(count);
+  if (count > 0 && needed > capacity) {
+    Rehash(needed);
+  }
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+void SetHash<Data, Alloc, Hash, KeyEqual>::ShrinkToFit() {
+  if (size == 0) {
+    Release();
+  } else if (CapacityFor(size) < capacity) {
+    Rehash(CapacityFor(size));
+  }
+}
+
+/* ************************************************************************** */
+
+// ALLOCATOR ACCESS
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+Alloc SetHash<Data, Alloc, Hash, KeyEqual>::GetAllocator() const noexcept {
+  return alloc;
+}
+
+/* ************************************************************************** */
+
+// HASHING AND PROBING
+
+// Mix: Xor-shift and multiply, so both the home bits (high) and the tag bits
+// (low) depend on every input bit
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+ulong SetHash<Data, Alloc, Hash, KeyEqual>::Mix(ulong hash) noexcept {
+  hash ^= hash >> 33;
+  hash *= 0xFF51AFD7ED558CCDUL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+ulong SetHash<Data, Alloc, Hash, KeyEqual>::HashOf(const Data& data) const noexcept {
+  return Mix(static_cast<ulong>(hasher(data)));
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+ulong SetHash<Data, Alloc, Hash, KeyEqual>::Home(ulong hash) const noexcept {
+  return (hash >> 7) & (capacity - 1);
+}
+
+// Find: Tags matching before the first empty slot of a group are candidates;
+// an empty slot ends the run, so the search stops at that group
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+ulong SetHash<Data, Alloc, Hash, KeyEqual>::Find(const Data& data, ulong hash, ulong* hole) const noexcept {
+  const ulong mask = capacity - 1;
+  const unsigned char tag = static_cast<unsigned char>(hash & 0x7F);
+  ulong start = Home(hash);
+  while (true) {
+    unsigned match = simd::MatchByte(control + start, tag);
+    unsigned empty = simd::MatchByte(control + start, EmptySlot);
+    if (empty != 0) {
+      match &= (empty & (0U - empty)) - 1;
+    }
+    while (match != 0) {
+      ulong slot = (start + std::countr_zero(match)) & mask;
+      if (equal(slots[slot], data)) {
+        return slot;
+      }
+      match &= match - 1;
+    }
+    if (empty != 0) {
+      if (hole != nullptr) {
+        *hole = (start + std::countr_zero(empty)) & mask;
+      }
+      return capacity;
+    }
+    start = (start + Group) & mask;
+  }
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+ulong SetHash<Data, Alloc, Hash, KeyEqual>::Vacancy(ulong hash) const noexcept {
+  const ulong mask = capacity - 1;
+  ulong start = Home(hash);
+  while (true) {
+    unsigned empty = simd::MatchByte(control + start, EmptySlot);
+    if (empty != 0) {
+      return (start + std::countr_zero(empty)) & mask;
+    }
+    start = (start + Group) & mask;
+  }
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+void SetHash<Data, Alloc, Hash, KeyEqual>::SetControl(ulong slot, unsigned char value) noexcept {
+  control[slot] = value;
+  if (slot < Group - 1) {
+    control[capacity + slot] = value;
+  }
+}
+
+// CapacityFor: Doubles from the minimum until 7/8 of the slots hold the elements
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+ulong SetHash<Data, Alloc, Hash, KeyEqual>::CapacityFor(ulong count) noexcept {
+  ulong slotCount = MinCapacity;
+  while (slotCount - slotCount / 8 < count) {
+    slotCount *= 2;
+  }
+  return slotCount;
+}
+
+/* ************************************************************************** */
+
+// TABLE MANAGEMENT
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+void SetHash<Data, Alloc, Hash, KeyEqual>::Allocate(ulong slotCount) {
+  ByteAlloc bytes(alloc);
+  Data* newSlots = DataTraits::allocate(alloc, slotCount);
+  unsigned char* newControl;
+  try {
+    newControl = ByteTraits::allocate(bytes, slotCount + Group - 1);
+  } catch (...) {
+    DataTraits::deallocate(alloc, newSlots, slotCount);
+    throw;
+  }
+  std::memset(newControl, EmptySlot, slotCount + Group - 1);
+  slots = newSlots;
+  control = newControl;
+  capacity = slotCount;
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+void SetHash<Data, Alloc, Hash, KeyEqual>::Release() noexcept {
+  if (capacity == 0) {
+    return;
+  }
+  if constexpr (!std::is_trivially_destructible_v<Data>) {
+    for (ulong slot = 0; slot < capacity; ++slot) {
+      if (control[slot] != EmptySlot) {
+        DataTraits::destroy(alloc, slots + slot);
+      }
+    }
+  }
+  ByteAlloc bytes(alloc);
+  ByteTraits::deallocate(bytes, control, capacity + Group - 1);
+  DataTraits::deallocate(alloc, slots, capacity);
+  slots = nullptr;
+  control = nullptr;
+  capacity = 0;
+  size = 0;
+}
+
+// CopyTable: Copies every element into the same slot of a table of the same capacity
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+void SetHash<Data, Alloc, Hash, KeyEqual>::CopyTable(const SetHash& other) {
+  if (other.size == 0) {
+    return;
+  }
+  Allocate(other.capacity);
+  try {
+    for (ulong slot = 0; slot < capacity; ++slot) {
+      if (other.control[slot] != EmptySlot) {
+        DataTraits::construct(alloc, slots + slot, other.slots[slot]);
+        SetControl(slot, other.control[slot]);
+        ++size;
+      }
+    }
+  } catch (...) {
+    Release();
+    throw;
+  }
+}
+
+// Rehash: Builds the new table in a temporary set sharing the allocator and functors
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+void SetHash<Data, Alloc, Hash, KeyEqual>::Rehash(ulong slotCount) {
+  SetHash fresh(hasher, equal, alloc);
+  fresh.Allocate(slotCount);
+  for (ulong slot = 0; slot < capacity; ++slot) {
+    if (control[slot] != EmptySlot) {
+      ulong hash = HashOf(slots[slot]);
+      ulong target = fresh.Vacancy(hash);
+      DataTraits::construct(fresh.alloc, fresh.slots + target, std::move_if_noexcept(slots[slot]));
+      fresh.SetControl(target, static_cast<unsigned char>(hash & 0x7F));
+      ++fresh.size;
+    }
+  }
+  SwapTable(fresh);
+}
+
+// InsertValue: The probe that rules out a duplicate also yields the empty slot
+// ending the run; a full table is grown (doubled) and probed again
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+template <typename Value>
+bool SetHash<Data, Alloc, Hash, KeyEqual>::InsertValue(Value&& value) {
+  ulong hash = HashOf(value);
+  ulong hole = 0;
+  if (capacity != 0 && Find(value, hash, &hole) != capacity) {
+    return false;
+  }
+  if (capacity == 0 || size + 1 > capacity - capacity / 8) {
+    Rehash(std::max(CapacityFor(size + 1), capacity * 2));
+    hole = Vacancy(hash);
+  }
+  DataTraits::construct(alloc, slots + hole, std::forward<Value>(value));
+  SetControl(hole, static_cast<unsigned char>(hash & 0x7F));
+  ++size;
+  return true;
+}
+
+template <typename Data, typename Alloc, typename Hash, typename KeyEqual>
+void SetHash<Data, Alloc, Hash, KeyEqual>::SwapTable(SetHash& other) noexcept {
+  std::swap(slots, other.slots);
+  std::swap(control, other.control);
+  std::swap(capacity, other.capacity);
+  std::swap(size, other.size);
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,248 @@
+
+/*
+ * SetHash - Hash-Based Dictionary Implementation
+ *
+ * This file defines an unordered dictionary of unique elements based on an
+ * open-addressing hash table. Unlike SetVec, SetLst and SetBTree it keeps no
+ * order, so it implements DictionaryContainer<Data> (with traversal and
+ * clearing) rather than Set<Data>.
+ *
+ * Key Features:
+ * - Expected O(1) insertion, removal and search
+ * - One control byte per slot (empty, or 7 bits of the element's hash), compared
+ *   a group at a time with the simd byte-group kernel
+ * - Deletion by backward shifting: no tombstones, so lookups never slow down
+ *   after many removals and the table never needs a cleanup rehash
+ * - Configurable hash and equality functors, Reserve/ShrinkToFit capacity control
+ *
+ * Suited to lookups that need no ordering (membership tests, deduplication).
+ */
+
+#ifndef SETHASH_HPP
+#define SETHASH_HPP
+
+/* ************************************************************************** */
+
+#include <functional>
+#include <memory>
+
+#include "../../container/container.hpp"
+#include "../../container/dictionary.hpp"
+#include "../../container/traversable.hpp"
+#include "../../simd/simd.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+/*
+ * SetHash Class - Open-Addressing Hash Set
+ *
+ * The table has a power-of-two number of slots, at most 7/8 of them full. An
+ * element's mixed hash picks its home slot (high bits) and its tag (low 7 bits).
+ * Probing is linear: a lookup reads the GroupWidth control bytes from the home
+ * slot on, checks the slots whose tag matches, and stops at the first group with
+ * an empty slot. The control array repeats its first GroupWidth - 1 bytes after
+ * the end, so a group starting near the end wraps without a second load.
+ *
+ * Removal empties the slot, then moves back every following element of the run
+ * whose home lies at or before the hole, until the next empty slot. Linear
+ * probing then never meets a gap inside a run, with no deleted markers.
+ *
+ * Performance Characteristics:
+ * - Insert/Remove/Exists: expected O(1); a rehash (O(n)) doubles the table when full
+ * - Traversal: O(capacity), in table order (unspecified)
+ * - Memory: between 8/7 and 16/7 slots per element, plus one control byte per slot
+ *
+ * Elements are moved during rehashes and backward shifts, so references to them
+ * are invalidated by any insertion or removal.
+ */
+template <typename Data, typename Alloc = std::allocator<Data>, typename Hash = std::hash<Data>, typename KeyEqual = std::equal_to<Data>>
+class SetHash : virtual public DictionaryContainer<Data>,
+                virtual public TraversableContainer<Data>,
+                virtual public ClearableContainer {
+  // Must extend DictionaryContainer<Data>,
+  //             TraversableContainer<Data>,
+  //             ClearableContainer
+
+private:
+
+  [[no_unique_address]] Hash hasher;
+  [[no_unique_address]] KeyEqual equal;
+
+protected:
+
+  // Import base class members for easier access
+  using Container::size; // Number of elements in the set
+
+  static constexpr unsigned char EmptySlot = 0x80;           // Control byte of an empty slot (tags are below 0x80)
+  static constexpr ulong Group = simd::GroupWidth;              // Control bytes compared at once
+  static constexpr ulong MinCapacity = simd::GroupWidth;        // A group never sees a slot twice
+
+  using DataTraits = std::allocator_traits<Alloc>;
+  using ByteAlloc = typename DataTraits::template rebind_alloc<unsigned char>;
+  using ByteTraits = std::allocator_traits<ByteAlloc>;
+
+  // Move assignment only takes the table when the allocators propagate or always compare equal;
+  // otherwise it rehashes the elements into a new table, so it may throw
+  static constexpr bool NothrowMoveAssign = DataTraits::propagate_on_container_move_assignment::value || DataTraits::is_always_equal::value;
+
+  [[no_unique_address]] Alloc alloc; // Allocator providing the slots (rebound for the control bytes)
+
+  Data* slots = nullptr;            // Uninitialized storage; only full slots hold an element
+  unsigned char* control = nullptr; // capacity + Group - 1 bytes, the last ones mirroring the first
+  ulong capacity = 0;               // Number of slots (0 or a power of two)
+
+  // Mix: Spreads the bits of a hash, so identity hashes of integers probe well
+  static ulong Mix(ulong) noexcept;
+
+  // HashOf: Mixed hash of an element
+  ulong HashOf(const Data&) const noexcept;
+
+  // Home: Slot where the probe for a hash starts
+  ulong Home(ulong) const noexcept;
+
+  // Find: Slot holding an element equal to the given one, or capacity if none;
+  // when absent, 'hole' receives the empty slot where it would be inserted
+  ulong Find(const Data&, ulong, ulong*) const noexcept;
+
+  // Vacancy: First empty slot of the probe for a hash
+  ulong Vacancy(ulong) const noexcept;
+
+  // SetControl: Writes a control byte and its mirror
+  void SetControl(ulong, unsigned char) noexcept;
+
+  // CapacityFor: Smallest table holding the given number of elements
+  static ulong CapacityFor(ulong) noexcept;
+
+  // Allocate: Empty table of the given capacity (this set must own no table)
+  void Allocate(ulong);
+
+  // Release: Destroys the elements and frees the table
+  void Release() noexcept;
+
+  // CopyTable: Copies another set's table slot by slot (this set must own no table)
+  void CopyTable(const SetHash&);
+
+  // Rehash: Moves the elements into a table of the given capacity
+  // (copies them if their move may throw, keeping the old table on failure)
+  void Rehash(ulong);
+
+  // InsertValue: Places a new element in its probe run unless an equal one exists
+  template <typename Value>
+  bool InsertValue(Value&&);
+
+  // SwapTable: Exchanges the tables (not the allocators or functors) with another set
+  void SwapTable(SetHash&) noexcept;
+
+public:
+
+  // Default constructor: Creates an empty set (no table until the first insertion)
+  SetHash() = default;
+
+  // Allocator constructor: Creates an empty set whose table comes from the given allocator
+  explicit SetHash(const Alloc&) noexcept;
+
+  // Functor constructor: Creates an empty set with the given hash and equality
+  explicit SetHash(const Hash&, const KeyEqual& = KeyEqual(), const Alloc& = Alloc());
+
+  /* ************************************************************************ */
+
+  // Specific constructors for creating sets from existing containers
+
+  SetHash(const TraversableContainer<Data>& container, const Alloc& allocator = Alloc()); // Inserts all elements, sizing the table once
+  SetHash(MappableContainer<Data>&& container, const Alloc& allocator = Alloc()); // Moves all elements in, sizing the table once
+
+  /* ************************************************************************ */
+
+  // Copy constructor: Copies the table slot by slot, without rehashing
+  SetHash(const SetHash& other);
+
+  // Move constructor: Takes over the other set's table
+  SetHash(SetHash&& other) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor: Destroys the elements and frees the table
+  virtual ~SetHash();
+
+  /* ************************************************************************ */
+
+  // Assignment operators for copying and moving set contents
+
+  SetHash& operator=(const SetHash& other); // Copy assignment with deep copying
+  SetHash& operator=(SetHash&& other) noexcept(NothrowMoveAssign); // Move assignment with resource transfer
+
+  /* ************************************************************************ */
+
+  // Comparison operators: equal when both sets hold the same elements, in any slot
+
+  bool operator==(const SetHash& other) const noexcept;
+  bool operator!=(const SetHash& other) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override; // Removes all elements and frees the table
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const Data& data) const noexcept override; // Tests if element exists in set (expected O(1))
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  bool Insert(const Data& data) override; // Inserts element unless present (copy semantics)
+  bool Insert(Data&& data) override; // Inserts element unless present (move semantics)
+  bool Remove(const Data& data) override; // Removes element, shifting its run back
+
+  // Bulk operations: insertions reserve room for the whole container first
+  bool InsertAll(const TraversableContainer<Data>& container) override; // True if every element was inserted
+  bool InsertAll(MappableContainer<Data>&& container) override; // True if every element was inserted (move version)
+  bool RemoveAll(const TraversableContainer<Data>& container) override; // True if every element was removed
+
+  bool InsertSome(const TraversableContainer<Data>& container) override; // True if any element was inserted
+  bool InsertSome(MappableContainer<Data>&& container) override; // True if any element was inserted (move version)
+  bool RemoveSome(const TraversableContainer<Data>& container) override; // True if any element was removed
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from TraversableContainer)
+  // Elements are visited in table order, which depends on the hashes and the history
+
+  using typename TraversableContainer<Data>::TraverseFun;
+  using typename TraversableContainer<Data>::PredicateFun;
+
+  void Traverse(TraverseFun fun) const override;
+  bool TraverseWhile(PredicateFun fun) const override;
+
+  /* ************************************************************************ */
+
+  // Capacity management
+
+  ulong Capacity() const noexcept; // Number of slots (elements fit up to 7/8 of them)
+  void Reserve(ulong); // Grows the table to hold at least the given number of elements without rehashing
+  void ShrinkToFit(); // Rehashes into the smallest table holding the current elements
+
+  /* ************************************************************************ */
+
+  // Allocator access
+
+  // GetAllocator() - Returns a copy of the allocator
+  Alloc GetAllocator() const noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "sethash.cpp"
+
+#endif
@@ -17,6 +17,11 @@
 #include <stdexcept>
 #include <string>
 #include <random>
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstdint>
+#include <utility>
 
 namespace lasd {
 
@@ -25,9 +30,13 @@ namespace lasd {
 // SETLST CONSTRUCTORS AND INITIALIZATION
 // These constructors create sets from various data sources while maintaining sorted order
 
+// Allocator constructor: Empty set drawing its nodes from the given allocator
+template <typename Data, typename Alloc, typename Compare>
+SetLst<Data, Alloc, Compare>::SetLst(const Alloc& allocator) noexcept : List<Data, Alloc>(allocator), express(allocator), filter(allocator) {}
+
 // Constructor from TraversableContainer: Creates set by copying elements in sorted order
-template <typename Data>
-SetLst<Data>::SetLst(const TraversableContainer<Data>& container) {
+template <typename Data, typename Alloc, typename Compare>
+SetLst<Data, Alloc, Compare>::SetLst(const TraversableContainer<Data>& container, const Alloc& allocator) : List<Data, Alloc>(allocator), express(allocator), filter(allocator) {
   // Use container's traverse function to visit each element
   // Insert function ensures elements are placed in correct sorted position
   container.Traverse([this](const Data& item) {
@@ -36,8 +45,8 @@ SetLst<Data>::SetLst(const TraversableContainer<Data>& container) {
 }
 
 // Constructor from MappableContainer: Creates set by moving elements for efficiency
-template <typename Data>
-SetLst<Data>::SetLst(MappableContainer<Data>&& container) {
+template <typename Data, typename Alloc, typename Compare>
+SetLst<Data, Alloc, Compare>::SetLst(MappableContainer<Data>&& container, const Alloc& allocator) : List<Data, Alloc>(allocator), express(allocator), filter(allocator) {
   // Use container's map function to access elements for moving
   container.Map([this](Data& item) {
     Insert(std::move(item)); // Move elements to avoid unnecessary copying
@@ -56,21 +65,25 @@ SetLst<Data>::SetLst(MappableContainer<Data>&& container) {
 // Handle creating new SetLst instances from existing ones
 
 // Copy constructor: Creates a deep copy while preserving sorted order
-template <typename Data>
-SetLst<Data>::SetLst(const SetLst& other) : List<Data>() {
-  // Since the source is already sorted, we can traverse and insert sequentially
-  // This maintains the sorted order in the new set
-  auto current = other.head;
-  while (current != nullptr) {
-    Insert(current->element); // Insert maintains order and prevents duplicates
-    current = current->next;
+template <typename Data, typename Alloc, typename Compare>
+SetLst<Data, Alloc, Compare>::SetLst(const SetLst& other)
+  : List<Data, Alloc>(std::allocator_traits<Alloc>::select_on_container_copy_construction(other.GetAllocator())),
+    indexEnabled(other.indexEnabled), indexSeed(other.indexSeed), express(this->GetAllocator()), filterEnabled(other.filterEnabled), filter(other.filter) {
+  // Since the source is already sorted, its elements are appended in order
+  // The lanes are built by the first search; the filter already holds the same elements
+  for (auto current = other.head; current != nullptr; current = current->next) {
+    this->InsertAtBack(current->element);
   }
 }
 
 // Move constructor: Efficiently transfers ownership from another SetLst
-template <typename Data>
-SetLst<Data>::SetLst(SetLst&& other) noexcept : List<Data>(std::move(other)) {
+template <typename Data, typename Alloc, typename Compare>
+SetLst<Data, Alloc, Compare>::SetLst(SetLst&& other) noexcept
+  : List<Data, Alloc>(std::move(other)), indexEnabled(other.indexEnabled), indexSeed(other.indexSeed),
+    express(std::exchange(other.express, ExpressLanes(other.GetAllocator()))), finger(std::exchange(other.finger, nullptr)),
+    filterEnabled(other.filterEnabled), filter(std::move(other.filter)) {
   // List's move constructor handles the transfer of nodes, size, head, and tail
+  // The lanes and the finger point at those nodes, so they move with them
   // The moved-from object becomes empty but valid
 }
 
@@ -80,28 +93,41 @@ SetLst<Data>::SetLst(SetLst&& other) noexcept : List<Data>(std::move(other)) {
 // Handle assignment of SetLst contents from other SetLst instances
 
 // Copy assignment: Replaces current content with deep copy of another set
-template <typename Data>
-SetLst<Data>& SetLst<Data>::operator=(const SetLst& other) {
-  // Protect against self-assignment which would be destructive
+template <typename Data, typename Alloc, typename Compare>
+SetLst<Data, Alloc, Compare>& SetLst<Data, Alloc, Compare>::operator=(const SetLst& other) {
+  // The source is already sorted, so List's in-order copy (which also handles
+  // allocator propagation) yields a valid set
   if (this != &other) {
-    // Clear current contents to start fresh
-    Clear();
-    
-    // Copy all elements from source set in order
-    auto current = other.head;
-    while (current != nullptr) {
-      Insert(current->element); // Maintains sorted order
-      current = current->next;
-    }
+    List<Data, Alloc>::operator=(other);
+    indexEnabled = other.indexEnabled;
+    indexSeed = other.indexSeed;
+    filterEnabled = other.filterEnabled;
+    filter = BloomFilter<Data, Alloc>(other.filter.BitsPerKey(), this->GetAllocator());
+    express = ExpressLanes(this->GetAllocator()); // The allocator may have propagated
+    ChainChanged();
   }
   return *this; // Return reference for chaining
 }
 
 // Move assignment: Efficiently transfers ownership from another SetLst
-template <typename Data>
-SetLst<Data>& SetLst<Data>::operator=(SetLst&& other) noexcept {
+template <typename Data, typename Alloc, typename Compare>
+SetLst<Data, Alloc, Compare>& SetLst<Data, Alloc, Compare>::operator=(SetLst&& other) noexcept(List<Data, Alloc>::NothrowMoveAssign) {
   // Delegate to List's move assignment which handles resource transfer
-  List<Data>::operator=(std::move(other));
+  if (this != &other) {
+    Node* moved = other.head;
+    List<Data, Alloc>::operator=(std::move(other));
+    std::swap(indexEnabled, other.indexEnabled);
+    std::swap(indexSeed, other.indexSeed);
+    std::swap(filterEnabled, other.filterEnabled);
+    std::swap(filter, other.filter);
+    if (head == moved) {
+      std::swap(express, other.express); // The node chains were exchanged, and the lanes follow them
+      std::swap(finger, other.finger);
+    } else {
+      ChainChanged(); // The elements were moved into new nodes
+      other.filter.Invalidate();
+    }
+  }
   return *this; // Return reference for chaining
 }
 
@@ -111,8 +137,8 @@ SetLst<Data>& SetLst<Data>::operator=(SetLst&& other) noexcept {
 // Test structural equality between sets
 
 // Equality operator: Returns true if sets contain same elements in same order
-template <typename Data>
-bool SetLst<Data>::operator==(const SetLst& other) const noexcept {
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::operator==(const SetLst& other) const noexcept {
   if (size != other.size) {
     return false; // Different sizes cannot be equal
   }
@@ -122,7 +148,7 @@ bool SetLst<Data>::operator==(const SetLst& other) const noexcept {
   auto otherCurrent = other.head;
   
   while (thisCurrent != nullptr && otherCurrent != nullptr) {
-    if (thisCurrent->element != otherCurrent->element) {
+    if (!order.Equivalent(thisCurrent->element, otherCurrent->element)) {
       return false; // Found differing elements
     }
     thisCurrent = thisCurrent->next;
@@ -133,8 +159,8 @@ bool SetLst<Data>::operator==(const SetLst& other) const noexcept {
 }
 
 // Inequality operator: Returns true if sets differ in content
-template <typename Data>
-bool SetLst<Data>::operator!=(const SetLst& other) const noexcept {
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::operator!=(const SetLst& other) const noexcept {
   return !(*this == other); // Simply negate equality result
 }
 
@@ -144,10 +170,16 @@ bool SetLst<Data>::operator!=(const SetLst& other) const noexcept {
 // Basic container functionality for clearing and testing element existence
 
 // Clear function: Removes all elements from the set
-template <typename Data>
-void SetLst<Data>::Clear() {
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::Clear() {
   // Delegate to List's Clear implementation which handles proper memory deallocation
-  List<Data>::Clear();
+  List<Data, Alloc>::Clear();
+  express.entries.Clear();
+  express.levels = 0;
+  express.freeEntry = NoLane;
+  express.stale = true;
+  express.pathValid = false;
+  finger = nullptr;
 }
 
 /* ************************************************************************** */
@@ -156,25 +188,22 @@ void SetLst<Data>::Clear() {
 // Provides efficient existence testing with early termination
 
 // Exists function: Tests if an element exists in the set
-// Optimized for sorted list with early termination when element cannot exist
-template <typename Data>
-bool SetLst<Data>::Exists(const Data& data) const noexcept {
-  // Traverse the sorted list with early termination optimization
-  auto current = head;
-  
-  while (current != nullptr) {
-    if (current->element == data) {
-      return true; // Found the element
-    } else if (current->element > data) {
-      // Since list is sorted in ascending order, if current element > data,
-      // then data cannot exist anywhere else in the list
-      return false;
-    }
-    
-    current = current->next;
+// The first node not ordered before data is the only candidate
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::Exists(const Data& data) const noexcept {
+  // The filter answers most lookups of absent elements without walking the list
+  bool filtered = FilterLive();
+  if (filtered && FilterRejects(data)) {
+    return false;
   }
-  
-  return false; // Element not found after full traversal
+
+  Node* prev = Before(data);
+  Node* current = (prev == nullptr) ? head : prev->next;
+  bool found = current != nullptr && !order.Less(data, current->element);
+  if (filtered && !found) {
+    filter.Missed(); // A false positive of the filter
+  }
+  return found;
 }
 
 /* ************************************************************************** */
@@ -182,141 +211,117 @@ bool SetLst<Data>::Exists(const Data& data) const noexcept {
 // DICTIONARY CONTAINER IMPLEMENTATION - INSERT OPERATIONS
 // Maintains set semantics by preventing duplicates and preserving sorted order
 
-// Insert function - Copy version: Inserts element in correct sorted position
-template <typename Data>
-bool SetLst<Data>::Insert(const Data& data) {
-  // First check if element already exists (set semantics - no duplicates)
-  if (Exists(data)) {
+// InsertValue: Finds the insertion point with one search, which also rejects duplicates
+template <typename Data, typename Alloc, typename Compare>
+template <typename Value>
+bool SetLst<Data, Alloc, Compare>::InsertValue(Value&& data) {
+  Node* prev = Before(data);
+  Node* next = (prev == nullptr) ? head : prev->next;
+  if (next != nullptr && !order.Less(data, next->element)) {
     return false; // Element already exists, insertion failed
   }
 
-  // Handle insertion at the beginning (empty list or smallest element)
-  if (head == nullptr || data < head->element) {
-    // Create new node and insert at head
-    auto newNode = new typename List<Data>::Node(data);
-    newNode->next = head;
+  // Create the node and link it after prev (or as the new head)
+  Node* newNode = this->NewNode(std::forward<Value>(data));
+  newNode->next = next;
+  if (prev == nullptr) {
     head = newNode;
-    
-    if (tail == nullptr) {
-      // This is the first element, so it's also the tail
-      tail = newNode;
-    }
   } else {
-    // Find the correct insertion point to maintain sorted order
-    auto current = head;
-    
-    // Traverse until we find where to insert (current->next > data or at end)
-    while (current->next != nullptr && current->next->element <= data) {
-      current = current->next;
-    }
-    
-    // Create new node and insert after current
-    auto newNode = new typename List<Data>::Node(data);
-    newNode->next = current->next;
-    current->next = newNode;
-    
-    if (current == tail) {
-      // We're inserting at the end, update tail pointer
-      tail = newNode;
-    }
+    prev->next = newNode;
   }
-  
-  size++; // Increment size counter
+  if (next == nullptr) {
+    tail = newNode; // Inserting at the end
+  }
+  size++;
+
+  if (LanesLive()) {
+    Raise(newNode);
+  }
+  FilterAdd(newNode->element);
   return true; // Insertion successful
 }
 
+// Insert function - Copy version: Inserts element in correct sorted position
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::Insert(const Data& data) {
+  return InsertValue(data);
+}
+
 // Insert function - Move version: Inserts element with move semantics for efficiency
-template <typename Data>
-bool SetLst<Data>::Insert(Data&& data) {
-  // First check if element already exists (set semantics - no duplicates)
-  if (Exists(data)) {
-    return false; // Element already exists, insertion failed
-  }
-  
-  // Handle insertion at the beginning (empty list or smallest element)
-  if (head == nullptr || data < head->element) {
-    // Create new node with moved data and insert at head
-    auto newNode = new typename List<Data>::Node(std::move(data));
-    newNode->next = head;
-    head = newNode;
-    
-    if (tail == nullptr) {
-      // This is the first element, so it's also the tail
-      tail = newNode;
-    }
-  } else {
-    // Find the correct insertion point to maintain sorted order
-    auto current = head;
-    
-    // Traverse until we find where to insert (current->next > data or at end)
-    while (current->next != nullptr && current->next->element <= data) {
-      current = current->next;
-    }
-    
-    // Create new node with moved data and insert after current
-    auto newNode = new typename List<Data>::Node(std::move(data));
-    newNode->next = current->next;
-    current->next = newNode;
-    
-    if (current == tail) {
-      // We're inserting at the end, update tail pointer
-      tail = newNode;
-    }
-  }
-  
-  size++; // Increment size counter
-  return true; // Insertion successful
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::Insert(Data&& data) {
+  return InsertValue(std::move(data));
 }
 
 // Remove function: Removes specified element if it exists in the set
-template <typename Data>
-bool SetLst<Data>::Remove(const Data& data) {
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::Remove(const Data& data) {
   if (size == 0) {
     return false; // Empty set, nothing to remove
   }
 
-  // Search for the node to remove, keeping track of previous node for linking
-  typename List<Data>::Node* prev = nullptr;
-  auto current = head;
-  
-  // Traverse with early termination optimization for sorted list
-  while (current != nullptr && current->element != data) {
-    // If current element > data, then data doesn't exist (sorted property)
-    if (current->element > data) {
-      return false; // Element not in set
-    }
-    
-    prev = current;
-    current = current->next;
-  }
-  
-  if (current == nullptr) {
-    // Reached end of list without finding element
-    return false;
+  // The search also yields the previous node and lane entries needed for unlinking
+  Node* prev = Before(data);
+  Node* current = (prev == nullptr) ? head : prev->next;
+  if (current == nullptr || order.Less(data, current->element)) {
+    return false; // Element not in set
   }
-  
-  // Remove the found node and update pointers
-  if (prev == nullptr) {
-    // Removing the head node
-    head = current->next;
-    
-    if (head == nullptr) {
-      // Was the only element
-      tail = nullptr;
+
+  Unlink(prev, current);
+  return true;
+}
+
+// RemoveBatch: Removes a whole batch with one walk over the list
+// The sorted batch and the sorted list advance together like in a merge, and the
+// walk stops as soon as the batch is exhausted
+template <typename Data, typename Alloc, typename Compare>
+ulong SetLst<Data, Alloc, Compare>::RemoveBatch(SortableVector<Data, Alloc>& batch) {
+  batch.SortBy(order.Comparator());
+  Data* first = batch.begin();
+  ulong count = std::unique(first, first + batch.Size(), [this](const Data& a, const Data& b) { return order.Equivalent(a, b); }) - first;
+
+  ulong removed = 0;
+  RefreshLanes();
+  if (LanesLive() && count * 8 < size) {
+    // A small batch is cheaper to remove through the lanes than by walking the list
+    for (ulong j = 0; j < count; ++j) {
+      removed += Remove(first[j]);
     }
-  } else {
-    // It's in the middle or at the end
-    prev->next = current->next;
-    
-    if (current == tail) {
-      // Update tail if removing last element
-      tail = prev;
+    return removed;
+  }
+
+  Node* prev = nullptr;
+  auto current = head;
+  ulong j = 0;
+  while (current != nullptr && j < count) {
+    std::weak_ordering side = order.ThreeWay(first[j], current->element);
+    if (side < 0) {
+      ++j; // Not in the set
+    } else if (side == 0) {
+      auto next = current->next;
+      if (prev == nullptr) {
+        head = next;
+      } else {
+        prev->next = next;
+      }
+      if (current == tail) {
+        tail = prev;
+      }
+      this->DeleteNode(current);
+      current = next;
+      ++removed;
+      ++j;
+    } else {
+      prev = current;
+      current = current->next;
     }
   }
-  
-  delete current;
-  size--;
-  return true;
+
+  size -= removed;
+  if (removed > 0) {
+    ChainChanged();
+  }
+  return removed;
 }
 
 /* ************************************************************************** */
@@ -342,8 +347,8 @@ static bool Random() {
 
 // InsertAll (TraversableContainer): Attempts to insert all elements from a container
 // Returns true if at least one element was successfully inserted
-template <typename Data>
-bool SetLst<Data>::InsertAll(const TraversableContainer<Data>& container) {
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::InsertAll(const TraversableContainer<Data>& container) {
   bool inserted = false; // Track if any insertion occurred
   
   // Traverse all elements in the source container
@@ -359,8 +364,8 @@ bool SetLst<Data>::InsertAll(const TraversableContainer<Data>& container) {
 
 // InsertAll (MappableContainer): Move version for efficiency with movable containers
 // Moves elements instead of copying them to improve performance
-template <typename Data>
-bool SetLst<Data>::InsertAll(MappableContainer<Data>&& container) {
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::InsertAll(MappableContainer<Data>&& container) {
   bool inserted = false; // Track if any insertion occurred
   
   // Map over all elements to access them for moving
@@ -376,25 +381,17 @@ bool SetLst<Data>::InsertAll(MappableContainer<Data>&& container) {
 
 // RemoveAll: Attempts to remove all specified elements from the set
 // Returns true if at least one element was successfully removed
-template <typename Data>
-bool SetLst<Data>::RemoveAll(const TraversableContainer<Data>& container) {
-  bool removed = false; // Track if any removal occurred
-  
-  // Traverse all elements in the container to remove
-  container.Traverse([this, &removed](const Data& item) {
-    // Try to remove each element
-    if (Remove(item)) {
-      removed = true; // Mark that at least one removal succeeded
-    }
-  });
-  
-  return removed; // Return whether any elements were actually removed
+// The elements are gathered into a batch and removed in a single list walk
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::RemoveAll(const TraversableContainer<Data>& container) {
+  SortableVector<Data, Alloc> batch(container, this->GetAllocator());
+  return RemoveBatch(batch) > 0; // Return whether any elements were actually removed
 }
 
 // InsertSome (TraversableContainer): Probabilistic insertion using random selection
 // Each element has a 50% chance of being inserted, providing randomized subset insertion
-template <typename Data>
-bool SetLst<Data>::InsertSome(const TraversableContainer<Data>& container) {
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::InsertSome(const TraversableContainer<Data>& container) {
   bool inserted = false; // Track if any insertion occurred
   
   // Traverse elements and randomly decide whether to insert each one
@@ -410,8 +407,8 @@ bool SetLst<Data>::InsertSome(const TraversableContainer<Data>& container) {
 
 // InsertSome (MappableContainer): Move version with probabilistic insertion
 // Combines random selection with move semantics for efficiency
-template <typename Data>
-bool SetLst<Data>::InsertSome(MappableContainer<Data>&& container) {
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::InsertSome(MappableContainer<Data>&& container) {
   bool inserted = false; // Track if any insertion occurred
   
   // Map over elements to access them for moving, with random selection
@@ -426,24 +423,228 @@ bool SetLst<Data>::InsertSome(MappableContainer<Data>&& container) {
 }
 
 // RemoveSome: Probabilistic removal using random selection
-// Each element has a 50% chance of being removed, providing randomized subset removal
-template <typename Data>
-bool SetLst<Data>::RemoveSome(const TraversableContainer<Data>& container) {
-  bool removed = false; // Track if any removal occurred
+// Each element has a 50% chance of being selected; the selected ones are removed in a single list walk
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::RemoveSome(const TraversableContainer<Data>& container) {
+  SortableVector<Data, Alloc> batch(this->GetAllocator());
   
-  // Traverse elements and randomly decide whether to remove each one
-  container.Traverse([this, &removed](const Data& item) {
-    // Use random function to decide whether to remove (50% probability)
-    if (Random() && Remove(item)) {
-      removed = true; // Mark that at least one removal succeeded
+  // Traverse elements and randomly decide whether to remove each one (50% probability)
+  container.Traverse([&batch](const Data& item) {
+    if (Random()) {
+      batch.PushBack(item);
     }
   });
   
-  return removed; // Return whether any elements were actually removed
+  return RemoveBatch(batch) > 0; // Return whether any elements were actually removed
 }
 
 /* ************************************************************************** */
 
+// SET ALGEBRA
+// Every operation walks the two sorted lists side by side, like a merge
+
+// Combined: Appends copies of the selected elements to a new set (O(1) per element via tail)
+template <typename Data, typename Alloc, typename Compare>
+SetLst<Data, Alloc, Compare> SetLst<Data, Alloc, Compare>::Combined(const SetLst& other, unsigned keep) const {
+  SetLst result(this->GetAllocator());
+  result.indexEnabled = indexEnabled; // The lanes are built by the first search
+  result.indexSeed = indexSeed;
+  result.filterEnabled = filterEnabled; // So is the filter
+  result.filter = BloomFilter<Data, Alloc>(filter.BitsPerKey(), result.GetAllocator());
+  auto mine = head;
+  auto theirs = other.head;
+  while (mine != nullptr && theirs != nullptr) {
+    std::weak_ordering side = order.ThreeWay(mine->element, theirs->element); // One comparison per step
+    if (side < 0) {
+      if (keep & KeepLeft) {
+        result.InsertAtBack(mine->element);
+      }
+      mine = mine->next;
+    } else if (side > 0) {
+      if (keep & KeepRight) {
+        result.InsertAtBack(theirs->element);
+      }
+      theirs = theirs->next;
+    } else {
+      if (keep & KeepCommon) {
+        result.InsertAtBack(mine->element);
+      }
+      mine = mine->next;
+      theirs = theirs->next;
+    }
+  }
+  for (; (keep & KeepLeft) && mine != nullptr; mine = mine->next) {
+    result.InsertAtBack(mine->element);
+  }
+  for (; (keep & KeepRight) && theirs != nullptr; theirs = theirs->next) {
+    result.InsertAtBack(theirs->element);
+  }
+  return result;
+}
+
+// MergeWith: 'prev' trails 'node' so that nodes can be unlinked or linked before it
+// If copying an element throws, the set is left valid with part of the changes applied
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::MergeWith(const SetLst& other, unsigned keep) {
+  if (this == &other) {
+    // Every element is common to both sides
+    if (!(keep & KeepCommon)) {
+      Clear();
+    }
+    return;
+  }
+
+  Node* prev = nullptr;
+  auto node = head;
+  auto theirs = other.head;
+  ChainChanged(); // Nodes are linked and unlinked below the lanes and the finger
+
+  auto skip = [&]() {
+    prev = node;
+    node = node->next;
+  };
+  auto unlink = [&]() {
+    auto next = node->next;
+    if (prev == nullptr) {
+      head = next;
+    } else {
+      prev->next = next;
+    }
+    if (node == tail) {
+      tail = prev;
+    }
+    this->DeleteNode(node);
+    size--;
+    node = next;
+  };
+  auto link = [&]() {
+    auto fresh = this->NewNode(theirs->element);
+    fresh->next = node;
+    if (prev == nullptr) {
+      head = fresh;
+    } else {
+      prev->next = fresh;
+    }
+    if (node == nullptr) {
+      tail = fresh;
+    }
+    prev = fresh;
+    size++;
+  };
+
+  while (node != nullptr && theirs != nullptr) {
+    std::weak_ordering side = order.ThreeWay(node->element, theirs->element);
+    if (side < 0) {
+      (keep & KeepLeft) ? skip() : unlink();
+    } else if (side > 0) {
+      if (keep & KeepRight) {
+        link();
+      }
+      theirs = theirs->next;
+    } else {
+      (keep & KeepCommon) ? skip() : unlink();
+      theirs = theirs->next;
+    }
+  }
+
+  // Either list is exhausted: the rest of this one is kept without walking it
+  while (!(keep & KeepLeft) && node != nullptr) {
+    unlink();
+  }
+  for (; (keep & KeepRight) && theirs != nullptr; theirs = theirs->next) {
+    link();
+  }
+}
+
+// Union: Elements in either set
+template <typename Data, typename Alloc, typename Compare>
+SetLst<Data, Alloc, Compare> SetLst<Data, Alloc, Compare>::Union(const SetLst& other) const {
+  return Combined(other, KeepLeft | KeepRight | KeepCommon);
+}
+
+// Intersection: Elements in both sets
+template <typename Data, typename Alloc, typename Compare>
+SetLst<Data, Alloc, Compare> SetLst<Data, Alloc, Compare>::Intersection(const SetLst& other) const {
+  return Combined(other, KeepCommon);
+}
+
+// Difference: Elements of this set that are not in the other
+template <typename Data, typename Alloc, typename Compare>
+SetLst<Data, Alloc, Compare> SetLst<Data, Alloc, Compare>::Difference(const SetLst& other) const {
+  return Combined(other, KeepLeft);
+}
+
+// SymmetricDifference: Elements in exactly one of the two sets
+template <typename Data, typename Alloc, typename Compare>
+SetLst<Data, Alloc, Compare> SetLst<Data, Alloc, Compare>::SymmetricDifference(const SetLst& other) const {
+  return Combined(other, KeepLeft | KeepRight);
+}
+
+// UnionWith: Links copies of the elements missing from this set
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::UnionWith(const SetLst& other) {
+  MergeWith(other, KeepLeft | KeepRight | KeepCommon);
+}
+
+// IntersectWith: Unlinks the elements that are not in the other set
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::IntersectWith(const SetLst& other) {
+  MergeWith(other, KeepCommon);
+}
+
+// DifferenceWith: Unlinks the elements that are also in the other set
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::DifferenceWith(const SetLst& other) {
+  MergeWith(other, KeepLeft);
+}
+
+// SymmetricDifferenceWith: Unlinks the common elements and links the missing ones
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::SymmetricDifferenceWith(const SetLst& other) {
+  MergeWith(other, KeepLeft | KeepRight);
+}
+
+// IsSubsetOf: Returns false at the first element missing from the other set
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::IsSubsetOf(const SetLst& other) const noexcept {
+  if (size > other.size) {
+    return false;
+  }
+  auto theirs = other.head;
+  for (auto mine = head; mine != nullptr; mine = mine->next) {
+    while (theirs != nullptr && order.Less(theirs->element, mine->element)) {
+      theirs = theirs->next;
+    }
+    if (theirs == nullptr || order.Less(mine->element, theirs->element)) {
+      return false; // mine->element is not in the other set
+    }
+    theirs = theirs->next;
+  }
+  return true;
+}
+
+// Intersects: Returns true at the first common element
+// Disjoint ranges are rejected through head and tail without walking
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::Intersects(const SetLst& other) const noexcept {
+  if (size == 0 || other.size == 0 || order.Less(tail->element, other.head->element) || order.Less(other.tail->element, head->element)) {
+    return false;
+  }
+  auto mine = head;
+  auto theirs = other.head;
+  while (mine != nullptr && theirs != nullptr) {
+    std::weak_ordering side = order.ThreeWay(mine->element, theirs->element);
+    if (side < 0) {
+      mine = mine->next;
+    } else if (side > 0) {
+      theirs = theirs->next;
+    } else {
+      return true;
+    }
+  }
+  return false;
+}
+
 /* ************************************************************************** */
 
 // ORDERED DICTIONARY IMPLEMENTATION - MIN/MAX OPERATIONS
@@ -452,8 +653,8 @@ bool SetLst<Data>::RemoveSome(const TraversableContainer<Data>& container) {
 
 // Min: Returns the smallest element in the set
 // Since elements are sorted in ascending order, minimum is always at the head
-template <typename Data>
-const Data& SetLst<Data>::Min() const {
+template <typename Data, typename Alloc, typename Compare>
+const Data& SetLst<Data, Alloc, Compare>::Min() const {
   if (size == 0) {
     throw std::length_error("Empty set"); // Cannot find min in empty set
   }
@@ -464,55 +665,32 @@ const Data& SetLst<Data>::Min() const {
 
 // MinNRemove: Returns and removes the smallest element atomically
 // Efficient O(1) operation since minimum is at head of sorted list
-template <typename Data>
-Data SetLst<Data>::MinNRemove() {
+template <typename Data, typename Alloc, typename Compare>
+Data SetLst<Data, Alloc, Compare>::MinNRemove() {
   if (size == 0) {
     throw std::length_error("Empty set"); // Cannot remove from empty set
   }
 
   // Store the minimum element value before removal
   Data min = head->element;
-  
-  // Remove the head node (which contains the minimum)
-  auto temp = head;
-  head = head->next; // Update head to next node
-  delete temp;       // Free the old head node
-  
-  size--; // Decrement size counter
-  
-  // Handle the case where we removed the last element
-  if (size == 0) {
-    tail = nullptr; // Set tail to null for empty list
-  }
-  
+  Erase(head); // The head only appears right after the lane heads
   return min; // Return the removed minimum value
 }
 
 // RemoveMin: Removes the smallest element without returning it
 // Efficient O(1) operation for head removal in sorted list
-template <typename Data>
-void SetLst<Data>::RemoveMin() {
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::RemoveMin() {
   if (size == 0) {
     throw std::length_error("Empty set"); // Cannot remove from empty set
   }
-  
-  // Remove the head node which contains the minimum
-  auto temp = head;
-  head = head->next; // Update head to next node
-  delete temp;       // Free the old head node
-  
-  size--; // Decrement size counter
-  
-  // Handle the case where we removed the last element
-  if (size == 0) {
-    tail = nullptr; // Set tail to null for empty list
-  }
+  Erase(head);
 }
 
 // Max: Returns the largest element in the set
 // Since elements are sorted in ascending order, maximum is always at the tail
-template <typename Data>
-const Data& SetLst<Data>::Max() const {
+template <typename Data, typename Alloc, typename Compare>
+const Data& SetLst<Data, Alloc, Compare>::Max() const {
   if (size == 0) {
     throw std::length_error("Empty set"); // Cannot find max in empty set
   }
@@ -522,367 +700,433 @@ const Data& SetLst<Data>::Max() const {
 }
 
 // MaxNRemove: Returns and removes the largest element atomically
-// O(n) operation since we need to find the node before tail to update links
-template <typename Data>
-Data SetLst<Data>::MaxNRemove() {
+// Finding the node before the tail is O(n) in a singly-linked list, O(log n) through the lanes
+template <typename Data, typename Alloc, typename Compare>
+Data SetLst<Data, Alloc, Compare>::MaxNRemove() {
   if (size == 0) {
     throw std::length_error("Empty set"); // Cannot remove from empty set
   }
 
   // Store the maximum element value before removal
   Data max = tail->element;
-  
-  if (head == tail) {
-    // Special case: only one element in the set
-    delete head;
-    head = nullptr;
-    tail = nullptr;
-  } else {
-    // Find the node before the tail (O(n) operation in singly-linked list)
-    auto current = head;
-    while (current->next != tail) {
-      current = current->next;
-    }
-    
-    // Remove the tail node
-    delete tail;
-    tail = current;        // Update tail to previous node
-    tail->next = nullptr;  // Ensure new tail points to null
-  }
-  
-  size--; // Decrement size counter
+  Erase(tail);
   return max; // Return the removed maximum value
 }
 
 // RemoveMax: Removes the largest element without returning it
-// O(n) operation due to the need to traverse to find the node before tail
-template <typename Data>
-void SetLst<Data>::RemoveMax() {
+// Same search for the node before the tail as MaxNRemove
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::RemoveMax() {
   if (size == 0) {
     throw std::length_error("Empty set"); // Cannot remove from empty set
   }
-  
-  if (head == tail) {
-    // Special case: only one element in the set
-    delete head;
-    head = nullptr;
-    tail = nullptr;
-  } else {
-    // Find the node before the tail (O(n) operation in singly-linked list)
-    auto current = head;
-    while (current->next != tail) {
-      current = current->next;
-    }
-    
-    // Remove the tail node
-    delete tail;
-    tail = current;        // Update tail to previous node
-    tail->next = nullptr;  // Ensure new tail points to null
-  }
-  
-  size--; // Decrement size counter
+  Erase(tail);
 }
 
 // ORDERED DICTIONARY IMPLEMENTATION - PREDECESSOR OPERATIONS
 // These operations find elements that are immediately smaller than a given value
 // They implement the mathematical concept of predecessor in an ordered set
 
-// Predecessor: Finds the largest element smaller than the given data
-// Returns a reference to the predecessor element
-// Time complexity: O(n) - must traverse list to find largest element < data
-template <typename Data>
-const Data& SetLst<Data>::Predecessor(const Data& data) const {
+// PredecessorNode: The predecessor is the last node ordered before data
+// Time complexity: O(n) walking the list, expected O(log n) through the lanes
+template <typename Data, typename Alloc, typename Compare>
+typename SetLst<Data, Alloc, Compare>::Node* SetLst<Data, Alloc, Compare>::PredecessorNode(const Data& data) const {
   if (size == 0) {
     throw std::length_error("Empty set"); // Cannot find predecessor in empty set
   }
 
-  // Search for the largest element that is smaller than data
-  auto current = head;
-  typename List<Data>::Node* pred = nullptr; // Will hold the best predecessor found
-  
-  // Traverse the entire list to find the largest element < data
-  while (current != nullptr) {
-    if (current->element < data) {
-      // This element is smaller than data, check if it's the best predecessor so far
-      if (pred == nullptr || current->element > pred->element) {
-        pred = current; // Update best predecessor
-      }
-    }
-    current = current->next;
-  }
-  
+  Node* pred = Before(data);
   if (pred == nullptr) {
     // No element found that is smaller than data
     throw std::length_error("No predecessor found");
   }
-  
-  return pred->element; // Return the predecessor element
+  return pred;
+}
+
+// Predecessor: Finds the largest element smaller than the given data
+// Returns a reference to the predecessor element
+template <typename Data, typename Alloc, typename Compare>
+const Data& SetLst<Data, Alloc, Compare>::Predecessor(const Data& data) const {
+  return PredecessorNode(data)->element;
 }
 
 // PredecessorNRemove: Finds, returns, and removes the predecessor atomically
 // This is a compound operation that ensures consistency
-template <typename Data>
-Data SetLst<Data>::PredecessorNRemove(const Data& data) {
-  if (size == 0) {
-    throw std::length_error("Empty set"); // Cannot find predecessor in empty set
-  }
-
-  // Find the predecessor and track the nodes needed for removal
-  auto current = head;
-  typename List<Data>::Node* pred = nullptr;     // The predecessor node
-  typename List<Data>::Node* prevPred = nullptr; // Node before predecessor
-  typename List<Data>::Node* prev = nullptr;     // Previous node in traversal
-  
-  // Traverse to find the largest element < data and its previous node
-  while (current != nullptr) {
-    if (current->element < data) {
-      // This element is smaller than data, check if it's the best predecessor
-      if (pred == nullptr || current->element > pred->element) {
-        pred = current;     // Update best predecessor
-        prevPred = prev;    // Update predecessor's previous node
-      }
-    }
-    prev = current;         // Update previous node for next iteration
-    current = current->next;
-  }
-  
-  if (pred == nullptr) {
-    // No predecessor found
-    throw std::length_error("No predecessor found");
-  }
-  
-  // Store the predecessor value before removal
-  Data result = pred->element;
-  
-  // Remove the predecessor node from the list
-  if (prevPred == nullptr) {
-    // Predecessor is at the head of the list
-    head = pred->next;
-    
-    if (head == nullptr) {
-      // List becomes empty after removal
-      tail = nullptr;
-    }
-  } else {
-    // Predecessor is in the middle or at the end
-    prevPred->next = pred->next;
-    
-    if (pred == tail) {
-      // Predecessor was the tail, update tail pointer
-      tail = prevPred;
-    }
-  }
-  
-  delete pred; // Free the predecessor node
-  size--;      // Decrement size counter
-  
+template <typename Data, typename Alloc, typename Compare>
+Data SetLst<Data, Alloc, Compare>::PredecessorNRemove(const Data& data) {
+  Node* pred = PredecessorNode(data);
+  Data result = pred->element; // Store the predecessor value before removal
+  Erase(pred);
   return result; // Return the removed predecessor value
 }
 
 // RemovePredecessor: Removes the predecessor without returning its value
 // More efficient when the value is not needed
-template <typename Data>
-void SetLst<Data>::RemovePredecessor(const Data& data) {
-  if (size == 0) {
-    throw std::length_error("Empty set"); // Cannot find predecessor in empty set
-  }
-
-  // Find the predecessor and track the nodes needed for removal
-  auto current = head;
-  typename List<Data>::Node* pred = nullptr;     // The predecessor node
-  typename List<Data>::Node* prevPred = nullptr; // Node before predecessor
-  typename List<Data>::Node* prev = nullptr;     // Previous node in traversal
-  
-  // Traverse to find the largest element < data and its previous node
-  while (current != nullptr) {
-    if (current->element < data) {
-      // This element is smaller than data, check if it's the best predecessor
-      if (pred == nullptr || current->element > pred->element) {
-        pred = current;     // Update best predecessor
-        prevPred = prev;    // Update predecessor's previous node
-      }
-    }
-    prev = current;         // Update previous node for next iteration
-    current = current->next;
-  }
-  
-  if (pred == nullptr) {
-    // No predecessor found
-    throw std::length_error("No predecessor found");
-  }
-  
-  // Remove the predecessor node from the list
-  if (prevPred == nullptr) {
-    // Predecessor is at the head of the list
-    head = pred->next;
-    
-    if (head == nullptr) {
-      // List becomes empty after removal
-      tail = nullptr;
-    }
-  } else {
-    // Predecessor is in the middle or at the end
-    prevPred->next = pred->next;
-    
-    if (pred == tail) {
-      // Predecessor was the tail, update tail pointer
-      tail = prevPred;
-    }
-  }
-  
-  delete pred; // Free the predecessor node
-  size--;      // Decrement size counter
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::RemovePredecessor(const Data& data) {
+  Erase(PredecessorNode(data));
 }
 
 // ORDERED DICTIONARY IMPLEMENTATION - SUCCESSOR OPERATIONS
 // These operations find elements that are immediately larger than a given value
 // They implement the mathematical concept of successor in an ordered set
 
-// Successor: Finds the smallest element larger than the given data
-// Returns a reference to the successor element
-// Time complexity: O(n) - must traverse list to find smallest element > data
-template <typename Data>
-const Data& SetLst<Data>::Successor(const Data& data) const {
+// SuccessorNode: The successor follows the first node not ordered before data,
+// unless that node is ordered after data itself
+// Time complexity: O(n) walking the list, expected O(log n) through the lanes
+template <typename Data, typename Alloc, typename Compare>
+typename SetLst<Data, Alloc, Compare>::Node* SetLst<Data, Alloc, Compare>::SuccessorNode(const Data& data) const {
   if (size == 0) {
     throw std::length_error("Empty set"); // Cannot find successor in empty set
   }
 
-  // Search for the smallest element that is larger than data
-  auto current = head;
-  typename List<Data>::Node* succ = nullptr; // Will hold the best successor found
-  
-  // Traverse the entire list to find the smallest element > data
-  while (current != nullptr) {
-    if (current->element > data) {
-      // This element is larger than data, check if it's the best successor so far
-      if (succ == nullptr || current->element < succ->element) {
-        succ = current; // Update best successor
-      }
-    }
-    current = current->next;
+  Node* prev = Before(data);
+  Node* succ = (prev == nullptr) ? head : prev->next;
+  if (succ != nullptr && !order.Less(data, succ->element)) {
+    succ = succ->next; // Skip the element equivalent to data
   }
-  
   if (succ == nullptr) {
     // No element found that is larger than data
     throw std::length_error("No successor found");
   }
-  
-  return succ->element; // Return the successor element
+  return succ;
+}
+
+// Successor: Finds the smallest element larger than the given data
+// Returns a reference to the successor element
+template <typename Data, typename Alloc, typename Compare>
+const Data& SetLst<Data, Alloc, Compare>::Successor(const Data& data) const {
+  return SuccessorNode(data)->element;
 }
 
 // SuccessorNRemove: Finds, returns, and removes the successor atomically
 // This is a compound operation that ensures consistency
-template <typename Data>
-Data SetLst<Data>::SuccessorNRemove(const Data& data) {
-  if (size == 0) {
-    throw std::length_error("Empty set"); // Cannot find successor in empty set
+template <typename Data, typename Alloc, typename Compare>
+Data SetLst<Data, Alloc, Compare>::SuccessorNRemove(const Data& data) {
+  Node* succ = SuccessorNode(data);
+  Data result = succ->element; // Store the successor value before removal
+  Erase(succ);
+  return result; // Return the removed successor value
+}
+
+// RemoveSuccessor: Removes the successor without returning its value
+// More efficient when the value is not needed
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::RemoveSuccessor(const Data& data) {
+  Erase(SuccessorNode(data));
+}
+
+/* ************************************************************************** */
+
+// SKIP-LIST INDEX
+// Lane k holds the nodes whose height exceeds k; a search runs along the top lane,
+// drops a lane whenever the next entry is not ordered before the element, and
+// finishes on the node chain, where about three nodes separate two lane-0 entries
+
+// EnableIndex: Restarts the level generator from the seed and builds the lanes
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::EnableIndex(ulong seed) {
+  indexEnabled = true;
+  indexSeed = seed;
+  BuildLanes();
+}
+
+// DisableIndex: Releases the lanes
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::DisableIndex() noexcept {
+  indexEnabled = false;
+  express = ExpressLanes(this->GetAllocator());
+}
+
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::IndexEnabled() const noexcept {
+  return indexEnabled;
+}
+
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::LanesLive() const noexcept {
+  return indexEnabled && !express.stale;
+}
+
+// Height: Each pair of trailing zero bits of a splitmix64 draw adds a lane,
+// so a node reaches lane k with probability 4^-k
+template <typename Data, typename Alloc, typename Compare>
+ulong SetLst<Data, Alloc, Compare>::Height() const noexcept {
+  std::uint64_t z = (express.random += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z ^= z >> 31;
+  return static_cast<ulong>(std::countr_zero(z)) / 2;
+}
+
+// NewEntry: Entries are recycled before the vector grows
+template <typename Data, typename Alloc, typename Compare>
+ulong SetLst<Data, Alloc, Compare>::NewEntry(Node* node, ulong down) const {
+  ulong entry = express.freeEntry;
+  if (entry == NoLane) {
+    entry = express.entries.Size();
+    express.entries.PushBack(Lane{node, NoLane, down});
+  } else {
+    express.freeEntry = express.entries.begin()[entry].next;
+    express.entries.begin()[entry] = Lane{node, NoLane, down};
   }
+  return entry;
+}
 
-  // Find the successor and track the nodes needed for removal
-  auto current = head;
-  typename List<Data>::Node* succ = nullptr;     // The successor node
-  typename List<Data>::Node* prevSucc = nullptr; // Node before successor
-  typename List<Data>::Node* prev = nullptr;     // Previous node in traversal
-  
-  // Traverse to find the smallest element > data and its previous node
-  while (current != nullptr) {
-    if (current->element > data) {
-      // This element is larger than data, check if it's the best successor
-      if (succ == nullptr || current->element < succ->element) {
-        succ = current;     // Update best successor
-        prevSucc = prev;    // Update successor's previous node
-      }
+// BuildLanes: One walk of the chain appends every node to the lanes it joins
+// The lanes stay stale until the build completes
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::BuildLanes() const {
+  express.stale = true;
+  express.pathValid = false;
+  express.path.Resize(MaxLanes);
+  express.entries.Resize(MaxLanes);
+  express.entries.Reserve(MaxLanes + size / 3 + 1);
+  express.levels = 0;
+  express.freeEntry = NoLane;
+  express.random = indexSeed;
+
+  ulong last[MaxLanes];
+  for (ulong k = 0; k < MaxLanes; ++k) {
+    express.entries.begin()[k] = Lane{nullptr, NoLane, (k == 0) ? NoLane : k - 1};
+    last[k] = k;
+  }
+  for (Node* node = head; node != nullptr; node = node->next) {
+    ulong height = Height();
+    ulong below = NoLane;
+    for (ulong k = 0; k < height; ++k) {
+      below = NewEntry(node, below);
+      express.entries.begin()[last[k]].next = below;
+      last[k] = below;
     }
-    prev = current;         // Update previous node for next iteration
-    current = current->next;
+    express.levels = std::max(express.levels, height);
   }
-  
-  if (succ == nullptr) {
-    // No successor found
-    throw std::length_error("No successor found");
+  express.stale = false;
+}
+
+// RefreshLanes: A failed rebuild leaves the lanes stale, and searches walk the list
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::RefreshLanes() const noexcept {
+  if (indexEnabled && express.stale) {
+    try {
+      BuildLanes();
+    } catch (...) {
+      express.stale = true;
+    }
   }
-  
-  // Store the successor value before removal
-  Data result = succ->element;
-  
-  // Remove the successor node from the list
-  if (prevSucc == nullptr) {
-    // Successor is at the head of the list
-    head = succ->next;
-    
-    if (head == nullptr) {
-      // List becomes empty after removal
-      tail = nullptr;
+}
+
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::ChainChanged() noexcept {
+  express.stale = true;
+  finger = nullptr;
+  filter.Invalidate();
+}
+
+// Before: Descends the lanes, then finishes the search on the node chain
+// When the element lies past the finger, the lanes are climbed from the saved path
+// only while their next entry is still before it, so a search covering d nodes
+// takes expected O(log d); without lanes the walk starts at the finger itself
+template <typename Data, typename Alloc, typename Compare>
+typename SetLst<Data, Alloc, Compare>::Node* SetLst<Data, Alloc, Compare>::Before(const Data& data) const noexcept {
+  RefreshLanes();
+  bool ahead = finger != nullptr && order.Less(finger->element, data);
+  Node* prev = nullptr;
+  if (LanesLive() && express.levels > 0) {
+    const Lane* entry = express.entries.begin();
+    ulong* path = express.path.begin();
+    auto before = [&](ulong at) {
+      ulong next = entry[at].next;
+      return next != NoLane && order.Less(entry[next].node->element, data);
+    };
+
+    ulong k = express.levels - 1;
+    ulong at = k; // Head of the top lane
+    if (ahead && express.pathValid) {
+      // The saved entries precede data; the lanes above the first one whose next
+      // entry does not are already the search path
+      k = 0;
+      while (k + 1 < express.levels && before(path[k])) {
+        ++k;
+      }
+      at = path[k];
     }
-  } else {
-    // Successor is in the middle or at the end
-    prevSucc->next = succ->next;
-    
-    if (succ == tail) {
-      // Successor was the tail, update tail pointer
-      tail = prevSucc;
+    for (;; --k) {
+      while (before(at)) {
+        at = entry[at].next;
+      }
+      path[k] = at;
+      if (k == 0) {
+        break;
+      }
+      at = entry[at].down;
     }
+    express.pathValid = true;
+    prev = entry[at].node;
+    if (ahead && (prev == nullptr || order.Less(prev->element, finger->element))) {
+      prev = finger; // The finger is closer than the lane-0 entry
+    }
+  } else if (ahead) {
+    prev = finger;
   }
-  
-  delete succ; // Free the successor node
-  size--;      // Decrement size counter
-  
-  return result; // Return the removed successor value
+
+  Node* current = (prev == nullptr) ? head : prev->next;
+  while (current != nullptr && order.Less(current->element, data)) {
+    prev = current;
+    current = current->next;
+  }
+  finger = prev;
+  return prev;
 }
 
-// RemoveSuccessor: Removes the successor without returning its value
-// More efficient when the value is not needed
-template <typename Data>
-void SetLst<Data>::RemoveSuccessor(const Data& data) {
-  if (size == 0) {
-    throw std::length_error("Empty set"); // Cannot find successor in empty set
+// Raise: Links the new entries bottom-up, so a failed allocation only leaves a
+// shorter tower, which is still a valid index
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::Raise(Node* node) noexcept {
+  ulong* path = express.path.begin();
+  ulong height = Height();
+  ulong below = NoLane;
+  try {
+    for (ulong k = 0; k < height; ++k) {
+      if (k >= express.levels) {
+        path[k] = k; // A lane not in use yet: link right after its head
+      }
+      below = NewEntry(node, below);
+      Lane* entry = express.entries.begin();
+      entry[below].next = entry[path[k]].next;
+      entry[path[k]].next = below;
+      express.levels = std::max(express.levels, k + 1);
+    }
+  } catch (...) {
   }
+  express.pathValid = true; // Lanes the search did not reach now start with this node
+}
 
-  // Find the successor and track the nodes needed for removal
-  auto current = head;
-  typename List<Data>::Node* succ = nullptr;     // The successor node
-  typename List<Data>::Node* prevSucc = nullptr; // Node before successor
-  typename List<Data>::Node* prev = nullptr;     // Previous node in traversal
-  
-  // Traverse to find the smallest element > data and its previous node
-  while (current != nullptr) {
-    if (current->element > data) {
-      // This element is larger than data, check if it's the best successor
-      if (succ == nullptr || current->element < succ->element) {
-        succ = current;     // Update best successor
-        prevSucc = prev;    // Update successor's previous node
+// Unlink: The node's entry on each lane, if any, directly follows the path entry
+// The finger is the previous node, so it stays valid
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::Unlink(Node* prev, Node* node) noexcept {
+  if (LanesLive()) {
+    Lane* entry = express.entries.begin();
+    const ulong* path = express.path.begin();
+    for (ulong k = 0; k < express.levels; ++k) {
+      ulong own = entry[path[k]].next;
+      if (own == NoLane || entry[own].node != node) {
+        break; // Towers are contiguous from lane 0
       }
+      entry[path[k]].next = entry[own].next;
+      entry[own].next = express.freeEntry;
+      express.freeEntry = own;
+    }
+    while (express.levels > 0 && entry[express.levels - 1].next == NoLane) {
+      --express.levels;
     }
-    prev = current;         // Update previous node for next iteration
-    current = current->next;
   }
-  
-  if (succ == nullptr) {
-    // No successor found
-    throw std::length_error("No successor found");
+
+  if (prev == nullptr) {
+    head = node->next;
+  } else {
+    prev->next = node->next;
   }
-  
-  // Remove the successor node from the list
-  if (prevSucc == nullptr) {
-    // Successor is at the head of the list
-    head = succ->next;
-    
-    if (head == nullptr) {
-      // List becomes empty after removal
-      tail = nullptr;
+  if (node == tail) {
+    tail = prev;
+  }
+  this->DeleteNode(node);
+  size--;
+}
+
+// Erase: Searches the node's own element to find its previous node and lane entries
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::Erase(Node* node) noexcept {
+  Node* prev = Before(node->element);
+  Unlink(prev, node);
+}
+
+/* ************************************************************************** */
+
+// BLOOM PREFILTER
+// Inserted nodes are added to the filter; removals leave their bits behind, which
+// only costs false positives until the removal of half the keys forces a rebuild
+
+// EnableFilter: Builds the filter now; later rebuilds happen on the first lookup that finds it stale
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::EnableFilter(ulong bitsPerKey) requires Filterable {
+  filter = BloomFilter<Data, Alloc>(bitsPerKey, this->GetAllocator());
+  filterEnabled = true;
+  filter.Build(*this);
+}
+
+// DisableFilter: Frees the bits
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::DisableFilter() noexcept {
+  filterEnabled = false;
+  filter = BloomFilter<Data, Alloc>(filter.BitsPerKey(), this->GetAllocator());
+}
+
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::FilterEnabled() const noexcept {
+  return filterEnabled;
+}
+
+template <typename Data, typename Alloc, typename Compare>
+BloomStats SetLst<Data, Alloc, Compare>::FilterStats() const noexcept {
+  return filter.Stats();
+}
+
+// FilterLive: A failed rebuild leaves the filter unbuilt, and Exists walks the list without it
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::FilterLive() const noexcept {
+  if constexpr (Filterable) {
+    if (filterEnabled && !filter.Fresh(size)) {
+      try {
+        filter.Build(*this);
+      } catch (...) {
+        filter.Invalidate();
+      }
     }
+    return filterEnabled && filter.Built();
+  } else {
+    return false;
+  }
+}
+
+template <typename Data, typename Alloc, typename Compare>
+bool SetLst<Data, Alloc, Compare>::FilterRejects(const Data& data) const noexcept {
+  if constexpr (Filterable) {
+    return filter.Rejects(data);
   } else {
-    // Successor is in the middle or at the end
-    prevSucc->next = succ->next;
-    
-    if (succ == tail) {
-      // Successor was the tail, update tail pointer
-      tail = prevSucc;
+    return false;
+  }
+}
+
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::FilterAdd(const Data& data) noexcept {
+  if constexpr (Filterable) {
+    if (filterEnabled) {
+      filter.Add(data);
     }
   }
-  
-  delete succ; // Free the successor node
-  size--;      // Decrement size counter
+}
+
+/* ************************************************************************** */
+
+// Map overrides: Functions applied to the elements may change them, so the lanes, finger and filter are reset first
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::Map(MapFun fun) {
+  ChainChanged();
+  List<Data, Alloc>::Map(fun);
+}
+
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::PreOrderMap(MapFun fun) {
+  ChainChanged();
+  List<Data, Alloc>::PreOrderMap(fun);
+}
+
+template <typename Data, typename Alloc, typename Compare>
+void SetLst<Data, Alloc, Compare>::PostOrderMap(MapFun fun) {
+  ChainChanged();
+  List<Data, Alloc>::PostOrderMap(fun);
 }
 
 /* ************************************************************************** */
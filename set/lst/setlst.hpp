@@ -10,11 +10,13 @@
  * - Sorted linked list maintains elements in ascending order
  * - O(n) insertion due to sorted positioning requirement
  * - O(1) access to min element (head), O(n) access to max element (tail)
- * - O(n) search operations through linear traversal
+ * - O(n) search operations through linear traversal, or expected O(log n)
+ *   with the optional skip-list index (express lanes over the node chain)
+ * - Optional Bloom prefilter answering most lookups of absent elements
  * - Memory-efficient storage with only necessary allocations
  * - Suitable for sets with frequent min operations and moderate sizes
  * 
- * The implementation combines List<Data> for storage with Set<Data> interface
+ * The implementation combines List<Data, Alloc> for storage with Set<Data> interface
  * to provide both linear container operations and set-specific functionality.
  * Elements are kept sorted to enable efficient ordered dictionary operations.
  */
@@ -25,7 +27,10 @@
 /* ************************************************************************** */
 
 #include "../set.hpp"
+#include "../../container/order.hpp"
+#include "../../filter/bloom.hpp"
 #include "../../list/list.hpp"
+#include "../../vector/vector.hpp"
 
 /* ************************************************************************** */
 
@@ -37,12 +42,12 @@ namespace lasd {
  * SetLst Class - List-Based Set Implementation
  * 
  * Implements a mathematical set using a sorted linked list as the underlying
- * data structure. This class inherits from both Set<Data> and List<Data>
+ * data structure. This class inherits from both Set<Data> and List<Data, Alloc>
  * using virtual inheritance to provide:
  * 
  * 1. Set semantics (no duplicates, ordered operations)
  * 2. Linked list storage (dynamic memory, sequential access)
- * 3. Sorted maintenance (elements kept in ascending order)
+ * 3. Sorted maintenance (elements kept in ascending order of the Compare policy)
  * 
  * Performance Characteristics:
  * - Insert: O(n) - must find correct sorted position
@@ -51,42 +56,178 @@ namespace lasd {
  * - Max: O(1) - last element via tail pointer
  * - Search: O(n) - linear traversal
  * - Memory: O(n) - only allocated nodes, no wasted space
+ * With the index enabled, Insert, Remove, Exists, Predecessor, Successor and the
+ * removal of the max take expected O(log n), for about n/3 extra lane entries.
+ * Searches resume from the finger (the node found before the previous search
+ * target) when the element lies after it, so ascending access streams take O(1)
+ * per operation plus the distance covered.
  * 
  * Best suited for scenarios where:
- * - Set size is moderate (up to thousands of elements)
+ * - Set size is moderate (up to thousands of elements, or more when indexed)
  * - Memory efficiency is important
  * - Frequent min/max operations
  * - Infrequent random access by index
  */
-template <typename Data>
+template <typename Data, typename Alloc = std::allocator<Data>, typename Compare = std::less<Data>>
 class SetLst : virtual public Set<Data>, 
-               virtual public List<Data> {
+               virtual public List<Data, Alloc> {
   // Must extend Set<Data>,
-  //             List<Data>
+  //             List<Data, Alloc>
 
 private:
 
-  // No additional private members needed - inherits from List<Data>
-  // The sorted order is maintained by insertion/removal logic
+  // The sorted order is maintained by insertion/removal logic, following the
+  // comparator policy; equal elements are the equivalent ones
+  [[no_unique_address]] Order<Data, Compare> order;
 
 protected:
 
   // Import base class members for easier access
   using Container::size; // Number of elements in the set
-  using List<Data>::head; // Pointer to first node (smallest element)
-  using List<Data>::tail; // Pointer to last node (largest element)
+  using List<Data, Alloc>::head; // Pointer to first node (smallest element)
+  using List<Data, Alloc>::tail; // Pointer to last node (largest element)
+  using typename List<Data, Alloc>::Node;
+
+  // Front/back insertion and removal would bypass the order, the lanes and the finger
+  using List<Data, Alloc>::InsertAtFront;
+  using List<Data, Alloc>::InsertAtBack;
+  using List<Data, Alloc>::RemoveFromFront;
+  using List<Data, Alloc>::FrontNRemove;
+  using List<Data, Alloc>::RemoveFromBack;
+  using List<Data, Alloc>::BackNRemove;
+
+  // Sorting by operator< ignores Compare and leaves the lanes and the finger stale
+  using List<Data, Alloc>::Sort;
+
+  // SKIP-LIST INDEX
+  // Express lanes above the node chain: every node joins lane k with probability
+  // 4^-(k+1), and each lane is a sorted chain of entries pointing at their nodes.
+  // Entries link to each other by position in 'entries', so the lanes survive the
+  // vector growing; the first MaxLanes slots are the heads of the lanes.
+  struct Lane {
+    Node* node = nullptr;  // Node this entry stands for (null for a lane head)
+    ulong next = 0;        // Next entry on the same lane (NoLane at the end)
+    ulong down = 0;        // Entry of the same node one lane below (NoLane on lane 0)
+    bool operator==(const Lane&) const = default;
+  };
+
+  static constexpr ulong MaxLanes = 32;   // Two random bits per lane from a 64-bit draw
+  static constexpr ulong NoLane = ~0UL;   // Null entry position
+
+  // The lanes come from the list's allocator, rebound to their element types
+  using LaneAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Lane>;
+  using PathAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<ulong>;
+
+  struct ExpressLanes {
+    Vector<Lane, LaneAlloc> entries;
+    Vector<ulong, PathAlloc> path; // Last entry before the most recent search, on every lane
+    ulong levels = 0;          // Lanes holding at least one entry
+    ulong freeEntry = NoLane;  // Released entries, linked through 'next'
+    ulong random = 0;          // State of the level generator
+    bool stale = true;         // Nodes changed in bulk since the last build
+    bool pathValid = false;    // 'path' belongs to the current lanes
+
+    ExpressLanes() = default;
+    explicit ExpressLanes(const Alloc& allocator) noexcept : entries(LaneAlloc(allocator)), path(PathAlloc(allocator)) {}
+  };
+
+  bool indexEnabled = false;
+  ulong indexSeed = 0;
+  mutable ExpressLanes express; // Rebuilt by const lookups after a bulk change
+
+  // FINGER
+  // Last node found before a searched element (null if unknown). A search for a
+  // later element starts from it, and from the saved lane path when indexed, so
+  // ascending streams of operations cost O(1) per step plus the distance covered.
+  mutable Node* finger = nullptr;
+
+  // BLOOM PREFILTER
+  // Approximate membership filter consulted by Exists before walking the list
+  bool filterEnabled = false;
+  mutable BloomFilter<Data, Alloc> filter; // Rebuilt by const lookups when stale
+
+  // The filter hashes with std::hash, which agrees with the equivalence of the natural order only
+  static constexpr bool Filterable = BloomHashable<Data> && Order<Data, Compare>::Natural;
+
+  // FilterLive: Rebuilds the filter if it is enabled and stale; true if Exists may consult it
+  bool FilterLive() const noexcept;
+
+  // FilterRejects: True if the filter proves the element absent (counted in its statistics)
+  bool FilterRejects(const Data&) const noexcept;
+
+  // FilterAdd: Adds an inserted element to the enabled filter
+  void FilterAdd(const Data&) noexcept;
+
+  // LanesLive: True if the lanes are enabled and match the node chain
+  bool LanesLive() const noexcept;
+
+  // Height: Number of lanes the next node joins (deterministic from the seed)
+  ulong Height() const noexcept;
+
+  // NewEntry: Takes a released entry or appends one, and returns its position
+  ulong NewEntry(Node*, ulong) const;
+
+  // BuildLanes: Builds the lanes over the whole node chain (O(n))
+  void BuildLanes() const;
+
+  // RefreshLanes: Rebuilds the lanes if they are enabled and stale
+  void RefreshLanes() const noexcept;
+
+  // ChainChanged: Forgets the finger and marks the lanes and the filter stale after a bulk change of the node chain
+  void ChainChanged() noexcept;
+
+  // Before: Last node ordered before the element (null if none), which becomes the finger
+  // When the lanes are live, express.path receives the last entry before it on every lane
+  Node* Before(const Data&) const noexcept;
+
+  // Raise: Links a freshly inserted node into its lanes, following the path of the last Before
+  void Raise(Node*) noexcept;
+
+  // Unlink: Removes a node, which follows 'prev' (null for the head), from the lanes
+  // and the chain and deletes it; the last Before must have searched the node's element
+  void Unlink(Node*, Node*) noexcept;
+
+  // Erase: Unlinks and deletes a node of this set
+  void Erase(Node*) noexcept;
+
+  // PredecessorNode/SuccessorNode: Neighbours of an element (std::length_error if missing)
+  Node* PredecessorNode(const Data&) const;
+  Node* SuccessorNode(const Data&) const;
+
+  // InsertValue: Links a new node in the sorted position unless an equivalent one exists
+  template <typename Value>
+  bool InsertValue(Value&&);
+
+  // RemoveBatch: Sorts and deduplicates a batch, then unlinks its elements in a single list walk
+  // Returns the number of elements actually removed
+  ulong RemoveBatch(SortableVector<Data, Alloc>&);
+
+  // Flags selecting which elements of a merge with another set are kept
+  static constexpr unsigned KeepLeft = 1;   // Only in this set
+  static constexpr unsigned KeepRight = 2;  // Only in the other set
+  static constexpr unsigned KeepCommon = 4; // In both sets
+
+  // Combined: New set built by appending the selected elements in order
+  SetLst Combined(const SetLst&, unsigned) const;
+
+  // MergeWith: Keeps the selected elements in place, unlinking dropped nodes and
+  // linking copies of the other set's nodes, in a single walk of both lists
+  void MergeWith(const SetLst&, unsigned);
 
 public:
 
   // Default constructor: Creates an empty set
   SetLst() = default;
 
+  // Allocator constructor: Creates an empty set whose nodes come from the given allocator
+  explicit SetLst(const Alloc&) noexcept;
+
   /* ************************************************************************ */
 
   // Specific constructors for creating sets from existing containers
   
-  SetLst(const TraversableContainer<Data>& container); // Creates set by inserting all elements from traversable container
-  SetLst(MappableContainer<Data>&& container); // Creates set by moving/inserting all elements from mappable container
+  SetLst(const TraversableContainer<Data>& container, const Alloc& allocator = Alloc()); // Creates set by inserting all elements from traversable container
+  SetLst(MappableContainer<Data>&& container, const Alloc& allocator = Alloc()); // Creates set by moving/inserting all elements from mappable container
 
   /* ************************************************************************ */
 
@@ -106,7 +247,7 @@ public:
   // Assignment operators for copying and moving set contents
   
   SetLst& operator=(const SetLst& other); // Copy assignment with deep copying
-  SetLst& operator=(SetLst&& other) noexcept; // Move assignment with resource transfer
+  SetLst& operator=(SetLst&& other) noexcept(List<Data, Alloc>::NothrowMoveAssign); // Move assignment with resource transfer
 
   /* ************************************************************************ */
 
@@ -125,7 +266,7 @@ public:
 
   // Specific member function (inherited from TestableContainer)
   
-  bool Exists(const Data& data) const noexcept override; // Tests if element exists in set (O(n) search)
+  bool Exists(const Data& data) const noexcept override; // Tests if element exists in set (O(n), O(log n) indexed, O(1) for most absent elements filtered)
 
   /* ************************************************************************ */
 
@@ -170,6 +311,66 @@ public:
   bool InsertSome(MappableContainer<Data>&& container) override; // Inserts any non-duplicate elements (move version)
   bool RemoveSome(const TraversableContainer<Data>& container) override; // Removes any matching elements
 
+  /* ************************************************************************ */
+
+  // Set algebra, as sorted merges of the two lists in O(n + m)
+  // Lists cannot be searched by galloping, but the walk stops once the outcome is decided
+  
+  SetLst Union(const SetLst& other) const; // New set with the elements in either set
+  SetLst Intersection(const SetLst& other) const; // New set with the elements in both sets
+  SetLst Difference(const SetLst& other) const; // New set with the elements of this set not in the other
+  SetLst SymmetricDifference(const SetLst& other) const; // New set with the elements in exactly one set
+  
+  void UnionWith(const SetLst& other); // Links copies of the missing elements
+  void IntersectWith(const SetLst& other); // Unlinks the elements not in the other set
+  void DifferenceWith(const SetLst& other); // Unlinks the elements also in the other set
+  void SymmetricDifferenceWith(const SetLst& other); // Both of the above in one walk
+  
+  bool IsSubsetOf(const SetLst& other) const noexcept; // True if every element is also in the other set
+  bool Intersects(const SetLst& other) const noexcept; // True if the sets share at least one element
+
+  /* ************************************************************************ */
+
+  // SKIP-LIST INDEX
+  // Optional express lanes over the sorted nodes, making the ordered operations
+  // expected O(log n). The node levels come from a generator seeded by the caller,
+  // so the same seed and the same inserts give the same lanes. Single inserts and
+  // removals update the lanes; bulk removals and in-place set algebra mark them
+  // stale, and the next search rebuilds them in O(n). Copies, moves and the results
+  // of the set algebra keep the setting. Map marks the lanes stale; changing elements
+  // through iterators bypasses the set order and is not tracked.
+  // Lookups move the finger and may rebuild stale lanes, so concurrent readers
+  // need external synchronization.
+
+  void EnableIndex(ulong seed = 0); // Builds the lanes and starts using them
+  void DisableIndex() noexcept;     // Returns to walking the list from the head
+  bool IndexEnabled() const noexcept; // True if the lanes are in use
+
+  /* ************************************************************************ */
+
+  // BLOOM PREFILTER
+  // For sets queried mostly with absent elements. A blocked Bloom filter with the
+  // given bits per key answers most of those lookups without walking the list, and
+  // never rejects an element of the set. Single inserts add to the filter; bulk
+  // removals, in-place set algebra and assignments make the next Exists rebuild it
+  // in O(n), as do inserts past its planned size or the removal of half its keys.
+  // Copies, moves and the results of the set algebra keep the setting. Map makes the
+  // next Exists rebuild it too; changing elements through iterators is not tracked,
+  // and concurrent readers need external synchronization, as for the index.
+
+  void EnableFilter(ulong bitsPerKey = BloomFilter<Data>::DefaultBitsPerKey) requires Filterable; // Builds the filter and starts consulting it
+  void DisableFilter() noexcept;           // Drops the filter
+  bool FilterEnabled() const noexcept;     // True if Exists consults the filter
+  BloomStats FilterStats() const noexcept; // Lookups answered by the filter, and false positives among the others
+
+  /* ************************************************************************ */
+
+  // Map variants reset the lanes, the finger and the filter before changing the elements
+  using typename MappableContainer<Data>::MapFun;
+  void Map(MapFun) override;
+  void PreOrderMap(MapFun) override;
+  void PostOrderMap(MapFun) override;
+
 };
 
 /* ************************************************************************** */
@@ -17,6 +17,14 @@
 
 #include "setvec.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <bit>
+#include <cmath>
+#include <compare>
+#include <utility>
+
 namespace lasd {
 
 /* ************************************************************************** */
@@ -27,154 +35,610 @@ namespace lasd {
 // CheckUnique: Verifies if an element would be unique in the set
 // Returns true if element doesn't exist, false if it already exists
 // Time complexity: O(log n) using binary search on sorted array
-template <typename Data>
-bool SetVec<Data>::CheckUnique(const Data& data) const noexcept {
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::CheckUnique(const Data& data) const noexcept {
   // Element is unique if it doesn't already exist in the set
-  return !Exists(data);
+  // (searched directly, so that inserting does not rebuild a stale model)
+  return BinarySearch(data) < 0;
 }
 
 // CircularGet (const): Access elements with circular wrap-around behavior
 // Allows accessing elements beyond array bounds by wrapping to beginning
 // Used for advanced iteration patterns and circular navigation
-template <typename Data>
-const Data& SetVec<Data>::CircularGet(ulong index) const {
+template <typename Data, typename Alloc, typename Compare>
+const Data& SetVec<Data, Alloc, Compare>::CircularGet(ulong index) const {
   if (size == 0) {
     throw std::length_error("Access to an empty set.");
   }
   
   // Calculate circular index starting from current position
-  // The modulo operation ensures wrap-around behavior
-  return Elements[(current + index) % size];
+  // A single subtraction wraps in-range indices; only larger ones need the modulo
+  ulong pos = current + ((index < size) ? index : index % size);
+  return Elements[(pos < size) ? pos : pos - size];
 }
 
 // CircularGet (mutable): Mutable version of circular access
 // Provides the same circular wrap-around behavior for modification operations
-template <typename Data>
-Data& SetVec<Data>::CircularGet(ulong index) {
+template <typename Data, typename Alloc, typename Compare>
+Data& SetVec<Data, Alloc, Compare>::CircularGet(ulong index) {
   if (size == 0) {
     throw std::length_error("Access to an empty set.");
   }
   
   // Calculate circular index starting from current position
-  return Elements[(current + index) % size];
+  ulong pos = current + ((index < size) ? index : index % size);
+  return Elements[(pos < size) ? pos : pos - size];
 }
 
 // BinarySearch: Core search algorithm leveraging sorted array structure
-// Implements standard binary search with optional insertion point calculation
+// Lower-bound search with one comparison per step; a single final comparison tells
+// whether the element at the lower bound is equivalent to the searched one
 // Time complexity: O(log n) - logarithmic search in sorted array
 // Returns index of element if found, or -1 if not found
 // If insertPoint is provided, sets it to the index where element should be inserted
-template <typename Data>
-long SetVec<Data>::BinarySearch(const Data& data, long* insertPoint) const noexcept {
-    long low = 0;                              // Lower bound of search range
-    long high = static_cast<long>(size) - 1;   // Upper bound of search range
-    long mid = 0;                              // Middle point for binary division
-    bool found = false;                        // Flag to track if element is found
-
-    // Binary search loop with early termination
-    while (low <= high && !found) {
-        mid = (low + high) / 2;  // Calculate middle point avoiding overflow
-        
-        if (Elements[mid] == data) {
-            found = true;        // Element found at mid position
-        } else if (Elements[mid] < data) {
-            low = mid + 1;       // Search in upper half
-        } else {
-            high = mid - 1;      // Search in lower half
+template <typename Data, typename Alloc, typename Compare>
+long SetVec<Data, Alloc, Compare>::BinarySearch(const Data& data, long* insertPoint) const noexcept {
+    ulong low = 0;     // Every element before 'low' precedes data
+    ulong high = size; // No element from 'high' on precedes data
+
+    if constexpr (Modelable) {
+        if (modelEnabled && !model.stale) {
+            // Lower bound searched only inside the window predicted by the model
+            ModelWindow(data, low, high);
         }
     }
 
-    if (found) {
-        // Element was found - return its index
-        if (insertPoint != nullptr) {
-            *insertPoint = mid; // For duplicates, could be mid + 1
-        }
-        return mid;
-    } else {
-        // Element not found - calculate insertion point for maintaining sorted order
-        if (insertPoint != nullptr) {
-            *insertPoint = low; // Position where element should be inserted
+    while (low < high) {
+        ulong half = low + (high - low) / 2;
+        if (order.Less(Elements[half], data)) {
+            low = half + 1;
+        } else {
+            high = half;
         }
-        return -1; // Indicate element was not found
     }
+
+    if (insertPoint != nullptr) {
+        *insertPoint = static_cast<long>(low); // Position where element is or should be inserted
+    }
+    // Elements[low] does not precede data, so it is equivalent unless data precedes it
+    return (low < size && !order.Less(data, Elements[low])) ? static_cast<long>(low) : -1;
 }
 
 // FindIndex: Simplified wrapper for element location
 // Provides a clean interface for basic element location without insertion point
-template <typename Data>
-long SetVec<Data>::FindIndex(const Data& data) const noexcept {
+template <typename Data, typename Alloc, typename Compare>
+long SetVec<Data, Alloc, Compare>::FindIndex(const Data& data) const noexcept {
   // Delegate to BinarySearch without requesting insertion point
+  RefreshModel();
   return BinarySearch(data);
 }
 
+// InsertBatch: Bulk insertion of a gathered batch
+// Small batches go through Insert; larger ones are sorted, deduplicated and merged
+template <typename Data, typename Alloc, typename Compare>
+ulong SetVec<Data, Alloc, Compare>::InsertBatch(SortableVector<Data, Alloc>& batch) {
+  ulong count = batch.Size();
+  if (count <= SmallBatch) {
+    ulong inserted = 0;
+    for (ulong index = 0; index < count; ++index) {
+      inserted += Insert(std::move(batch[index])) ? 1 : 0;
+    }
+    return inserted;
+  }
+
+  batch.SortBy(order.Comparator());
+  Data* first = batch.begin();
+  ulong unique = std::unique(first, first + count, [this](const Data& a, const Data& b) { return order.Equivalent(a, b); }) - first;
+  return MergeSorted(first, unique);
+}
+
+// MergeSorted: Two passes over both sequences
+// The first only compares, recording where each batch element goes (if no element
+// is new, nothing is touched); the second builds the merged buffer from those
+// positions without comparing. On ties the existing element is kept. Elements are
+// moved when that cannot throw, otherwise copied, so an exception (from the
+// comparator or a copy) leaves the set unchanged.
+template <typename Data, typename Alloc, typename Compare>
+ulong SetVec<Data, Alloc, Compare>::MergeSorted(Data* batch, ulong count) {
+  constexpr ulong Present = ~0UL; // Position of a batch element already in the set
+  using PositionAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<ulong>;
+  Vector<ulong, PositionAlloc> positions(count, PositionAlloc(this->GetAllocator()));
+  ulong* position = positions.begin(); // Index in the set before which each batch element goes
+
+  ulong fresh = 0;
+  for (ulong i = 0, j = 0; j < count; ) {
+    std::weak_ordering side = (i < size) ? order.ThreeWay(Elements[i], batch[j]) : std::weak_ordering::greater;
+    if (side < 0) {
+      ++i;
+    } else {
+      if (side == 0) {
+        position[j] = Present;
+        ++i;
+      } else {
+        position[j] = i;
+        ++fresh;
+      }
+      ++j;
+    }
+  }
+  if (fresh == 0) {
+    return 0;
+  }
+
+  auto transfer = [](Data& from, Data* to) {
+    if constexpr (std::is_nothrow_move_constructible_v<Data> || !std::is_copy_constructible_v<Data>) {
+      std::construct_at(to, std::move(from));
+    } else {
+      std::construct_at(to, from);
+    }
+  };
+
+  ulong newSize = size + fresh;
+  ulong newCapacity = (newSize <= this->capacity) ? this->capacity : this->GrownCapacity(newSize);
+  Data* merged = this->Allocate(newCapacity);
+  ulong built = 0;
+  ulong shift = 0; // New elements placed before the one at 'current'
+  try {
+    ulong i = 0;
+    for (ulong j = 0; j < count; ++j) {
+      if (position[j] == Present) {
+        continue;
+      }
+      for (; i < position[j]; ++i) {
+        transfer(Elements[i], merged + built++);
+      }
+      shift += (i <= current) ? 1 : 0;
+      transfer(batch[j], merged + built++);
+    }
+    for (; i < size; ++i) {
+      transfer(Elements[i], merged + built++);
+    }
+  } catch (...) {
+    std::destroy_n(merged, built);
+    this->Deallocate(merged, newCapacity);
+    throw;
+  }
+
+  Changed();
+  filter.Invalidate(); // The merged elements were not added to it
+  std::destroy_n(Elements, size);
+  this->ReleaseStorage();
+  Elements = merged;
+  size = newSize;
+  this->capacity = newCapacity;
+  current += shift;
+  return fresh;
+}
+
+// RemoveBatch: Bulk removal of a gathered batch
+// Small batches go through Remove; larger ones are sorted, deduplicated and walked
+// against the set, moving every kept run at most once and shrinking once
+template <typename Data, typename Alloc, typename Compare>
+ulong SetVec<Data, Alloc, Compare>::RemoveBatch(SortableVector<Data, Alloc>& batch) {
+  ulong count = batch.Size();
+  if (count <= SmallBatch) {
+    ulong removed = 0;
+    for (ulong index = 0; index < count; ++index) {
+      removed += Remove(batch[index]) ? 1 : 0;
+    }
+    return removed;
+  }
+
+  batch.SortBy(order.Comparator());
+  Data* first = batch.begin();
+  count = std::unique(first, first + count, [this](const Data& a, const Data& b) { return order.Equivalent(a, b); }) - first;
+
+  ulong kept = 0;
+  ulong run = 0; // Start of the kept elements not moved down yet
+  ulong before = 0; // Removed elements that preceded the one at 'current'
+  for (ulong i = 0, j = 0; i < size; ++i) {
+    while (j < count && order.Less(batch[j], Elements[i])) {
+      ++j;
+    }
+    if (j < count && !order.Less(Elements[i], batch[j])) {
+      before += (i < current) ? 1 : 0;
+      ++j;
+      // Kept runs move down in one block (a memmove for trivially copyable data)
+      this->Shift(Elements + run, Elements + i, Elements + kept);
+      kept += i - run;
+      run = i + 1;
+    }
+  }
+  this->Shift(Elements + run, Elements + size, Elements + kept);
+  kept += size - run;
+
+  ulong removed = size - kept;
+  if (removed == 0) {
+    return 0;
+  }
+  Changed();
+  std::destroy_n(Elements + kept, removed);
+  size = kept;
+  current = (size > 0) ? (current - before) % size : 0;
+  ShrinkCapacity(); // A single reallocation, however many elements were removed
+  return removed;
+}
+
+// Gallop: Probes from, from + 1, from + 2, from + 4, ... until an element is not
+// less than data, then binary searches the last gap
+template <typename Data, typename Alloc, typename Compare>
+ulong SetVec<Data, Alloc, Compare>::Gallop(const Data* elements, ulong from, ulong to, const Data& data) const noexcept {
+  ulong low = from;  // Every element before 'low' is less than data
+  ulong high = from; // Next probe; at the end, elements[high] >= data or high == to
+  ulong step = 1;
+  while (high < to && order.Less(elements[high], data)) {
+    low = high + 1;
+    high = from + step;
+    step *= 2;
+  }
+  if (high > to) {
+    high = to;
+  }
+  while (low < high) {
+    ulong mid = low + (high - low) / 2;
+    if (order.Less(elements[mid], data)) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+// Combine: Walks both sorted arrays once
+// Runs of elements found on one side only are handed to emit in one call; with
+// galloping their end is found by Gallop instead of one comparison per element
+template <typename Data, typename Alloc, typename Compare>
+template <typename Emit>
+ulong SetVec<Data, Alloc, Compare>::Combine(const SetVec& other, unsigned keep, Emit&& emit) const {
+  const Data* left = Elements;
+  const Data* right = other.Elements;
+  ulong leftSize = size;
+  ulong rightSize = other.size;
+  bool gallop = (leftSize > rightSize) ? (leftSize / (rightSize + 1) >= GallopRatio)
+                                       : (rightSize / (leftSize + 1) >= GallopRatio);
+
+  ulong out = 0;    // Elements emitted so far
+  ulong mark = 0;   // Output position of the element at 'current'
+  bool marked = false;
+  ulong i = 0;
+  ulong j = 0;
+
+  auto leftRun = [&](ulong end) {
+    bool kept = (keep & KeepLeft) != 0;
+    if (!marked && current < end) {
+      mark = out + (kept ? current - i : 0);
+      marked = true;
+    }
+    if (kept && end > i) {
+      emit(false, i, end - i);
+      out += end - i;
+    }
+    i = end;
+  };
+  auto rightRun = [&](ulong end) {
+    if ((keep & KeepRight) && end > j) {
+      emit(true, j, end - j);
+      out += end - j;
+    }
+    j = end;
+  };
+
+  while (i < leftSize && j < rightSize) {
+    std::weak_ordering side = order.ThreeWay(left[i], right[j]); // One comparison per step
+    if (side < 0) {
+      leftRun(gallop ? Gallop(left, i + 1, leftSize, right[j]) : i + 1);
+    } else if (side > 0) {
+      rightRun(gallop ? Gallop(right, j + 1, rightSize, left[i]) : j + 1);
+    } else {
+      if (!marked && current == i) {
+        mark = out;
+        marked = true;
+      }
+      if (keep & KeepCommon) {
+        emit(false, i, 1);
+        ++out;
+      }
+      ++i;
+      ++j;
+    }
+  }
+  leftRun(leftSize);
+  rightRun(rightSize);
+  return mark;
+}
+
+// Combined: Copies the kept runs into a new set sized for the worst case
+template <typename Data, typename Alloc, typename Compare>
+SetVec<Data, Alloc, Compare> SetVec<Data, Alloc, Compare>::Combined(const SetVec& other, unsigned keep) const {
+  ulong bound = 0;
+  if (keep & KeepLeft) {
+    bound += size;
+  } else if (keep & KeepCommon) {
+    bound += (size < other.size) ? size : other.size;
+  }
+  if (keep & KeepRight) {
+    bound += other.size;
+  }
+
+  SetVec result(this->GetAllocator());
+  result.EnsureCapacity(bound);
+  ulong mark = Combine(other, keep, [&](bool fromOther, ulong index, ulong count) {
+    const Data* source = (fromOther ? other.Elements : Elements) + index;
+    for (ulong k = 0; k < count; ++k) {
+      result.EmplaceBack(source[k]);
+    }
+  });
+  result.current = (result.size > 0) ? mark % result.size : 0;
+  return result;
+}
+
+// CompactWith: Kept runs are moved down over the dropped ones, so every element
+// moves at most once; the capacity is adjusted once at the end
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::CompactWith(const SetVec& other, unsigned keep) {
+  ulong kept = 0;
+  ulong mark = Combine(other, keep, [this, &kept](bool, ulong index, ulong count) {
+    this->Shift(Elements + index, Elements + index + count, Elements + kept);
+    kept += count;
+  });
+
+  ulong removed = size - kept;
+  if (removed == 0) {
+    return;
+  }
+  Changed();
+  std::destroy_n(Elements + kept, removed);
+  size = kept;
+  current = (size > 0) ? mark % size : 0;
+  ShrinkCapacity();
+}
+
+// FreshFrom: Only the elements missing from this set are copied
+template <typename Data, typename Alloc, typename Compare>
+SortableVector<Data, Alloc> SetVec<Data, Alloc, Compare>::FreshFrom(const SetVec& other) const {
+  SortableVector<Data, Alloc> fresh(this->GetAllocator());
+  Combine(other, KeepRight, [&](bool, ulong index, ulong count) {
+    for (ulong k = 0; k < count; ++k) {
+      fresh.PushBack(other.Elements[index + k]);
+    }
+  });
+  return fresh;
+}
+
+// BuildFrozen: In-order walk of the implicit tree, so that the sorted elements
+// land in breadth-first positions (node k has children 2k and 2k + 1)
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::BuildFrozen(Data* layout, ulong& index, ulong node) const {
+  if (node <= size) {
+    BuildFrozen(layout, index, 2 * node);
+    std::construct_at(layout + node - 1, Elements[index]);
+    ++index;
+    BuildFrozen(layout, index, 2 * node + 1);
+  }
+}
+
+// DestroyFrozen: Same in-order walk as BuildFrozen, stopping once 'count' elements are destroyed
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::DestroyFrozen(Data* layout, ulong& count, ulong node) const noexcept {
+  if (node <= size && count > 0) {
+    DestroyFrozen(layout, count, 2 * node);
+    if (count > 0) {
+      std::destroy_at(layout + node - 1);
+      --count;
+      DestroyFrozen(layout, count, 2 * node + 1);
+    }
+  }
+}
+
+// FrozenDescend: One comparison per level and no data-dependent branch; the lines
+// holding the nodes a few levels below are prefetched while the current one is compared
+// Each bit of the returned index below the leading one records a turn (1 = right)
+template <typename Data, typename Alloc, typename Compare>
+template <bool Upper>
+ulong SetVec<Data, Alloc, Compare>::FrozenDescend(const Data& data) const noexcept {
+  constexpr ulong lookahead = (sizeof(Data) < 64) ? 64 / sizeof(Data) : 1;
+  const Data* layout = frozen;
+  ulong node = 1;
+  while (node <= size) {
+#if defined(__GNUC__)
+    ulong ahead = node * lookahead;
+    __builtin_prefetch(layout + (ahead <= size ? ahead - 1 : 0));
+#endif
+    if constexpr (Upper) {
+      node = 2 * node + !order.Less(data, layout[node - 1]);
+    } else {
+      node = 2 * node + order.Less(layout[node - 1], data);
+    }
+  }
+  return node;
+}
+
+// Changed: Called by every operation that changes the elements
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::Changed() noexcept {
+  Thaw();
+  model.stale = true;
+}
+
+// RootSegment: Linear map from the key range onto the segments, clamped at both ends
+// It is non-decreasing in the key, so each segment holds a contiguous run of elements
+template <typename Data, typename Alloc, typename Compare>
+ulong SetVec<Data, Alloc, Compare>::RootSegment(double key) const noexcept {
+  double root = (key - model.minKey) * model.rootScale;
+  ulong last = model.segments.Size() - 1;
+  if (!(root > 0.0)) {
+    return 0;
+  }
+  return (root >= static_cast<double>(last)) ? last : static_cast<ulong>(root);
+}
+
+// BuildModel: Two-level model in O(n)
+// The root spreads the key range over about one segment per ModelSpan elements; each
+// segment interpolates between its first and last key and records how far the
+// prediction can be from the true position
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::BuildModel() const {
+  model.stale = true;
+  if (size == 0) {
+    return;
+  }
+  double minKey = static_cast<double>(Elements[0]);
+  double range = static_cast<double>(Elements[size - 1]) - minKey;
+  if (!std::isfinite(minKey) || !std::isfinite(range)) {
+    return; // Infinite keys cannot be interpolated: BinarySearch stays in charge
+  }
+
+  ulong count = (size + ModelSpan - 1) / ModelSpan;
+  Vector<ModelSegment, SegmentAlloc> segments(count, model.segments.GetAllocator());
+  model.segments = std::move(segments);
+  model.minKey = minKey;
+  model.rootScale = (range > 0.0) ? static_cast<double>(count) / range : 0.0;
+
+  // Segment boundaries
+  ModelSegment* segment = model.segments.begin();
+  ulong next = 0;
+  for (ulong index = 0; index < size; ++index) {
+    ulong target = RootSegment(static_cast<double>(Elements[index]));
+    for (; next <= target; ++next) {
+      segment[next].start = index;
+    }
+  }
+  for (; next < count; ++next) {
+    segment[next].start = size;
+  }
+  for (ulong s = 0; s < count; ++s) {
+    segment[s].end = (s + 1 < count) ? segment[s + 1].start : size;
+  }
+
+  // Per-segment interpolation and error bounds
+  for (ulong s = 0; s < count; ++s) {
+    ModelSegment& seg = segment[s];
+    if (seg.end == seg.start) {
+      continue;
+    }
+    seg.firstKey = static_cast<double>(Elements[seg.start]);
+    double span = static_cast<double>(Elements[seg.end - 1]) - seg.firstKey;
+    seg.slope = (span > 0.0) ? static_cast<double>(seg.end - seg.start - 1) / span : 0.0;
+    seg.errLo = 0.0;
+    seg.errHi = 0.0;
+    for (ulong index = seg.start; index < seg.end; ++index) {
+      double predicted = static_cast<double>(seg.start) + (static_cast<double>(Elements[index]) - seg.firstKey) * seg.slope;
+      double error = static_cast<double>(index) - predicted;
+      seg.errLo = (error < seg.errLo) ? error : seg.errLo;
+      seg.errHi = (error > seg.errHi) ? error : seg.errHi;
+    }
+  }
+  model.stale = false;
+}
+
+// RefreshModel: Rebuilds a stale model; if that fails BinarySearch keeps the plain search
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::RefreshModel() const noexcept {
+  if constexpr (Modelable) {
+    if (modelEnabled && model.stale) {
+      try {
+        BuildModel();
+      } catch (...) {
+        model.stale = true;
+      }
+    }
+  }
+}
+
+// ModelWindow: Range [low, high] that must contain the lower bound of data
+// If e(L) is the lower bound and e(L - 1) its predecessor, the error bounds of
+// their predictions enclose L around the prediction for data (with a margin for rounding)
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::ModelWindow(const Data& data, ulong& low, ulong& high) const noexcept {
+  double key = static_cast<double>(data);
+  const ModelSegment& seg = model.segments.begin()[RootSegment(key)];
+  low = seg.start;
+  high = seg.end;
+  if (seg.end == seg.start) {
+    return;
+  }
+  double predicted = static_cast<double>(seg.start) + (key - seg.firstKey) * seg.slope;
+  double lowest = std::floor(predicted + seg.errLo) - 1.0;
+  double highest = std::ceil(predicted + seg.errHi) + 2.0;
+  if (highest < static_cast<double>(high)) {
+    high = (highest > static_cast<double>(low)) ? static_cast<ulong>(highest) : low;
+  }
+  if (lowest > static_cast<double>(low)) {
+    low = (lowest < static_cast<double>(high)) ? static_cast<ulong>(lowest) : high;
+  }
+}
+
+// FilterLive: A failed rebuild leaves the filter unbuilt, and Exists searches without it
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::FilterLive() const noexcept {
+  if constexpr (Filterable) {
+    if (filterEnabled && !filter.Fresh(size)) {
+      try {
+        filter.Build(*this);
+      } catch (...) {
+        filter.Invalidate();
+      }
+    }
+    return filterEnabled && filter.Built();
+  } else {
+    return false;
+  }
+}
+
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::FilterRejects(const Data& data) const noexcept {
+  if constexpr (Filterable) {
+    return filter.Rejects(data);
+  } else {
+    return false;
+  }
+}
+
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::FilterAdd(const Data& data) noexcept {
+  if constexpr (Filterable) {
+    if (filterEnabled) {
+      filter.Add(data);
+    }
+  }
+}
+
 /* ************************************************************************** */
 
 // SPECIALIZED CONSTRUCTORS
 // Various construction methods for different initialization scenarios
 
+// Allocator constructor: Creates an empty set using the given allocator
+template <typename Data, typename Alloc, typename Compare>
+SetVec<Data, Alloc, Compare>::SetVec(const Alloc& allocator) noexcept : SortableVector<Data, Alloc>(allocator), model(allocator), filter(allocator) {}
+
 // Capacity constructor: Creates set with specified initial capacity
 // Useful for performance optimization when expected size is known
 // The vector is initialized with default values and then sorted
-template <typename Data>
-SetVec<Data>::SetVec(const ulong initialSize) : SortableVector<Data>(initialSize) {
+template <typename Data, typename Alloc, typename Compare>
+SetVec<Data, Alloc, Compare>::SetVec(const ulong initialSize, const Alloc& allocator) : SortableVector<Data, Alloc>(initialSize, allocator), model(allocator), filter(allocator) {
   // The vector is already initialized with default values by parent constructor
   // Since it's a set, we need to ensure uniqueness, but default values should be unique
-  capacity = initialSize;  // Set capacity to match the initial allocation
   Sort();                  // Ensure the vector is sorted for set operations
 }
 
 // TraversableContainer constructor: Creates set from existing container
 // Copies all elements while maintaining sorted order and uniqueness
-// Time complexity: O(n log n) due to sorted insertion for each element
-template <typename Data>
-SetVec<Data>::SetVec(const TraversableContainer<Data>& container) : SortableVector<Data>() {
-  // Insert all elements from the traversable container, ensuring uniqueness
-  container.Traverse([this](const Data& data) {
-    if (CheckUnique(data)) {
-      // Use binary search to find the correct insertion point
-      long insertPoint;
-      BinarySearch(data, &insertPoint);
-      
-      // Ensure we have capacity for one more element
-      EnsureCapacity(size + 1);
-      
-      // Shift elements to the right to make room for insertion
-      for (ulong i = size; i > static_cast<ulong>(insertPoint); i--) {
-        Elements[i] = Elements[i - 1];
-      }
-      
-      // Insert the new element at the correct sorted position
-      Elements[insertPoint] = data;
-      size++; // Increment size after successful insertion
-    }
-  });
+// Time complexity: O(n log n) - the copies are sorted and deduplicated in bulk
+template <typename Data, typename Alloc, typename Compare>
+SetVec<Data, Alloc, Compare>::SetVec(const TraversableContainer<Data>& container, const Alloc& allocator) : SortableVector<Data, Alloc>(allocator), model(allocator), filter(allocator) {
+  SortableVector<Data, Alloc> batch(container, allocator);
+  InsertBatch(batch);
 }
 
 // MappableContainer constructor: Creates set by moving from container
 // Efficiently transfers elements using move semantics for better performance
-// Time complexity: O(n log n) due to sorted insertion with move operations
-template <typename Data>
-SetVec<Data>::SetVec(MappableContainer<Data>&& container) : SortableVector<Data>() {
-  // Insert all elements from the mappable container using move semantics
-  container.Map([this](Data& data) {
-    if (CheckUnique(data)) {
-      // Use binary search to find the correct insertion point
-      long insertPoint;
-      BinarySearch(data, &insertPoint);
-      
-      // Ensure we have capacity for one more element
-      EnsureCapacity(size + 1);
-      
-      // Shift elements to the right to make room for insertion
-      for (ulong i = size; i > static_cast<ulong>(insertPoint); i--) {
-        Elements[i] = Elements[i - 1];
-      }
-      
-      // Insert the new element using move semantics for efficiency
-      Elements[insertPoint] = std::move(data);
-      size++; // Increment size after successful insertion
-    }
-  });
+// Time complexity: O(n log n) - the moved elements are sorted and deduplicated in bulk
+template <typename Data, typename Alloc, typename Compare>
+SetVec<Data, Alloc, Compare>::SetVec(MappableContainer<Data>&& container, const Alloc& allocator) : SortableVector<Data, Alloc>(allocator), model(allocator), filter(allocator) {
+  SortableVector<Data, Alloc> batch(std::move(container), allocator);
+  InsertBatch(batch);
   
   // Properly clear the source container if it supports clearing
   // This ensures the moved-from container is in a clean state
@@ -190,24 +654,26 @@ SetVec<Data>::SetVec(MappableContainer<Data>&& container) : SortableVector<Data>
 
 // Copy constructor: Creates deep copy while preserving all state
 // Copies both the sorted elements and the circular access position
-template <typename Data>
-SetVec<Data>::SetVec(const SetVec<Data>& other) : SortableVector<Data>(other), current(other.current) {
+template <typename Data, typename Alloc, typename Compare>
+SetVec<Data, Alloc, Compare>::SetVec(const SetVec<Data, Alloc, Compare>& other) : SortableVector<Data, Alloc>(other), current(other.current), modelEnabled(other.modelEnabled), model(this->GetAllocator()), filterEnabled(other.filterEnabled), filter(other.filter) {
   // The parent constructor copies the actual elements (other.size elements)
-  // We need to set our capacity to match the actual allocated space
-  // Note: We set capacity to match size, not other.capacity, for memory efficiency
-  capacity = this->size;
+  // into a buffer whose capacity matches the size, for memory efficiency
 }
 
 // Move constructor: Efficiently transfers ownership from another SetVec
 // Transfers all resources without copying, leaving the source in a valid empty state
-template <typename Data>
-SetVec<Data>::SetVec(SetVec<Data>&& other) noexcept : SortableVector<Data>(std::move(other)), current(other.current), capacity(other.capacity) {
-  // The parent move constructor handles the transfer of the entire vector
-  // We safely copy the capacity since we're taking ownership of the entire object
+template <typename Data, typename Alloc, typename Compare>
+SetVec<Data, Alloc, Compare>::SetVec(SetVec<Data, Alloc, Compare>&& other) noexcept : SortableVector<Data, Alloc>(std::move(other)), current(other.current), frozen(std::exchange(other.frozen, nullptr)), frozenSize(std::exchange(other.frozenSize, 0)), modelEnabled(other.modelEnabled), model(std::move(other.model)), filterEnabled(other.filterEnabled), filter(std::move(other.filter)) {
+  // The parent move constructor transfers the entire vector, capacity included
   
   // Leave the moved-from object in a valid empty state
   other.current = 0;
-  other.capacity = 0;
+}
+
+// Destructor: Releases the frozen layout while the allocator that provided it is still there
+template <typename Data, typename Alloc, typename Compare>
+SetVec<Data, Alloc, Compare>::~SetVec() {
+  Thaw();
 }
 
 /* ************************************************************************** */
@@ -217,33 +683,48 @@ SetVec<Data>::SetVec(SetVec<Data>&& other) noexcept : SortableVector<Data>(std::
 
 // Copy assignment: Replaces current content with deep copy of another set
 // Handles self-assignment and maintains all SetVec-specific state
-template <typename Data>
-SetVec<Data>& SetVec<Data>::operator=(const SetVec<Data>& other) {
+template <typename Data, typename Alloc, typename Compare>
+SetVec<Data, Alloc, Compare>& SetVec<Data, Alloc, Compare>::operator=(const SetVec<Data, Alloc, Compare>& other) {
   if (this != &other) { // Guard against self-assignment
+    Thaw(); // Released through the current allocator, which the assignment may replace
+
     // Delegate array copying to parent class assignment operator
-    SortableVector<Data>::operator=(other);
+    SortableVector<Data, Alloc>::operator=(other);
     
     // Copy SetVec-specific state
     current = other.current;
-    
-    // Set capacity to match the actual size copied for memory efficiency
-    // We don't copy other.capacity to avoid over-allocation
-    capacity = this->size;
+    modelEnabled = other.modelEnabled;
+    Changed(); // The copy starts with the sorted layout only, and rebuilds its model on demand
+    model = SearchModel(this->GetAllocator()); // The allocator may have propagated
+    filterEnabled = other.filterEnabled;
+    filter = BloomFilter<Data, Alloc>(other.filter.BitsPerKey(), this->GetAllocator()); // Likewise built by the first lookup
   }
   return *this; // Enable assignment chaining
 }
 
 // Move assignment: Efficiently transfers ownership from another SetVec
 // Swaps resources to avoid unnecessary copying and maintain exception safety
-template <typename Data>
-SetVec<Data>& SetVec<Data>::operator=(SetVec<Data>&& other) noexcept {
+template <typename Data, typename Alloc, typename Compare>
+SetVec<Data, Alloc, Compare>& SetVec<Data, Alloc, Compare>::operator=(SetVec<Data, Alloc, Compare>&& other) noexcept(SortableVector<Data, Alloc>::NothrowMoveAssign) {
   if (this != &other) { // Guard against self-move
+    Thaw(); // Released through the current allocator, which the assignment may replace
+    bool handedOver = SortableVector<Data, Alloc>::NothrowMoveAssign || this->GetAllocator() == other.GetAllocator();
+
     // Delegate array moving to parent class move assignment operator
-    SortableVector<Data>::operator=(std::move(other));
+    SortableVector<Data, Alloc>::operator=(std::move(other));
     
     // Swap SetVec-specific state for exception safety
     std::swap(current, other.current);
-    std::swap(capacity, other.capacity);
+    if (handedOver) {
+      std::swap(frozen, other.frozen); // The other layout's allocator came along with its elements
+      std::swap(frozenSize, other.frozenSize);
+    } else {
+      other.Thaw();
+    }
+    std::swap(modelEnabled, other.modelEnabled);
+    std::swap(model, other.model);
+    std::swap(filterEnabled, other.filterEnabled);
+    std::swap(filter, other.filter);
   }
   return *this; // Enable assignment chaining
 }
@@ -256,8 +737,8 @@ SetVec<Data>& SetVec<Data>::operator=(SetVec<Data>&& other) noexcept {
 // Equality operator: Tests if sets contain identical elements in same order
 // Compares the actual sorted content regardless of circular access position
 // Two sets are equal if they have the same size and same elements in same order
-template <typename Data>
-bool SetVec<Data>::operator==(const SetVec<Data>& other) const noexcept {
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::operator==(const SetVec<Data, Alloc, Compare>& other) const noexcept {
   if (size != other.size) {
     return false; // Different sizes cannot be equal
   }
@@ -266,7 +747,7 @@ bool SetVec<Data>::operator==(const SetVec<Data>& other) const noexcept {
   // This ensures comparison is based on actual content, not current position
   // Both sets maintain sorted order, so direct comparison is sufficient
   for (ulong i = 0; i < size; i++) {
-    if (Elements[i] != other.Elements[i]) {
+    if (!order.Equivalent(Elements[i], other.Elements[i])) {
       return false; // Found differing elements
     }
   }
@@ -276,8 +757,8 @@ bool SetVec<Data>::operator==(const SetVec<Data>& other) const noexcept {
 
 // Inequality operator: Tests if sets differ in content or order
 // Simply negates the equality result for efficient implementation
-template <typename Data>
-bool SetVec<Data>::operator!=(const SetVec<Data>& other) const noexcept {
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::operator!=(const SetVec<Data, Alloc, Compare>& other) const noexcept {
   return !(*this == other); // Logical negation of equality
 }
 
@@ -288,15 +769,14 @@ bool SetVec<Data>::operator!=(const SetVec<Data>& other) const noexcept {
 
 // Clear: Removes all elements and resets the set to empty state
 // Resets all SetVec-specific state including circular access position and capacity
-template <typename Data>
-void SetVec<Data>::Clear() {
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::Clear() {
   // Reset circular access position to beginning
   current = 0;
+  Changed();
   
-  // Clear the underlying vector data and reset size
-  this->size = 0;
-  this->Resize(0);  // Release allocated memory
-  capacity = 0;     // Reset capacity tracking
+  // Clear the underlying vector data, releasing the storage and its capacity
+  this->Resize(0);
 }
 
 /* ************************************************************************** */
@@ -306,11 +786,30 @@ void SetVec<Data>::Clear() {
 
 // Exists: Tests if element exists in set using O(log n) binary search
 // Leverages the sorted nature of the array for efficient searching
-template <typename Data>
-bool SetVec<Data>::Exists(const Data& data) const noexcept {
-  // Use FindIndex which internally uses binary search
-  // Returns true if element is found (index >= 0), false otherwise
-  return FindIndex(data) >= 0;
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::Exists(const Data& data) const noexcept {
+  // The filter answers most lookups of absent elements without searching
+  bool filtered = FilterLive();
+  if (filtered && FilterRejects(data)) {
+    return false;
+  }
+
+  bool found;
+  if (IsFrozen()) {
+    // Undo the left turns after the last right one: what remains is the lower bound
+    ulong node = FrozenDescend<false>(data);
+    node >>= std::countr_one(node) + 1;
+    found = node != 0 && !order.Less(data, frozen[node - 1]);
+  } else {
+    // Use FindIndex which internally uses binary search
+    // Returns true if element is found (index >= 0), false otherwise
+    found = FindIndex(data) >= 0;
+  }
+
+  if (filtered && !found) {
+    filter.Missed(); // A false positive of the filter
+  }
+  return found;
 }
 
 /* ************************************************************************** */
@@ -320,8 +819,8 @@ bool SetVec<Data>::Exists(const Data& data) const noexcept {
 
 // Min: Returns the smallest element in the set
 // Time complexity: O(1) - minimum is always at index 0 in sorted array
-template <typename Data>
-const Data& SetVec<Data>::Min() const {
+template <typename Data, typename Alloc, typename Compare>
+const Data& SetVec<Data, Alloc, Compare>::Min() const {
   if (size == 0) {
     throw std::length_error("Access to an empty set.");
   }
@@ -331,58 +830,52 @@ const Data& SetVec<Data>::Min() const {
 }
 
 // MinNRemove: Returns and removes the smallest element atomically
-// Time complexity: O(n) due to shifting elements after removal
-template <typename Data>
-Data SetVec<Data>::MinNRemove() {
+// Time complexity: O(1) amortized - the array start just moves past the minimum
+template <typename Data, typename Alloc, typename Compare>
+Data SetVec<Data, Alloc, Compare>::MinNRemove() {
   if (size == 0) {
     throw std::length_error("Access to an empty set.");
   }
   
   // Store the minimum element before removal
-  Data min = Elements[0];
-  
-  // Shift all elements one position to the left to fill the gap
-  for (ulong i = 0; i < size - 1; i++) {
-    Elements[i] = Elements[i + 1];
-  }
+  Data min = std::move(Elements[0]);
   
   // Adjust current position if necessary after removal
   if (current > 0) {
     current = (current - 1) % size; // Adjust for removal at beginning
   }
   
-  size--;             // Decrement size
+  // The first slot becomes a front slot, so no element moves
+  Changed();
+  this->PopFrontSlot();  // Also decrements size
   ShrinkCapacity();   // Optimize memory usage if needed
   
   return min; // Return the removed minimum value
 }
 
 // RemoveMin: Removes the smallest element without returning it
-// More efficient when the value is not needed
-template <typename Data>
-void SetVec<Data>::RemoveMin() {
+// More efficient when the value is not needed; O(1) amortized like MinNRemove
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::RemoveMin() {
   if (size == 0) {
     throw std::length_error("Access to an empty set.");
   }
   
-  // Shift all elements one position to the left
-  for (ulong i = 0; i < size - 1; i++) {
-    Elements[i] = Elements[i + 1];
-  }
-  
   // Adjust current position if necessary after removal
   if (current > 0) {
     current = (current - 1) % size; // Adjust for removal at beginning
   }
   
-  size--;             // Decrement size
+  // The first slot becomes a front slot, so no element moves
+  Changed();
+  this->PopFrontSlot();  // Also decrements size
   ShrinkCapacity();   // Optimize memory usage if needed
 }
 
 // Max: Returns the largest element in the set
 // Time complexity: O(1) - maximum is always at last index in sorted array
-template <typename Data>
-const Data& SetVec<Data>::Max() const {
+template <typename Data, typename Alloc, typename Compare>
+const Data& SetVec<Data, Alloc, Compare>::Max() const {
   if (size == 0) {
     throw std::length_error("Access to an empty set.");
   }
@@ -393,14 +886,14 @@ const Data& SetVec<Data>::Max() const {
 
 // MaxNRemove: Returns and removes the largest element atomically
 // Time complexity: O(1) since removal is at the end (no shifting needed)
-template <typename Data>
-Data SetVec<Data>::MaxNRemove() {
+template <typename Data, typename Alloc, typename Compare>
+Data SetVec<Data, Alloc, Compare>::MaxNRemove() {
   if (size == 0) {
     throw std::length_error("Access to an empty set.");
   }
   
   // Store the maximum element before removal
-  Data max = Elements[size - 1];
+  Data max = std::move(Elements[size - 1]);
   
   // Adjust current position if necessary before size change
   if (size == 1) {
@@ -411,7 +904,8 @@ Data SetVec<Data>::MaxNRemove() {
     current = size - 2;
   }
   
-  size--;             // Decrement size (no shifting needed for last element)
+  Changed();
+  this->RemoveAt(size - 1); // Decrement size (no shifting needed for last element)
   ShrinkCapacity();   // Optimize memory usage if needed
   
   return max; // Return the removed maximum value
@@ -419,8 +913,8 @@ Data SetVec<Data>::MaxNRemove() {
 
 // RemoveMax: Removes the largest element without returning it
 // Most efficient min/max removal since no shifting is required
-template <typename Data>
-void SetVec<Data>::RemoveMax() {
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::RemoveMax() {
   if (size == 0) {
     throw std::length_error("Access to an empty set.");
   }
@@ -434,7 +928,8 @@ void SetVec<Data>::RemoveMax() {
     current = size - 2;
   }
   
-  size--;             // Decrement size (no shifting needed for last element)
+  Changed();
+  this->RemoveAt(size - 1); // Decrement size (no shifting needed for last element)
   ShrinkCapacity();   // Optimize memory usage if needed
 }
 
@@ -444,12 +939,23 @@ void SetVec<Data>::RemoveMax() {
 // Predecessor: Finds the largest element smaller than the given data
 // Uses binary search to efficiently locate the predecessor in sorted array
 // Time complexity: O(log n) for the search operation
-template <typename Data>
-const Data& SetVec<Data>::Predecessor(const Data& data) const {
+template <typename Data, typename Alloc, typename Compare>
+const Data& SetVec<Data, Alloc, Compare>::Predecessor(const Data& data) const {
   if (this->size == 0) {
     throw std::length_error("Access to an empty set.");
   }
 
+  if (IsFrozen()) {
+    // The predecessor is the last node where the descent turned right
+    ulong node = FrozenDescend<false>(data);
+    node >>= std::countr_zero(node) + 1;
+    if (node == 0) {
+      throw std::length_error("Predecessor not found.");
+    }
+    return frozen[node - 1];
+  }
+
+  RefreshModel();
   long insertPointVal;
   long exactMatchIndex = this->BinarySearch(data, &insertPointVal);
   long predecessorIndex = -1;
@@ -473,8 +979,8 @@ const Data& SetVec<Data>::Predecessor(const Data& data) const {
 // PredecessorNRemove: Finds, returns, and removes the predecessor atomically
 // Combines predecessor finding with removal for atomic operation
 // Time complexity: O(n) due to element shifting after removal
-template <typename Data>
-Data SetVec<Data>::PredecessorNRemove(const Data& data) {
+template <typename Data, typename Alloc, typename Compare>
+Data SetVec<Data, Alloc, Compare>::PredecessorNRemove(const Data& data) {
   if (this->size == 0) {
     throw std::length_error("Access to an empty set.");
   }
@@ -495,12 +1001,8 @@ Data SetVec<Data>::PredecessorNRemove(const Data& data) {
   }
 
   // Store the predecessor data before removing it
-  Data predecessorData = this->Elements[predecessorIndex];
+  Data predecessorData = std::move(this->Elements[predecessorIndex]);
   
-  // Remove the predecessor by shifting all subsequent elements left
-  for (ulong i = static_cast<ulong>(predecessorIndex); i < this->size - 1; ++i) {
-    this->Elements[i] = this->Elements[i + 1];
-  }
 
   // Adjust current position based on removal location
   if (static_cast<ulong>(predecessorIndex) < current) {
@@ -514,8 +1016,9 @@ Data SetVec<Data>::PredecessorNRemove(const Data& data) {
     }
   }
   
-  // Decrement size and handle edge cases
-  this->size--;
+  // Remove the predecessor by shifting all subsequent elements left (decrements size)
+  Changed();
+  this->RemoveNear(predecessorIndex);
   
   if (size == 0) {
     current = 0; // Reset current for empty set
@@ -528,8 +1031,8 @@ Data SetVec<Data>::PredecessorNRemove(const Data& data) {
 
 // RemovePredecessor: Removes the predecessor without returning its value
 // More efficient when the predecessor value is not needed
-template <typename Data>
-void SetVec<Data>::RemovePredecessor(const Data& data) {
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::RemovePredecessor(const Data& data) {
   if (this->size == 0) {
     throw std::length_error("Access to an empty set.");
   }
@@ -553,13 +1056,10 @@ void SetVec<Data>::RemovePredecessor(const Data& data) {
   bool removingCurrent = (static_cast<ulong>(predecessorIndex) == current);
   bool removingBeforeCurrent = (static_cast<ulong>(predecessorIndex) < current);
   
-  // Remove the predecessor by shifting all subsequent elements left
-  for (ulong i = static_cast<ulong>(predecessorIndex); i < this->size - 1; ++i) {
-    this->Elements[i] = this->Elements[i + 1];
-  }
 
-  // Decrement size first
-  this->size--;
+  // Remove the predecessor by shifting all subsequent elements left (decrements size)
+  Changed();
+  this->RemoveNear(predecessorIndex);
   
   // Adjust current position based on what was removed
   if (size == 0) {
@@ -586,12 +1086,23 @@ void SetVec<Data>::RemovePredecessor(const Data& data) {
 // Successor: Finds the smallest element larger than the given data
 // Uses binary search to efficiently locate the successor in sorted array
 // Time complexity: O(log n) for the search operation
-template <typename Data>
-const Data& SetVec<Data>::Successor(const Data& data) const {
+template <typename Data, typename Alloc, typename Compare>
+const Data& SetVec<Data, Alloc, Compare>::Successor(const Data& data) const {
   if (this->size == 0) {
     throw std::length_error("Access to an empty set.");
   }
 
+  if (IsFrozen()) {
+    // The successor is the last node where the descent turned left
+    ulong node = FrozenDescend<true>(data);
+    node >>= std::countr_one(node) + 1;
+    if (node == 0) {
+      throw std::length_error("Successor not found.");
+    }
+    return frozen[node - 1];
+  }
+
+  RefreshModel();
   long insertPointVal; 
   long exactMatchIndex = this->BinarySearch(data, &insertPointVal);
   long successorIndex = -1;
@@ -616,8 +1127,8 @@ const Data& SetVec<Data>::Successor(const Data& data) const {
 // SuccessorNRemove: Finds, returns, and removes the successor atomically
 // Combines successor finding with removal for atomic operation
 // Time complexity: O(n) due to element shifting after removal
-template <typename Data>
-Data SetVec<Data>::SuccessorNRemove(const Data& data) {
+template <typename Data, typename Alloc, typename Compare>
+Data SetVec<Data, Alloc, Compare>::SuccessorNRemove(const Data& data) {
   if (this->size == 0) {
     throw std::length_error("Access to an empty set.");
   }
@@ -640,12 +1151,8 @@ Data SetVec<Data>::SuccessorNRemove(const Data& data) {
   }
 
   // Store the successor data before removing it
-  Data successorData = this->Elements[successorIndex];
+  Data successorData = std::move(this->Elements[successorIndex]);
 
-  // Remove the successor by shifting all subsequent elements left
-  for (ulong i = static_cast<ulong>(successorIndex); i < this->size - 1; ++i) {
-    this->Elements[i] = this->Elements[i + 1];
-  }
   
   // Adjust current position based on removal location
   if (static_cast<ulong>(successorIndex) < this->current && this->current > 0) {
@@ -656,8 +1163,9 @@ Data SetVec<Data>::SuccessorNRemove(const Data& data) {
       this->current = 0; // Loop around to first element
   }
 
-  // Decrement size and handle edge cases
-  this->size--;
+  // Remove the successor by shifting all subsequent elements left (decrements size)
+  Changed();
+  this->RemoveNear(successorIndex);
   ShrinkCapacity(); // Optimize memory usage
   
   // Ensure current position is valid after size change
@@ -672,8 +1180,8 @@ Data SetVec<Data>::SuccessorNRemove(const Data& data) {
 
 // RemoveSuccessor: Removes the successor without returning its value
 // More efficient when the successor value is not needed
-template <typename Data>
-void SetVec<Data>::RemoveSuccessor(const Data& data) {
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::RemoveSuccessor(const Data& data) {
   if (this->size == 0) {
     throw std::length_error("Access to an empty set.");
   }
@@ -695,10 +1203,6 @@ void SetVec<Data>::RemoveSuccessor(const Data& data) {
     throw std::length_error("Successor not found.");
   }
 
-  // Remove the successor by shifting all subsequent elements left
-  for (ulong i = static_cast<ulong>(successorIndex); i < this->size - 1; ++i) {
-    this->Elements[i] = this->Elements[i + 1];
-  }
 
   // Adjust current position based on removal location
   if (static_cast<ulong>(successorIndex) < this->current && this->current > 0) {
@@ -709,8 +1213,9 @@ void SetVec<Data>::RemoveSuccessor(const Data& data) {
       this->current = 0; // Loop around to first element
   }
   
-  // Decrement size and handle edge cases
-  this->size--;
+  // Remove the successor by shifting all subsequent elements left (decrements size)
+  Changed();
+  this->RemoveNear(successorIndex);
   ShrinkCapacity(); // Optimize memory usage
 
   // Ensure current position is valid after size change
@@ -728,29 +1233,20 @@ void SetVec<Data>::RemoveSuccessor(const Data& data) {
 
 // Insert (copy version): Adds a new element to the set maintaining sorted order
 // Returns true if element was inserted, false if already exists
-// Time complexity: O(n) due to shifting elements for insertion
-template <typename Data>
-bool SetVec<Data>::Insert(const Data& data) {
-  // Check if the element already exists using binary search
-  if (!CheckUnique(data)) {
-    return false; // Element already exists, no insertion needed
-  }
-  
-  // Use binary search to find the correct insertion point to maintain order
+// Time complexity: O(n) due to shifting the shorter side of the insertion point
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::Insert(const Data& data) {
+  // One binary search yields the insertion point and rejects duplicates
+  // (searched directly, so that inserting does not rebuild a stale model)
   long insertPoint;
-  BinarySearch(data, &insertPoint);
-  
-  // Ensure we have capacity for one more element
-  EnsureCapacity(size + 1);
-  
-  // Shift all elements from insertion point to the right to make room
-  for (ulong i = size; i > static_cast<ulong>(insertPoint); i--) {
-    Elements[i] = Elements[i - 1];
+  if (BinarySearch(data, &insertPoint) >= 0) {
+    return false; // Element already exists, no insertion needed
   }
   
-  // Insert the new element at the correct position and increment size
-  Elements[insertPoint] = data;
-  size++;
+  // Shift the shorter side (growing the storage if needed) and insert the new element
+  Changed();
+  FilterAdd(data);
+  this->InsertNear(insertPoint, Data(data));
 
   // Adjust current position if insertion happened at or before current position
   if (current >= static_cast<ulong>(insertPoint)) {
@@ -762,29 +1258,20 @@ bool SetVec<Data>::Insert(const Data& data) {
 
 // Insert (move version): Adds a new element to the set using move semantics
 // More efficient for expensive-to-copy types as it moves rather than copies
-// Time complexity: O(n) due to shifting elements for insertion
-template <typename Data>
-bool SetVec<Data>::Insert(Data&& data) {
-  // Check if the element already exists using binary search
-  if (!CheckUnique(data)) {
-    return false; // Element already exists, no insertion needed
-  }
-  
-  // Use binary search to find the correct insertion point to maintain order
+// Time complexity: O(n) due to shifting the shorter side of the insertion point
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::Insert(Data&& data) {
+  // One binary search yields the insertion point and rejects duplicates
+  // (searched directly, so that inserting does not rebuild a stale model)
   long insertPoint;
-  BinarySearch(data, &insertPoint);
-  
-  // Ensure we have capacity for one more element
-  EnsureCapacity(size + 1);
-  
-  // Shift all elements from insertion point to the right to make room
-  for (ulong i = size; i > static_cast<ulong>(insertPoint); i--) {
-    Elements[i] = Elements[i - 1];
+  if (BinarySearch(data, &insertPoint) >= 0) {
+    return false; // Element already exists, no insertion needed
   }
   
-  // Insert the new element using move semantics and increment size
-  Elements[insertPoint] = std::move(data);
-  size++;
+  // Shift the shorter side (growing the storage if needed) and insert the new element
+  Changed();
+  FilterAdd(data);
+  this->InsertNear(insertPoint, std::move(data));
 
   // Adjust current position if insertion happened at or before current position
   if (current >= static_cast<ulong>(insertPoint)) {
@@ -797,19 +1284,14 @@ bool SetVec<Data>::Insert(Data&& data) {
 // Remove: Removes an element from the set if it exists
 // Uses binary search to locate element, then shifts remaining elements left
 // Time complexity: O(n) due to element shifting after removal
-template <typename Data>
-bool SetVec<Data>::Remove(const Data& data) {
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::Remove(const Data& data) {
   // Use binary search to find the element
   long index = BinarySearch(data);
   if (index < 0) {
     return false; // Element not found, nothing to remove
   }
   
-  // Remove the element by shifting all subsequent elements left
-  for (ulong i = index; i < size - 1; i++) {
-    Elements[i] = Elements[i + 1];
-  }
-  
   // Adjust current position based on removal location
   if (index >= 0 && current > static_cast<ulong>(index)) {
     current--; // Element removed before current, so decrement current index
@@ -817,7 +1299,9 @@ bool SetVec<Data>::Remove(const Data& data) {
   // Ensure current remains within bounds using modulo for circular behavior
   current = size > 1 ? current % (size - 1) : 0;
   
-  this->size--; // Decrement size
+  // Remove the element by shifting the shorter side over it (decrements size)
+  Changed();
+  this->RemoveNear(index);
   ShrinkCapacity(); // Optimize memory usage if possible
   
   return true; // Successful removal
@@ -827,105 +1311,294 @@ bool SetVec<Data>::Remove(const Data& data) {
 // Bulk operations for inserting/removing multiple elements
 
 // InsertAll (const version): Attempts to insert all elements from a container
-// Returns true only if ALL elements were successfully inserted (none existed)
-// Uses traversal to iterate through source container elements
-template <typename Data>
-bool SetVec<Data>::InsertAll(const TraversableContainer<Data>& container) {
-  bool allInserted = true;
-  
-  // Try to insert all elements using lambda function
-  container.Traverse([this, &allInserted](const Data& data) {
-    if (!Insert(data)) {
-      allInserted = false; // At least one element already existed
-    }
-  });
-  
-  return allInserted; // True only if all elements were new and inserted
+// Returns true only if ALL elements were successfully inserted (none existed,
+// and no element appeared twice in the container)
+// The elements are copied into a batch that is merged in a single pass
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::InsertAll(const TraversableContainer<Data>& container) {
+  SortableVector<Data, Alloc> batch(container, this->GetAllocator());
+  ulong count = batch.Size();
+  return InsertBatch(batch) == count; // True only if all elements were new and inserted
 }
 
 // InsertAll (move version): Attempts to insert all elements using move semantics
 // More efficient for expensive-to-copy types as it moves elements from source
-// Empties the source container by moving its elements into this set
-template <typename Data>
-bool SetVec<Data>::InsertAll(MappableContainer<Data>&& container) {
-  bool allInserted = true;
-  
-  // Try to insert all elements using move semantics
-  container.Map([this, &allInserted](Data& data) {
-    if (!Insert(std::move(data))) {
-      allInserted = false; // At least one element already existed
-    }
-  });
-  
-  return allInserted; // True only if all elements were new and inserted
+// The whole source is moved into the batch, duplicates included
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::InsertAll(MappableContainer<Data>&& container) {
+  SortableVector<Data, Alloc> batch(std::move(container), this->GetAllocator());
+  ulong count = batch.Size();
+  return InsertBatch(batch) == count; // True only if all elements were new and inserted
 }
 
 // RemoveAll: Attempts to remove all elements present in the given container
 // Returns true only if ALL specified elements were found and removed
-// Elements not found in this set will cause the method to return false
-template <typename Data>
-bool SetVec<Data>::RemoveAll(const TraversableContainer<Data>& container) {
-  bool allRemoved = true;
-  
-  // Try to remove all specified elements
-  container.Traverse([this, &allRemoved](const Data& data) {
-    if (!Remove(data)) {
-      allRemoved = false; // At least one element was not found
-    }
-  });
-  
-  return allRemoved; // True only if all elements were found and removed
+// Elements not found in this set (or repeated in the container) make it return false
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::RemoveAll(const TraversableContainer<Data>& container) {
+  SortableVector<Data, Alloc> batch(container, this->GetAllocator());
+  ulong count = batch.Size();
+  return RemoveBatch(batch) == count; // True only if all elements were found and removed
 }
 
 // InsertSome (const version): Attempts to insert elements, succeeds if any insertion occurs
 // Returns true if at least one element was successfully inserted
 // Tolerates duplicate elements - doesn't require all insertions to succeed
-template <typename Data>
-bool SetVec<Data>::InsertSome(const TraversableContainer<Data>& container) {
-  bool someInserted = false;
-  
-  // Try to insert elements, track if any succeed
-  container.Traverse([this, &someInserted](const Data& data) {
-    if (Insert(data)) {
-      someInserted = true; // At least one element was successfully inserted
-    }
-  });
-  
-  return someInserted; // True if any element was inserted
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::InsertSome(const TraversableContainer<Data>& container) {
+  SortableVector<Data, Alloc> batch(container, this->GetAllocator());
+  return InsertBatch(batch) > 0; // True if any element was inserted
 }
 
 // InsertSome (move version): Attempts to insert elements using move semantics
 // More efficient version that moves elements from source container
 // Returns true if at least one element was successfully inserted
-template <typename Data>
-bool SetVec<Data>::InsertSome(MappableContainer<Data>&& container) {
-  bool someInserted = false;
-  
-  // Try to insert elements using move semantics
-  container.Map([this, &someInserted](Data& data) {
-    if (Insert(std::move(data))) {
-      someInserted = true; // At least one element was successfully inserted
-    }
-  });
-  
-  return someInserted; // True if any element was inserted
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::InsertSome(MappableContainer<Data>&& container) {
+  SortableVector<Data, Alloc> batch(std::move(container), this->GetAllocator());
+  return InsertBatch(batch) > 0; // True if any element was inserted
 }
 
 // RemoveSome: Attempts to remove elements, succeeds if any removal occurs
 // Returns true if at least one element was successfully removed
 // Tolerates missing elements - doesn't require all removals to succeed
-template <typename Data>
-bool SetVec<Data>::RemoveSome(const TraversableContainer<Data>& container) {
-  bool someRemoved = false;
-  
-  // Try to remove elements, track if any succeed
-  container.Traverse([this, &someRemoved](const Data& data) {
-    if (Remove(data)) {
-      someRemoved = true; // At least one element was successfully removed
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::RemoveSome(const TraversableContainer<Data>& container) {
+  SortableVector<Data, Alloc> batch(container, this->GetAllocator());
+  return RemoveBatch(batch) > 0; // True if any element was removed
+}
+
+/* ************************************************************************** */
+
+// READ-OPTIMIZED LAYOUT
+
+// Freeze: Copies the elements into Eytzinger order (O(n)); no-op if already frozen
+// Each slot of the raw layout is copy-constructed once; a failed copy destroys the
+// slots built so far and leaves the set thawed
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::Freeze() {
+  if (IsFrozen() || size == 0) {
+    return;
+  }
+  Data* layout = this->Allocate(size);
+  ulong built = 0;
+  try {
+    BuildFrozen(layout, built, 1);
+  } catch (...) {
+    DestroyFrozen(layout, built, 1);
+    this->Deallocate(layout, size);
+    throw;
+  }
+  frozen = layout;
+  frozenSize = size;
+}
+
+// Thaw: Drops the layout; the sorted array is always kept up to date
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::Thaw() noexcept {
+  if (IsFrozen()) {
+    std::destroy_n(frozen, frozenSize);
+    this->Deallocate(frozen, frozenSize);
+    frozen = nullptr;
+    frozenSize = 0;
+  }
+}
+
+// IsFrozen: The layout is only ever built for a non-empty set
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::IsFrozen() const noexcept {
+  return frozen != nullptr;
+}
+
+// EnableModel: Builds the model now; later rebuilds happen on the first lookup after a change
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::EnableModel() requires Modelable {
+  modelEnabled = true;
+  BuildModel();
+}
+
+// DisableModel: Goes back to plain binary search and frees the segments
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::DisableModel() noexcept {
+  modelEnabled = false;
+  model.stale = true;
+  model.segments.Clear();
+}
+
+// ModelEnabled: True if lookups may use the model
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::ModelEnabled() const noexcept {
+  return modelEnabled;
+}
+
+/* ************************************************************************** */
+
+// BLOOM PREFILTER
+
+// EnableFilter: Builds the filter now; later rebuilds happen on the first lookup that finds it stale
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::EnableFilter(ulong bitsPerKey) requires Filterable {
+  filter = BloomFilter<Data, Alloc>(bitsPerKey, this->GetAllocator());
+  filterEnabled = true;
+  filter.Build(*this);
+}
+
+// DisableFilter: Goes back to searching every lookup and frees the bits
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::DisableFilter() noexcept {
+  filterEnabled = false;
+  filter = BloomFilter<Data, Alloc>(filter.BitsPerKey(), this->GetAllocator());
+}
+
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::FilterEnabled() const noexcept {
+  return filterEnabled;
+}
+
+template <typename Data, typename Alloc, typename Compare>
+BloomStats SetVec<Data, Alloc, Compare>::FilterStats() const noexcept {
+  return filter.Stats();
+}
+
+// Map overrides: Functions applied to the elements may change them, so the layout, model and filter are reset first
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::Map(MapFun fun) {
+  Changed();
+  filter.Invalidate();
+  SortableVector<Data, Alloc>::Map(fun);
+}
+
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::PreOrderMap(MapFun fun) {
+  Changed();
+  filter.Invalidate();
+  SortableVector<Data, Alloc>::PreOrderMap(fun);
+}
+
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::PostOrderMap(MapFun fun) {
+  Changed();
+  filter.Invalidate();
+  SortableVector<Data, Alloc>::PostOrderMap(fun);
+}
+
+/* ************************************************************************** */
+
+// SET ALGEBRA
+// All operations are sorted merges driven by Combine
+
+// Union: Elements in either set
+template <typename Data, typename Alloc, typename Compare>
+SetVec<Data, Alloc, Compare> SetVec<Data, Alloc, Compare>::Union(const SetVec<Data, Alloc, Compare>& other) const {
+  return Combined(other, KeepLeft | KeepRight | KeepCommon);
+}
+
+// Intersection: Elements in both sets
+template <typename Data, typename Alloc, typename Compare>
+SetVec<Data, Alloc, Compare> SetVec<Data, Alloc, Compare>::Intersection(const SetVec<Data, Alloc, Compare>& other) const {
+  return Combined(other, KeepCommon);
+}
+
+// Difference: Elements of this set that are not in the other
+template <typename Data, typename Alloc, typename Compare>
+SetVec<Data, Alloc, Compare> SetVec<Data, Alloc, Compare>::Difference(const SetVec<Data, Alloc, Compare>& other) const {
+  return Combined(other, KeepLeft);
+}
+
+// SymmetricDifference: Elements in exactly one of the two sets
+template <typename Data, typename Alloc, typename Compare>
+SetVec<Data, Alloc, Compare> SetVec<Data, Alloc, Compare>::SymmetricDifference(const SetVec<Data, Alloc, Compare>& other) const {
+  return Combined(other, KeepLeft | KeepRight);
+}
+
+// UnionWith: Copies the missing elements, then merges them in a single pass
+// (an exception leaves the set unchanged, as in MergeSorted)
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::UnionWith(const SetVec<Data, Alloc, Compare>& other) {
+  if (this == &other) {
+    return;
+  }
+  SortableVector<Data, Alloc> fresh = FreshFrom(other);
+  if (fresh.Size() > 0) {
+    MergeSorted(fresh.begin(), fresh.Size());
+  }
+}
+
+// IntersectWith: Compacts the array keeping the common elements
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::IntersectWith(const SetVec<Data, Alloc, Compare>& other) {
+  CompactWith(other, KeepCommon);
+}
+
+// DifferenceWith: Compacts the array dropping the common elements
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::DifferenceWith(const SetVec<Data, Alloc, Compare>& other) {
+  CompactWith(other, KeepLeft);
+}
+
+// SymmetricDifferenceWith: Copies the missing elements, drops the common ones,
+// then merges the copies back in; if the merge throws, the common elements are
+// already gone and the set holds its other elements (basic guarantee)
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::SymmetricDifferenceWith(const SetVec<Data, Alloc, Compare>& other) {
+  if (this == &other) {
+    Clear();
+    return;
+  }
+  SortableVector<Data, Alloc> fresh = FreshFrom(other);
+  CompactWith(other, KeepLeft);
+  if (fresh.Size() > 0) {
+    MergeSorted(fresh.begin(), fresh.Size());
+  }
+}
+
+// IsSubsetOf: Looks up each element in the other set, resuming after the last match
+// Returns false at the first element that is missing
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::IsSubsetOf(const SetVec<Data, Alloc, Compare>& other) const noexcept {
+  if (size > other.size) {
+    return false;
+  }
+  bool gallop = other.size / (size + 1) >= GallopRatio;
+  ulong j = 0;
+  for (ulong i = 0; i < size; ++i) {
+    if (gallop) {
+      j = Gallop(other.Elements, j, other.size, Elements[i]);
+    } else {
+      while (j < other.size && order.Less(other.Elements[j], Elements[i])) {
+        ++j;
+      }
     }
-  });
-  
-  return someRemoved; // True if any element was removed
+    if (j == other.size || order.Less(Elements[i], other.Elements[j])) {
+      return false; // Elements[i] is not in the other set
+    }
+    ++j;
+  }
+  return true;
+}
+
+// Intersects: Merge walk that returns at the first common element
+// Disjoint ranges are rejected without walking
+template <typename Data, typename Alloc, typename Compare>
+bool SetVec<Data, Alloc, Compare>::Intersects(const SetVec<Data, Alloc, Compare>& other) const noexcept {
+  if (size == 0 || other.size == 0 || order.Less(Elements[size - 1], other.Elements[0]) || order.Less(other.Elements[other.size - 1], Elements[0])) {
+    return false;
+  }
+  bool gallop = (size > other.size) ? (size / (other.size + 1) >= GallopRatio)
+                                    : (other.size / (size + 1) >= GallopRatio);
+  ulong i = 0;
+  ulong j = 0;
+  while (i < size && j < other.size) {
+    std::weak_ordering side = order.ThreeWay(Elements[i], other.Elements[j]);
+    if (side < 0) {
+      i = gallop ? Gallop(Elements, i + 1, size, other.Elements[j]) : i + 1;
+    } else if (side > 0) {
+      j = gallop ? Gallop(other.Elements, j + 1, other.size, Elements[i]) : j + 1;
+    } else {
+      return true;
+    }
+  }
+  return false;
 }
 
 /* ************************************************************************** */
@@ -936,8 +1609,8 @@ bool SetVec<Data>::RemoveSome(const TraversableContainer<Data>& container) {
 // operator[] (const version): Direct access to elements by index
 // Provides non-circular access for compatibility with standard LinearContainer expectations
 // Time complexity: O(1) - direct array access
-template <typename Data>
-const Data& SetVec<Data>::operator[](const ulong index) const {
+template <typename Data, typename Alloc, typename Compare>
+const Data& SetVec<Data, Alloc, Compare>::operator[](const ulong index) const {
   if (index >= size) {
     throw std::out_of_range("Access at index " + std::to_string(index) + "; SetVec size " + std::to_string(size) + ".");
   }
@@ -950,8 +1623,8 @@ const Data& SetVec<Data>::operator[](const ulong index) const {
 // operator[] (mutable version): Direct access to elements by index with modification capability
 // Allows modification of elements but does not enforce set ordering constraints
 // WARNING: Modifying elements can break the sorted invariant - use with caution
-template <typename Data>
-Data& SetVec<Data>::operator[](const ulong index) {
+template <typename Data, typename Alloc, typename Compare>
+Data& SetVec<Data, Alloc, Compare>::operator[](const ulong index) {
   if (index >= size) {
     throw std::out_of_range("Access at index " + std::to_string(index) + "; SetVec size " + std::to_string(size) + ".");
   }
@@ -963,8 +1636,8 @@ Data& SetVec<Data>::operator[](const ulong index) {
 // Front (const version): Returns the element at the current circular position
 // Provides access to the "front" element in the current circular view
 // Time complexity: O(1) - direct access using current index
-template <typename Data>
-const Data& SetVec<Data>::Front() const {
+template <typename Data, typename Alloc, typename Compare>
+const Data& SetVec<Data, Alloc, Compare>::Front() const {
   if (size == 0) {
     throw std::length_error("Access to an empty set.");
   }
@@ -976,8 +1649,8 @@ const Data& SetVec<Data>::Front() const {
 // Front (mutable version): Returns mutable reference to element at current position
 // Allows modification of the front element but may break set ordering
 // WARNING: Modifying elements can violate sorted invariant
-template <typename Data>
-Data& SetVec<Data>::Front() {
+template <typename Data, typename Alloc, typename Compare>
+Data& SetVec<Data, Alloc, Compare>::Front() {
   if (size == 0) {
     throw std::length_error("Access to an empty set.");
   }
@@ -988,29 +1661,29 @@ Data& SetVec<Data>::Front() {
 
 // Back (const version): Returns the last element in circular ordering
 // Provides access to the element that would be "last" relative to current position
-// Time complexity: O(1) - calculated using modular arithmetic
-template <typename Data>
-const Data& SetVec<Data>::Back() const {
+// Time complexity: O(1) - the element just before current, wrapping at 0
+template <typename Data, typename Alloc, typename Compare>
+const Data& SetVec<Data, Alloc, Compare>::Back() const {
   if (size == 0) {
     throw std::length_error("Access to an empty set.");
   }
   
   // Return the element that comes before current in circular order
   // This is the "last" element when current is considered the "first"
-  return Elements[(current + size - 1) % size];
+  return Elements[(current == 0) ? size - 1 : current - 1];
 }
 
 // Back (mutable version): Returns mutable reference to last element in circular ordering
 // Allows modification of the back element but may break set ordering
 // WARNING: Modifying elements can violate sorted invariant
-template <typename Data>
-Data& SetVec<Data>::Back() {
+template <typename Data, typename Alloc, typename Compare>
+Data& SetVec<Data, Alloc, Compare>::Back() {
   if (size == 0) {
     throw std::length_error("Access to an empty set.");
   }
   
   // Return mutable reference to element that comes before current in circular order
-  return Elements[(current + size - 1) % size];
+  return Elements[(current == 0) ? size - 1 : current - 1];
 }
 
 /* ************************************************************************** */
@@ -1021,8 +1694,8 @@ Data& SetVec<Data>::Back() {
 // SetCurrent: Sets the current position for circular access
 // Safely handles indices larger than size using modulo arithmetic
 // Time complexity: O(1) - simple modulo calculation
-template <typename Data>
-void SetVec<Data>::SetCurrent(ulong index) noexcept {
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::SetCurrent(ulong index) noexcept {
   if (size > 0) {
     // Use modulo to ensure index is within valid range [0, size-1]
     current = index % size;
@@ -1035,19 +1708,19 @@ void SetVec<Data>::SetCurrent(ulong index) noexcept {
 // GetCurrent: Returns the current position index in the circular access
 // Useful for saving and restoring circular access state
 // Time complexity: O(1) - simple member variable access
-template <typename Data>
-ulong SetVec<Data>::GetCurrent() const noexcept {
+template <typename Data, typename Alloc, typename Compare>
+ulong SetVec<Data, Alloc, Compare>::GetCurrent() const noexcept {
   return current; // Return current circular position index
 }
 
 // Next: Advances current position to the next element in circular order
 // Wraps around to first element when reaching the end
-// Time complexity: O(1) - simple modulo arithmetic
-template <typename Data>
-void SetVec<Data>::Next() noexcept {
+// Time complexity: O(1) - a comparison, no modulo
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::Next() noexcept {
   if (size > 0) {
-    // Move to next position, wrapping around using modulo
-    current = (current + 1) % size;
+    // Move to next position, wrapping around to the first one
+    current = (current + 1 < size) ? current + 1 : 0;
   }
   // For empty sets, current remains 0
 }
@@ -1055,8 +1728,8 @@ void SetVec<Data>::Next() noexcept {
 // Prev: Moves current position to the previous element in circular order
 // Wraps around to last element when at the beginning
 // Time complexity: O(1) - conditional arithmetic with wrap-around
-template <typename Data>
-void SetVec<Data>::Prev() noexcept {
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::Prev() noexcept {
   if (size > 0) {
     // Move to previous position with proper wrap-around handling
     current = (current == 0) ? size - 1 : current - 1;
@@ -1071,8 +1744,8 @@ void SetVec<Data>::Prev() noexcept {
 
 // PrintDebug: Outputs all elements in the set for debugging purposes
 // Displays elements in their stored (sorted) order regardless of current position
-template <typename Data>
-void SetVec<Data>::PrintDebug() const {
+template <typename Data, typename Alloc, typename Compare>
+void SetVec<Data, Alloc, Compare>::PrintDebug() const {
   std::cout << "DEBUG: SetVec content: ";
   for (ulong i = 0; i < size; ++i) {
     std::cout << Elements[i] << " ";
@@ -1083,9 +1756,9 @@ void SetVec<Data>::PrintDebug() const {
 // GetAtCurrent (const version): Access elements relative to current position
 // Provides circular indexing where index 0 is current position, 1 is next, etc.
 // Useful for algorithms that need to process elements in circular order
-// Time complexity: O(1) - direct access with modulo calculation
-template <typename Data>
-const Data& SetVec<Data>::GetAtCurrent(ulong index) const {
+// Time complexity: O(1) - direct access with a single wrap-around subtraction
+template <typename Data, typename Alloc, typename Compare>
+const Data& SetVec<Data, Alloc, Compare>::GetAtCurrent(ulong index) const {
   if (size == 0) {
     throw std::length_error("Access to an empty set.");
   }
@@ -1096,14 +1769,16 @@ const Data& SetVec<Data>::GetAtCurrent(ulong index) const {
   
   // Use circular access with current index as the starting point
   // index 0 = current position, index 1 = next position, etc.
-  return Elements[(current + index) % size];
+  // Both indices are below size, so one subtraction replaces the modulo
+  ulong pos = current + index;
+  return Elements[(pos < size) ? pos : pos - size];
 }
 
 // GetAtCurrent (mutable version): Mutable access to elements relative to current position
 // Allows modification of elements accessed in circular order from current position
 // WARNING: Modifying elements can break sorted order invariant
-template <typename Data>
-Data& SetVec<Data>::GetAtCurrent(ulong index) {
+template <typename Data, typename Alloc, typename Compare>
+Data& SetVec<Data, Alloc, Compare>::GetAtCurrent(ulong index) {
   if (size == 0) {
     throw std::length_error("Access to an empty set.");
   }
@@ -1114,60 +1789,8 @@ Data& SetVec<Data>::GetAtCurrent(ulong index) {
   
   // Use circular access with current index as the starting point
   // Provides mutable reference for element modification
-  return Elements[(current + index) % size];
-}
-
-// CAPACITY MANAGEMENT IMPLEMENTATION
-// Dynamic memory management for optimal space utilization
-
-// EnsureCapacity: Guarantees minimum capacity for efficient insertions
-// Doubles capacity when more space is needed to minimize reallocations
-// Uses amortized O(1) insertion by growing exponentially
-template <typename Data>
-void SetVec<Data>::EnsureCapacity(ulong minCapacity) {
-  if (minCapacity > capacity) {
-    // Calculate new capacity: double until we meet minimum requirement
-    ulong newCapacity = (capacity == 0) ? 1 : capacity;
-    while (newCapacity < minCapacity) {
-      newCapacity *= 2; // Exponential growth for amortized efficiency
-    }
-    
-    // Save current logical size before resizing
-    ulong currentSize = this->size;
-    
-    // Resize to new capacity (this temporarily changes both physical and logical size)
-    this->Resize(newCapacity);
-    
-    // Restore the logical size to maintain set state
-    this->size = currentSize;
-    
-    // Update our capacity tracking
-    capacity = newCapacity;
-  }
-}
-
-// ShrinkCapacity: Reduces capacity when space utilization is low
-// Shrinks to half capacity when using less than 1/4 of allocated space
-// Prevents excessive memory usage while maintaining reasonable buffer
-// Minimum capacity of 4 prevents frequent reallocations for small sets
-template <typename Data>
-void SetVec<Data>::ShrinkCapacity() {
-  // Shrink capacity if using less than 1/4 of allocated space and capacity > 4
-  if (capacity > 4 && this->size <= capacity / 4) {
-    ulong newCapacity = capacity / 2; // Reduce by half
-    
-    // Save the current logical size before resizing
-    ulong currentLogicalSize = this->size;
-    
-    // Resize to new capacity (this temporarily changes both physical and logical size)
-    this->Resize(newCapacity);
-    
-    // Restore the logical size to maintain set state
-    this->size = currentLogicalSize;
-    
-    // Update our capacity tracking
-    capacity = newCapacity;
-  }
+  ulong pos = current + index;
+  return Elements[(pos < size) ? pos : pos - size];
 }
 
 /* ************************************************************************** */
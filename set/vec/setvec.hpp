@@ -12,10 +12,11 @@
  * - O(1) access to min/max elements due to sorted structure
  * - Circular access patterns for advanced traversal modes
  * - Efficient memory management with capacity control
+ * - Optional Bloom prefilter answering most lookups of absent elements
  * - Inherits from both Set and SortableVector for full functionality
  * 
  * Design decisions:
- * - Uses SortableVector as base to leverage QuickSort implementation
+ * - Uses SortableVector as base to leverage its introsort implementation
  * - Maintains sorted invariant for all operations
  * - Implements binary search for efficient element location
  * - Provides circular access for specialized iteration patterns
@@ -27,6 +28,8 @@
 /* ************************************************************************** */
 
 #include "../set.hpp"
+#include "../../container/order.hpp"
+#include "../../filter/bloom.hpp"
 #include "../../vector/vector.hpp"
 
 /* ************************************************************************** */
@@ -38,9 +41,13 @@ namespace lasd {
 // SetVec: Vector-based Set Implementation
 // Implements a mathematical set using a sorted dynamic array for efficient operations
 // Virtual inheritance ensures proper diamond inheritance resolution with Set interface
-template <typename Data>
+// Inserts and removals shift the shorter side; the head moves into free slots kept before
+// the first element, so removing the minimum costs O(1) amortized
+// Elements are sorted by the Compare policy (std::less by default); Min is the first
+// element in that order and two elements are equal when they are equivalent under it
+template <typename Data, typename Alloc = std::allocator<Data>, typename Compare = std::less<Data>>
 class SetVec : virtual public Set<Data>,
-               virtual public SortableVector<Data> {
+               virtual public SortableVector<Data, Alloc> {
 
 private:
 
@@ -48,16 +55,69 @@ private:
   // Supports advanced iteration patterns and circular navigation
   
   ulong current = 0; // Current position for circular access operations
-  ulong capacity = 0; // Reserved capacity for efficient memory management
+
+  // ORDERING
+  // Comparator policy the array is sorted by; equal elements are the equivalent ones
+  [[no_unique_address]] Order<Data, Compare> order;
+
+
+  // READ-OPTIMIZED LAYOUT
+  // Copy of the elements in Eytzinger (breadth-first) order while frozen, null otherwise
+  // (raw storage from the set's allocator, holding frozenSize live elements)
+  Data* frozen = nullptr;
+  ulong frozenSize = 0;
+
+  // LEARNED LOOKUP MODEL
+  // Piece of a two-level piecewise-linear model of the position of a key
+  struct ModelSegment {
+    double firstKey = 0.0; // Key of the first element in the segment
+    double slope = 0.0;    // Positions per key unit
+    double errLo = 0.0;    // Smallest (true - predicted) position in the segment
+    double errHi = 0.0;    // Largest (true - predicted) position in the segment
+    ulong start = 0;       // First element of the segment
+    ulong end = 0;         // One past the last element of the segment
+    bool operator==(const ModelSegment&) const = default;
+  };
+
+  // The segments come from the set's allocator, rebound to the segment type
+  using SegmentAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<ModelSegment>;
+
+  struct SearchModel {
+    Vector<ModelSegment, SegmentAlloc> segments;
+    double minKey = 0.0;    // Smallest key
+    double rootScale = 0.0; // Segments per key unit
+    bool stale = true;      // Elements changed since the last build
+
+    SearchModel() = default;
+    explicit SearchModel(const Alloc& allocator) noexcept : segments(SegmentAlloc(allocator)) {}
+  };
+
+  bool modelEnabled = false;
+  mutable SearchModel model; // Rebuilt by const lookups after a change
+
+  // BLOOM PREFILTER
+  // Approximate membership filter consulted by Exists before searching
+  bool filterEnabled = false;
+  mutable BloomFilter<Data, Alloc> filter; // Rebuilt by const lookups when stale
 
 protected:
 
   // INHERITED MEMBER ACCESS
   // Bring base class members into scope for convenient access
   using Container::size;
-  using SortableVector<Data>::Elements;
-  using SortableVector<Data>::Sort;
-  using SortableVector<Data>::Resize;
+  using SortableVector<Data, Alloc>::Elements;
+  using SortableVector<Data, Alloc>::Sort;
+  using SortableVector<Data, Alloc>::Resize;
+
+  // Reordering in any order but Compare's would break the sorted invariant
+  // and leave the frozen layout, the model and the filter stale
+  using SortableVector<Data, Alloc>::SortBy;
+  using SortableVector<Data, Alloc>::ParallelSort;
+  using SortableVector<Data, Alloc>::RadixSort;
+
+  // Appending at the back would break the sorted invariant
+  using SortableVector<Data, Alloc>::PushBack;
+  using SortableVector<Data, Alloc>::PopBack;
 
   // UTILITY METHODS
   // Internal helper functions for set operations and maintenance
@@ -93,16 +153,113 @@ protected:
   // Simplified interface for basic element location operations
   long FindIndex(const Data&) const noexcept;
 
+  // BULK INSERTION METHODS
+  // Batches are sorted and deduplicated, then merged with the set in one pass,
+  // so inserting m elements costs O(n + m log m) instead of O(n * m)
+
+  // Batches up to this size are inserted one element at a time
+  static constexpr ulong SmallBatch = 8;
+
+  // InsertBatch: Sorts, deduplicates and merges a batch (whose elements are moved from)
+  // Returns the number of elements actually inserted
+  ulong InsertBatch(SortableVector<Data, Alloc>&);
+
+  // MergeSorted: Merges a sorted, duplicate-free array into the set (strong guarantee)
+  // Returns the number of elements actually inserted (those not already present)
+  ulong MergeSorted(Data*, ulong);
+
+  // BULK REMOVAL METHODS
+  // Batches are sorted and deduplicated, then the set is compacted in one pass
+
+  // RemoveBatch: Sorts and deduplicates a batch, then removes its elements from the set
+  // Returns the number of elements actually removed
+  ulong RemoveBatch(SortableVector<Data, Alloc>&);
+
+  // SET ALGEBRA METHODS
+  // Flags selecting which elements of a merge with another set are kept
+  static constexpr unsigned KeepLeft = 1;   // Only in this set
+  static constexpr unsigned KeepRight = 2;  // Only in the other set
+  static constexpr unsigned KeepCommon = 4; // In both sets
+
+  // When one set is this many times larger than the other, its runs are skipped by galloping
+  static constexpr ulong GallopRatio = 8;
+
+  // Gallop: First index in [from, to) whose element is not less than the given one
+  // Exponential probing then binary search: O(log d), d being the distance from 'from'
+  ulong Gallop(const Data*, ulong, ulong, const Data&) const noexcept;
+
+  // Combine: Sorted merge with another set, calling emit(fromOther, index, count) for each kept run
+  // Returns the output position of the element at 'current' (or of the first kept one after it)
+  template <typename Emit>
+  ulong Combine(const SetVec&, unsigned, Emit&&) const;
+
+  // Combined: New set holding the elements selected by the flags
+  SetVec Combined(const SetVec&, unsigned) const;
+
+  // CompactWith: Keeps in place only the elements selected by the flags (KeepLeft and/or KeepCommon)
+  void CompactWith(const SetVec&, unsigned);
+
+  // FreshFrom: Copies the elements of the other set that are not in this one
+  SortableVector<Data, Alloc> FreshFrom(const SetVec&) const;
+
+  // READ-OPTIMIZED LAYOUT METHODS
+
+  // BuildFrozen: Copy-constructs the layout of the subtree rooted at a node (1-based) in raw
+  // storage, starting from a sorted index that it advances past the subtree; if a copy
+  // throws, the index counts the elements constructed so far
+  void BuildFrozen(Data*, ulong&, ulong) const;
+
+  // DestroyFrozen: Destroys the first elements (in sorted order) of a partly built layout,
+  // counting them down
+  void DestroyFrozen(Data*, ulong&, ulong) const noexcept;
+
+  // FrozenDescend: Branchless walk from the root to past a leaf, going right while the
+  // node is less than (Upper = false) or not greater than (Upper = true) the given element
+  // Returns the final node index, whose bits record the turns taken
+  template <bool Upper>
+  ulong FrozenDescend(const Data&) const noexcept;
+
+  // LEARNED LOOKUP METHODS
+
+  // Only numeric keys in their natural order can be interpolated
+  static constexpr bool Modelable = std::is_arithmetic_v<Data> && !std::is_same_v<Data, bool> && Order<Data, Compare>::Natural;
+
+  // Average number of elements per model segment
+  static constexpr ulong ModelSpan = 64;
+
+  // Changed: Drops the frozen layout and marks the model stale after any change
+  void Changed() noexcept;
+
+  // RootSegment: Segment a key is routed to by the top level of the model
+  ulong RootSegment(double) const noexcept;
+
+  // BuildModel: Fits the model to the current elements (O(n))
+  void BuildModel() const;
+
+  // RefreshModel: Rebuilds the model if it is enabled and stale
+  void RefreshModel() const noexcept;
+
+  // ModelWindow: Narrow index range holding the lower bound of an element
+  void ModelWindow(const Data&, ulong&, ulong&) const noexcept;
+
+  // BLOOM PREFILTER METHODS
+
+  // The filter hashes with std::hash, which agrees with the equivalence of the natural order only
+  static constexpr bool Filterable = BloomHashable<Data> && Order<Data, Compare>::Natural;
+
+  // FilterLive: Rebuilds the filter if it is enabled and stale; true if Exists may consult it
+  bool FilterLive() const noexcept;
+
+  // FilterRejects: True if the filter proves the element absent (counted in its statistics)
+  bool FilterRejects(const Data&) const noexcept;
+
+  // FilterAdd: Adds an inserted element to the enabled filter
+  void FilterAdd(const Data&) noexcept;
+
   // CAPACITY MANAGEMENT METHODS
-  // Efficient memory management for dynamic resizing operations
-  
-  // EnsureCapacity: Guarantees minimum capacity for efficient insertions
-  // Prevents frequent reallocation during bulk operations
-  void EnsureCapacity(ulong minCapacity);
-  
-  // ShrinkCapacity: Reduces capacity to optimize memory usage
-  // Called after bulk removals to prevent memory waste
-  void ShrinkCapacity();
+  // Geometric growth and quarter-full shrinking are provided by Vector
+  using SortableVector<Data, Alloc>::EnsureCapacity;
+  using SortableVector<Data, Alloc>::ShrinkCapacity;
 
 public:
 
@@ -110,6 +267,10 @@ public:
   // Creates an empty set with minimal initial capacity
   SetVec() = default;
 
+  // ALLOCATOR CONSTRUCTOR
+  // Creates an empty set whose storage comes from the given allocator
+  explicit SetVec(const Alloc&) noexcept;
+
   /* ************************************************************************ */
 
   // SPECIALIZED CONSTRUCTORS
@@ -117,15 +278,15 @@ public:
   
   // Capacity constructor: Creates set with specified initial capacity
   // Useful for performance optimization when expected size is known
-  SetVec(const ulong);
+  SetVec(const ulong, const Alloc& = Alloc());
   
   // TraversableContainer constructor: Creates set from existing container
   // Copies all elements while maintaining sorted order and uniqueness
-  SetVec(const TraversableContainer<Data>&);
+  SetVec(const TraversableContainer<Data>&, const Alloc& = Alloc());
   
   // MappableContainer constructor: Creates set by moving from container
   // Efficiently transfers elements using move semantics
-  SetVec(MappableContainer<Data>&&);
+  SetVec(MappableContainer<Data>&&, const Alloc& = Alloc());
 
   /* ************************************************************************ */
 
@@ -142,7 +303,7 @@ public:
 
   // DESTRUCTOR
   // Default destructor is sufficient due to RAII in base classes
-  virtual ~SetVec() = default;
+  virtual ~SetVec();
 
   /* ************************************************************************ */
 
@@ -153,7 +314,7 @@ public:
   SetVec& operator=(const SetVec&);
 
   // Move assignment: Efficiently transfers ownership from another set
-  SetVec& operator=(SetVec&&) noexcept;
+  SetVec& operator=(SetVec&&) noexcept(SortableVector<Data, Alloc>::NothrowMoveAssign);
 
   /* ************************************************************************ */
 
@@ -227,6 +388,73 @@ public:
 
   /* ************************************************************************ */
 
+  // READ-OPTIMIZED MODE
+  // For sets built once and then queried many times. While frozen, Exists, Predecessor
+  // and Successor search a copy of the elements laid out in Eytzinger (breadth-first)
+  // order, which keeps the top levels of every search in cache. Predecessor and
+  // Successor then return references into that copy. Any change through the set
+  // interface or Map thaws the set; writing through operator[] or iterators while
+  // frozen is not detected.
+  
+  void Freeze();                     // Builds the layout (O(n) time, n extra elements)
+  void Thaw() noexcept;              // Drops the layout
+  bool IsFrozen() const noexcept;    // True while the layout is in use
+
+  /* ************************************************************************ */
+
+  // LEARNED LOOKUP
+  // For numeric keys. A small piecewise-linear model predicts where a key sits in
+  // the sorted array, and BinarySearch then only scans the window given by the
+  // model's recorded error. For evenly spread keys that window has a few elements.
+  // A change marks the model stale, and the next Exists, Predecessor or Successor
+  // rebuilds it in O(n). Concurrent readers should therefore not be the first to
+  // search after a change.
+  
+  void EnableModel() requires Modelable; // Builds the model and starts using it
+  void DisableModel() noexcept;          // Returns to plain binary search
+  bool ModelEnabled() const noexcept;    // True if the model is in use
+
+  /* ************************************************************************ */
+
+  // BLOOM PREFILTER
+  // For sets queried mostly with absent elements. A blocked Bloom filter with the
+  // given bits per key answers most of those lookups without a binary search, and
+  // never rejects an element of the set. Single inserts add to the filter; bulk
+  // inserts, set algebra, Map and copy assignment make the next Exists rebuild it
+  // in O(n), as do inserts past its planned size or the removal of half its keys.
+  // Writing through operator[] or iterators is not detected. Lookups update the
+  // statistics and may rebuild the filter, so concurrent readers need external
+  // synchronization.
+  
+  void EnableFilter(ulong bitsPerKey = BloomFilter<Data>::DefaultBitsPerKey) requires Filterable; // Builds the filter and starts consulting it
+  void DisableFilter() noexcept;           // Drops the filter
+  bool FilterEnabled() const noexcept;     // True if Exists consults the filter
+  BloomStats FilterStats() const noexcept; // Lookups answered by the filter, and false positives among the others
+
+  /* ************************************************************************ */
+
+  // SET ALGEBRA
+  // Sorted merges in O(n + m); when one set is much smaller than the other the
+  // larger one is skipped by galloping, so the cost tends to O(m log(n / m))
+  
+  // NEW SET OPERATIONS - The result uses this set's allocator
+  SetVec Union(const SetVec&) const;               // Elements in either set
+  SetVec Intersection(const SetVec&) const;        // Elements in both sets
+  SetVec Difference(const SetVec&) const;          // Elements of this set not in the other
+  SetVec SymmetricDifference(const SetVec&) const; // Elements in exactly one of the sets
+  
+  // IN-PLACE OPERATIONS - Intersection and difference compact the array without reallocating
+  void UnionWith(const SetVec&);
+  void IntersectWith(const SetVec&);
+  void DifferenceWith(const SetVec&);
+  void SymmetricDifferenceWith(const SetVec&);
+  
+  // PREDICATES - Stop at the first element that decides the answer
+  bool IsSubsetOf(const SetVec&) const noexcept; // True if every element is also in the other set
+  bool Intersects(const SetVec&) const noexcept; // True if the sets share at least one element
+
+  /* ************************************************************************ */
+
   // LINEAR CONTAINER INTERFACE IMPLEMENTATION
   // Array-like access to elements in sorted order
   
@@ -265,7 +493,12 @@ public:
   using TraversableContainer<Data>::Traverse;
   using PreOrderTraversableContainer<Data>::PreOrderTraverse;
   using PostOrderTraversableContainer<Data>::PostOrderTraverse;
-  using MappableContainer<Data>::Map;
+
+  // Map variants reset the frozen layout, the model and the filter before changing the elements
+  using typename MappableContainer<Data>::MapFun;
+  void Map(MapFun) override;
+  void PreOrderMap(MapFun) override;
+  void PostOrderMap(MapFun) override;
 
   // DEBUG FUNCTIONALITY
   // Development and testing support
@@ -0,0 +1,439 @@
+#include <cstring>
+
+// Vector extensions (vector_size types with elementwise operators) are a GCC/Clang feature
+#if defined(__GNUC__)
+#define LASD_SIMD_VECTOR_EXTENSIONS 1
+#endif
+
+// On x86 the 256-bit kernels are compiled for AVX2 and chosen at run time
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define LASD_SIMD_X86 1
+#endif
+
+namespace lasd {
+
+namespace simd {
+
+/* ************************************************************************** */
+
+// Level selection
+
+inline Level SupportedLevel() noexcept {
+#if defined(LASD_SIMD_X86)
+  static const Level level = __builtin_cpu_supports("avx2") ? Level::Vector256
+                           : __builtin_cpu_supports("sse2") ? Level::Vector128 : Level::Scalar;
+  return level;
+#elif defined(LASD_SIMD_VECTOR_EXTENSIONS)
+  return Level::Vector128;
+#else
+  return Level::Scalar;
+#endif
+}
+
+// ActiveLevel: Level in use, detected once and lowered only by SetLevel
+inline Level& ActiveLevel() noexcept {
+  static Level level = SupportedLevel();
+  return level;
+}
+
+inline Level CurrentLevel() noexcept {
+  return ActiveLevel();
+}
+
+inline void SetLevel(Level level) noexcept {
+  ActiveLevel() = (level > SupportedLevel()) ? SupportedLevel() : level;
+}
+
+/* ************************************************************************** */
+
+// Scalar kernels: reference loops, also used for the tails of the vector kernels
+
+template <typename T>
+struct ScalarKernels {
+
+  static bool Contains(const T* data, unsigned long count, T value) noexcept {
+    for (unsigned long index = 0; index < count; ++index) {
+      if (data[index] == value) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static T Sum(const T* data, unsigned long count) noexcept {
+    T sum = T();
+    for (unsigned long index = 0; index < count; ++index) {
+      sum += data[index];
+    }
+    return sum;
+  }
+
+  static T Min(const T* data, unsigned long count) noexcept {
+    T min = data[0];
+    for (unsigned long index = 1; index < count; ++index) {
+      min = (data[index] < min) ? data[index] : min;
+    }
+    return min;
+  }
+
+  static T Max(const T* data, unsigned long count) noexcept {
+    T max = data[0];
+    for (unsigned long index = 1; index < count; ++index) {
+      max = (max < data[index]) ? data[index] : max;
+    }
+    return max;
+  }
+
+  static bool Equal(const T* first, const T* second, unsigned long count) noexcept {
+    for (unsigned long index = 0; index < count; ++index) {
+      if (first[index] != second[index]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+};
+
+/* ************************************************************************** */
+
+#if defined(LASD_SIMD_VECTOR_EXTENSIONS)
+
+// Registers never cross a call boundary (every kernel member is always inlined),
+// so the -Wpsabi warning GCC gives 256-bit vector returns in baseline code does
+// not apply. The pragma cannot silence the accompanying ABI note for value
+// parameters, which is why vector values are only ever passed by reference
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+// Register of 'Bytes' bytes holding lanes of type T
+// (declared in a class: GCC ignores vector_size on dependent alias templates)
+template <typename T, unsigned Bytes>
+struct Lanes {
+  typedef T Type __attribute__((vector_size(Bytes)));
+};
+
+// Vector kernels: every member is always inlined, so the instructions used are
+// those of the calling function (baseline for 128 bits, AVX2 for the wrappers below)
+// Each loop step handles Unroll registers, which hides the latency of the
+// reductions and amortizes the test of the early-exit kernels.
+template <typename T, unsigned Bytes>
+struct VectorKernels {
+
+  using V = typename Lanes<T, Bytes>::Type;
+  using Bits = typename Lanes<unsigned long long, Bytes>::Type;
+
+  static constexpr unsigned long Width = Bytes / sizeof(T);
+  static constexpr unsigned long Unroll = 4;
+  static constexpr unsigned long Step = Width * Unroll;
+
+  [[gnu::always_inline]] static V Load(const T* data) noexcept {
+    V lanes;
+    std::memcpy(&lanes, data, sizeof(V)); // Unaligned load
+    return lanes;
+  }
+
+  // Any: True if some lane of a comparison mask is set
+  template <typename Mask>
+  [[gnu::always_inline]] static bool Any(const Mask& mask) noexcept {
+    Bits bits = reinterpret_cast<Bits>(mask);
+    unsigned long long any = 0;
+    for (unsigned long lane = 0; lane < Bytes / sizeof(unsigned long long); ++lane) {
+      any |= bits[lane];
+    }
+    return any != 0;
+  }
+
+  [[gnu::always_inline]] static bool Contains(const T* data, unsigned long count, T value) noexcept {
+    V needle = V{} + value;
+    unsigned long index = 0;
+    for (; index + Step <= count; index += Step) {
+      if (Any((Load(data + index) == needle) | (Load(data + index + Width) == needle)
+            | (Load(data + index + 2 * Width) == needle) | (Load(data + index + 3 * Width) == needle))) {
+        return true;
+      }
+    }
+    for (; index + Width <= count; index += Width) {
+      if (Any(Load(data + index) == needle)) {
+        return true;
+      }
+    }
+    return ScalarKernels<T>::Contains(data + index, count - index, value);
+  }
+
+  [[gnu::always_inline]] static T Sum(const T* data, unsigned long count) noexcept {
+    V sums[Unroll] = {};
+    unsigned long index = 0;
+    for (; index + Step <= count; index += Step) {
+      for (unsigned long reg = 0; reg < Unroll; ++reg) {
+        sums[reg] += Load(data + index + reg * Width);
+      }
+    }
+    for (; index + Width <= count; index += Width) {
+      sums[0] += Load(data + index);
+    }
+    V total = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+    T sum = T();
+    for (unsigned long lane = 0; lane < Width; ++lane) {
+      sum += total[lane];
+    }
+    return sum + ScalarKernels<T>::Sum(data + index, count - index);
+  }
+
+  [[gnu::always_inline]] static T Min(const T* data, unsigned long count) noexcept {
+    if (count < Width) {
+      return ScalarKernels<T>::Min(data, count);
+    }
+    V first = Load(data);
+    V mins[Unroll] = {first, first, first, first};
+    unsigned long index = 0;
+    for (; index + Step <= count; index += Step) {
+      for (unsigned long reg = 0; reg < Unroll; ++reg) {
+        V lanes = Load(data + index + reg * Width);
+        mins[reg] = (lanes < mins[reg]) ? lanes : mins[reg];
+      }
+    }
+    for (; index + Width <= count; index += Width) {
+      V lanes = Load(data + index);
+      mins[0] = (lanes < mins[0]) ? lanes : mins[0];
+    }
+    for (unsigned long reg = 1; reg < Unroll; ++reg) {
+      mins[0] = (mins[reg] < mins[0]) ? mins[reg] : mins[0];
+    }
+    T min = mins[0][0];
+    for (unsigned long lane = 1; lane < Width; ++lane) {
+      min = (mins[0][lane] < min) ? mins[0][lane] : min;
+    }
+    for (; index < count; ++index) {
+      min = (data[index] < min) ? data[index] : min;
+    }
+    return min;
+  }
+
+  [[gnu::always_inline]] static T Max(const T* data, unsigned long count) noexcept {
+    if (count < Width) {
+      return ScalarKernels<T>::Max(data, count);
+    }
+    V first = Load(data);
+    V maxs[Unroll] = {first, first, first, first};
+    unsigned long index = 0;
+    for (; index + Step <= count; index += Step) {
+      for (unsigned long reg = 0; reg < Unroll; ++reg) {
+        V lanes = Load(data + index + reg * Width);
+        maxs[reg] = (maxs[reg] < lanes) ? lanes : maxs[reg];
+      }
+    }
+    for (; index + Width <= count; index += Width) {
+      V lanes = Load(data + index);
+      maxs[0] = (maxs[0] < lanes) ? lanes : maxs[0];
+    }
+    for (unsigned long reg = 1; reg < Unroll; ++reg) {
+      maxs[0] = (maxs[0] < maxs[reg]) ? maxs[reg] : maxs[0];
+    }
+    T max = maxs[0][0];
+    for (unsigned long lane = 1; lane < Width; ++lane) {
+      max = (max < maxs[0][lane]) ? maxs[0][lane] : max;
+    }
+    for (; index < count; ++index) {
+      max = (max < data[index]) ? data[index] : max;
+    }
+    return max;
+  }
+
+  // Equal: Lanes are compared with != (not bitwise), so 0.0 equals -0.0 and NaN equals nothing
+  [[gnu::always_inline]] static bool Equal(const T* first, const T* second, unsigned long count) noexcept {
+    unsigned long index = 0;
+    for (; index + Step <= count; index += Step) {
+      if (Any((Load(first + index) != Load(second + index))
+            | (Load(first + index + Width) != Load(second + index + Width))
+            | (Load(first + index + 2 * Width) != Load(second + index + 2 * Width))
+            | (Load(first + index + 3 * Width) != Load(second + index + 3 * Width)))) {
+        return false;
+      }
+    }
+    for (; index + Width <= count; index += Width) {
+      if (Any(Load(first + index) != Load(second + index))) {
+        return false;
+      }
+    }
+    return ScalarKernels<T>::Equal(first + index, second + index, count - index);
+  }
+
+};
+
+// VectorMatchByte: One byte comparison of a group, packed into one bit per byte
+// by PMOVMSKB where SSE2 is available and lane by lane elsewhere
+
+[[gnu::always_inline]] inline unsigned VectorMatchByte(const unsigned char* group, unsigned char value) noexcept {
+  using V = Lanes<char, GroupWidth>::Type;
+  V lanes;
+  std::memcpy(&lanes, group, sizeof(V)); // Unaligned load
+  V equal = reinterpret_cast<V>(lanes == (V{} + static_cast<char>(value)));
+#if defined(__SSE2__)
+  return static_cast<unsigned>(__builtin_ia32_pmovmskb128(equal));
+#else
+  unsigned mask = 0;
+  for (unsigned long index = 0; index < GroupWidth; ++index) {
+    mask |= static_cast<unsigned>(equal[index] & 1) << index;
+  }
+  return mask;
+#endif
+}
+
+#pragma GCC diagnostic pop
+
+#endif
+
+/* ************************************************************************** */
+
+#if defined(LASD_SIMD_X86)
+
+// AVX2 entry points: the 256-bit kernels inlined into functions compiled for AVX2
+
+template <typename T>
+[[gnu::target("avx2")]] bool ContainsAvx2(const T* data, unsigned long count, T value) noexcept {
+  return VectorKernels<T, 32>::Contains(data, count, value);
+}
+
+template <typename T>
+[[gnu::target("avx2")]] T SumAvx2(const T* data, unsigned long count) noexcept {
+  return VectorKernels<T, 32>::Sum(data, count);
+}
+
+template <typename T>
+[[gnu::target("avx2")]] T MinAvx2(const T* data, unsigned long count) noexcept {
+  return VectorKernels<T, 32>::Min(data, count);
+}
+
+template <typename T>
+[[gnu::target("avx2")]] T MaxAvx2(const T* data, unsigned long count) noexcept {
+  return VectorKernels<T, 32>::Max(data, count);
+}
+
+template <typename T>
+[[gnu::target("avx2")]] bool EqualAvx2(const T* first, const T* second, unsigned long count) noexcept {
+  return VectorKernels<T, 32>::Equal(first, second, count);
+}
+
+#endif
+
+/* ************************************************************************** */
+
+// Dispatchers: widest enabled level first, scalar loops for the remaining types
+
+template <typename T>
+bool Contains(const T* data, unsigned long count, T value) noexcept {
+  static_assert(std::is_arithmetic_v<T>, "simd kernels require an arithmetic type");
+  if constexpr (Accelerated<T>) {
+#if defined(LASD_SIMD_X86)
+    if (ActiveLevel() == Level::Vector256) {
+      return ContainsAvx2(data, count, value);
+    }
+#endif
+#if defined(LASD_SIMD_VECTOR_EXTENSIONS)
+    if (ActiveLevel() == Level::Vector128) {
+      return VectorKernels<T, 16>::Contains(data, count, value);
+    }
+#endif
+  }
+  return ScalarKernels<T>::Contains(data, count, value);
+}
+
+template <typename T>
+T Sum(const T* data, unsigned long count) noexcept {
+  static_assert(std::is_arithmetic_v<T>, "simd kernels require an arithmetic type");
+  if constexpr (Accelerated<T>) {
+#if defined(LASD_SIMD_X86)
+    if (ActiveLevel() == Level::Vector256) {
+      return SumAvx2(data, count);
+    }
+#endif
+#if defined(LASD_SIMD_VECTOR_EXTENSIONS)
+    if (ActiveLevel() == Level::Vector128) {
+      return VectorKernels<T, 16>::Sum(data, count);
+    }
+#endif
+  }
+  return ScalarKernels<T>::Sum(data, count);
+}
+
+template <typename T>
+T Min(const T* data, unsigned long count) noexcept {
+  static_assert(std::is_arithmetic_v<T>, "simd kernels require an arithmetic type");
+  if constexpr (Accelerated<T>) {
+#if defined(LASD_SIMD_X86)
+    if (ActiveLevel() == Level::Vector256) {
+      return MinAvx2(data, count);
+    }
+#endif
+#if defined(LASD_SIMD_VECTOR_EXTENSIONS)
+    if (ActiveLevel() == Level::Vector128) {
+      return VectorKernels<T, 16>::Min(data, count);
+    }
+#endif
+  }
+  return ScalarKernels<T>::Min(data, count);
+}
+
+template <typename T>
+T Max(const T* data, unsigned long count) noexcept {
+  static_assert(std::is_arithmetic_v<T>, "simd kernels require an arithmetic type");
+  if constexpr (Accelerated<T>) {
+#if defined(LASD_SIMD_X86)
+    if (ActiveLevel() == Level::Vector256) {
+      return MaxAvx2(data, count);
+    }
+#endif
+#if defined(LASD_SIMD_VECTOR_EXTENSIONS)
+    if (ActiveLevel() == Level::Vector128) {
+      return VectorKernels<T, 16>::Max(data, count);
+    }
+#endif
+  }
+  return ScalarKernels<T>::Max(data, count);
+}
+
+template <typename T>
+bool Equal(const T* first, const T* second, unsigned long count) noexcept {
+  static_assert(std::is_arithmetic_v<T>, "simd kernels require an arithmetic type");
+  if constexpr (Accelerated<T>) {
+#if defined(LASD_SIMD_X86)
+    if (ActiveLevel() == Level::Vector256) {
+      return EqualAvx2(first, second, count);
+    }
+#endif
+#if defined(LASD_SIMD_VECTOR_EXTENSIONS)
+    if (ActiveLevel() == Level::Vector128) {
+      return VectorKernels<T, 16>::Equal(first, second, count);
+    }
+#endif
+  }
+  return ScalarKernels<T>::Equal(first, second, count);
+}
+
+/* ************************************************************************** */
+
+// Byte groups: scalar reference, and the dispatcher over the vector version above
+
+inline unsigned ScalarMatchByte(const unsigned char* group, unsigned char value) noexcept {
+  unsigned mask = 0;
+  for (unsigned long index = 0; index < GroupWidth; ++index) {
+    mask |= static_cast<unsigned>(group[index] == value) << index;
+  }
+  return mask;
+}
+
+inline unsigned MatchByte(const unsigned char* group, unsigned char value) noexcept {
+#if defined(LASD_SIMD_VECTOR_EXTENSIONS)
+  if (ActiveLevel() != Level::Scalar) {
+    return VectorMatchByte(group, value);
+  }
+#endif
+  return ScalarMatchByte(group, value);
+}
+
+/* ************************************************************************** */
+
+}
+
+}
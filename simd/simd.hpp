@@ -0,0 +1,86 @@
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+/* ************************************************************************** */
+
+#include <type_traits>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+namespace simd {
+
+/* ************************************************************************** */
+
+// SIMD kernels
+// ------------
+// Data-parallel kernels over contiguous arrays of int, float and double, used by
+// Vector for membership search, reductions and equality. Each kernel is written
+// once over GCC vector extensions and instantiated for 128-bit (SSE2, NEON) and
+// 256-bit (AVX2) registers; the widest level supported by the running CPU is
+// selected at the first call. Compilers without vector extensions get the scalar
+// loops only.
+//
+// Results match the element-by-element loops, except that floating-point sums
+// are accumulated in a different order (so they may differ in the last bits)
+// and that Min/Max are unspecified when the data contains NaNs.
+
+enum class Level { Scalar, Vector128, Vector256 };
+
+// Types with a vectorized implementation; the kernels accept no other type
+template <typename T>
+inline constexpr bool Accelerated = std::is_same_v<T, int> || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+// SupportedLevel() - Widest level available on this CPU
+Level SupportedLevel() noexcept;
+
+// CurrentLevel() - Level used by the kernels
+Level CurrentLevel() noexcept;
+
+// SetLevel() - Restricts the kernels to the given level (clamped to SupportedLevel)
+// Meant for tests and benchmarks; not thread-safe with respect to running kernels
+void SetLevel(Level) noexcept;
+
+/* ************************************************************************** */
+
+// Contains() - True if some element compares equal to the value
+template <typename T>
+bool Contains(const T*, unsigned long, T) noexcept;
+
+// Sum() - Sum of the elements (0 if empty)
+template <typename T>
+T Sum(const T*, unsigned long) noexcept;
+
+// Min()/Max() - Smallest/largest element (the count must not be zero)
+template <typename T>
+T Min(const T*, unsigned long) noexcept;
+template <typename T>
+T Max(const T*, unsigned long) noexcept;
+
+// Equal() - True if the two arrays compare equal element by element
+template <typename T>
+bool Equal(const T*, const T*, unsigned long) noexcept;
+
+/* ************************************************************************** */
+
+// Byte groups
+// -----------
+// Control-byte probing for open-addressing tables: GroupWidth bytes, read with
+// one unaligned load, are compared with a value at once. Available on every
+// level (a 128-bit register, the scalar loop on Level::Scalar).
+
+inline constexpr unsigned long GroupWidth = 16;
+
+// MatchByte() - Bit i set if byte i of the group equals the value (reads GroupWidth bytes)
+unsigned MatchByte(const unsigned char*, unsigned char) noexcept;
+
+/* ************************************************************************** */
+
+}
+
+}
+
+#include "simd.cpp"
+
+#endif
@@ -11,8 +11,21 @@
  * - Exception-safe operations with strong guarantee
  * - Move semantics for performance optimization
  * - Template specialization for different data types
+ * - Raw storage: only the first 'size' slots hold constructed elements
  */
 
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
 namespace lasd {
 
 /* ************************************************************************** */
@@ -20,92 +33,134 @@ namespace lasd {
 // VECTOR CLASS IMPLEMENTATION
 // Provides dynamic array functionality with automatic memory management
 
+// Allocator constructor: Creates an empty vector bound to the given allocator
+template <typename Data, typename Alloc>
+Vector<Data, Alloc>::Vector(const Alloc& allocator) noexcept : alloc(allocator) {}
+
 // Specific constructors for different initialization scenarios
 
 // Constructor with initial size: Creates vector with specified number of default-constructed elements
-template <typename Data>
-Vector<Data>::Vector(const ulong newSize) {
-  Elements = new Data[newSize]{}; // Allocate array and default-construct all elements
-  size = newSize; // Set the container size
+template <typename Data, typename Alloc>
+Vector<Data, Alloc>::Vector(const ulong newSize, const Alloc& allocator) : alloc(allocator) {
+  Elements = Allocate(newSize); // Allocate raw storage for the elements
+  try {
+    std::uninitialized_value_construct_n(Elements, newSize); // Default-construct every slot
+  } catch (...) {
+    Deallocate(Elements, newSize);
+    throw;
+  }
+  size = capacity = newSize; // Set the container size (no spare capacity yet)
 }
 
 // Constructor from TraversableContainer: Creates vector by copying elements from any traversable container
 // This allows creation from lists, other vectors, etc.
-template <typename Data>
-Vector<Data>::Vector(const TraversableContainer<Data>& container) {
-  size = container.Size(); // Get the size of source container
-  Elements = new Data[size]{}; // Allocate array for elements
+template <typename Data, typename Alloc>
+Vector<Data, Alloc>::Vector(const TraversableContainer<Data>& container, const Alloc& allocator) : alloc(allocator) {
+  capacity = container.Size(); // Get the size of source container
+  Elements = Allocate(capacity); // Allocate raw storage for elements
   
-  // Use traversal to copy elements sequentially
-  ulong i = 0;
-  container.Traverse([this, &i](const Data& data) {
-    Elements[i++] = data; // Copy each element to vector
-  });
+  // Use traversal to copy-construct elements sequentially
+  // 'size' counts the constructed elements so a throwing copy can be undone
+  try {
+    container.Traverse([this](const Data& data) {
+      std::construct_at(Elements + size, data);
+      ++size;
+    });
+  } catch (...) {
+    std::destroy_n(Elements, size);
+    Deallocate(Elements, capacity);
+    throw;
+  }
 }
 
 // Constructor from MappableContainer: Creates vector by moving elements for efficiency
 // Uses move semantics when possible to avoid unnecessary copying
-template <typename Data>
-Vector<Data>::Vector(MappableContainer<Data>&& container) {
-  size = container.Size(); // Get the size of source container
-  Elements = new Data[size]{}; // Allocate array for elements
-
-  // Use mapping to move elements efficiently
-  ulong i = 0;
-  container.Map([this, &i](Data& data) {
-    std::swap(Elements[i++], data); // Move data from source to vector position
-                                   // Source element becomes default-constructed
-  });
+template <typename Data, typename Alloc>
+Vector<Data, Alloc>::Vector(MappableContainer<Data>&& container, const Alloc& allocator) : alloc(allocator) {
+  capacity = container.Size(); // Get the size of source container
+  Elements = Allocate(capacity); // Allocate raw storage for elements
+
+  // Use mapping to move-construct elements efficiently
+  try {
+    container.Map([this](Data& data) {
+      std::construct_at(Elements + size, std::move(data)); // Source element is left moved-from
+      ++size;
+    });
+  } catch (...) {
+    std::destroy_n(Elements, size);
+    Deallocate(Elements, capacity);
+    throw;
+  }
   // Note: Source container is not explicitly cleared to maintain compatibility
 }
 
 // Copy constructor: Creates a deep copy of another vector
 // Provides the strong exception safety guarantee
-template <typename Data>
-Vector<Data>::Vector(const Vector<Data>& vector) {
-  size = vector.size; // Copy the size
-  Elements = new Data[size]{}; // Allocate new memory
-  
-  // Copy all elements individually
-  for(ulong i = 0; i < size; ++i) {
-    Elements[i] = vector.Elements[i];
+template <typename Data, typename Alloc>
+Vector<Data, Alloc>::Vector(const Vector<Data, Alloc>& vector)
+  : alloc(AllocTraits::select_on_container_copy_construction(vector.alloc)), growthFactor(vector.growthFactor) {
+  Elements = Allocate(vector.size); // Allocate new memory (the copy is allocated tight)
+  try {
+    CopyConstruct(vector.Elements, vector.size, Elements); // Copy-construct in place
+  } catch (...) {
+    Deallocate(Elements, vector.size);
+    throw;
   }
+  size = capacity = vector.size; // Copy the size
 }
 
 // Move constructor: Efficiently transfers ownership from another vector
-// Uses swap to avoid memory allocation/deallocation
-template <typename Data>
-Vector<Data>::Vector(Vector<Data>&& vector) noexcept {
+// Uses swap to avoid memory allocation/deallocation (the allocator is copied along)
+template <typename Data, typename Alloc>
+Vector<Data, Alloc>::Vector(Vector<Data, Alloc>&& vector) noexcept : alloc(vector.alloc) {
   std::swap(Elements, vector.Elements); // Transfer ownership of array
   std::swap(size, vector.size); // Transfer size information
+  std::swap(capacity, vector.capacity); // Transfer capacity information
+  std::swap(front, vector.front);
+  std::swap(growthFactor, vector.growthFactor);
   // The moved-from vector will be left in a valid but unspecified state
 }
 
 // Destructor: Automatically frees allocated memory
 // Follows RAII principles for automatic cleanup
-template <typename Data>
-Vector<Data>::~Vector() {
-  delete[] Elements; // Free the dynamically allocated array
+template <typename Data, typename Alloc>
+Vector<Data, Alloc>::~Vector() {
+  std::destroy_n(Elements, size); // Destroy only the live elements
+  ReleaseStorage(); // Free the raw storage
   // Elements pointer becomes invalid, but that's fine as object is being destroyed
 }
 
 // Copy assignment: Safely assigns the contents of another vector
 // Uses copy-and-swap idiom for exception safety
-template <typename Data>
-Vector<Data>& Vector<Data>::operator=(const Vector<Data>& vector) {
+template <typename Data, typename Alloc>
+Vector<Data, Alloc>& Vector<Data, Alloc>::operator=(const Vector<Data, Alloc>& vector) {
   if (this != &vector) { // Protect against self-assignment
+    // The new storage comes from the allocator that will own it after the assignment
+    Alloc newAlloc = alloc;
+    if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+      newAlloc = vector.alloc;
+    }
+
     // Allocate new memory first (exception-safe approach)
-    Data* tempElements = new Data[vector.size]{};
+    Data* tempElements = (vector.size == 0) ? nullptr : AllocTraits::allocate(newAlloc, vector.size);
     
-    // Copy elements to new memory
-    for(ulong i = 0; i < vector.size; ++i) {
-      tempElements[i] = vector.Elements[i];
+    // Copy-construct elements into new memory
+    try {
+      CopyConstruct(vector.Elements, vector.size, tempElements);
+    } catch (...) {
+      if (tempElements != nullptr) {
+        AllocTraits::deallocate(newAlloc, tempElements, vector.size);
+      }
+      throw;
     }
     
     // Only after successful copy, replace our data
-    delete[] Elements; // Free old memory
+    std::destroy_n(Elements, size); // Destroy old elements
+    ReleaseStorage(); // Free old memory
+    alloc = newAlloc;
     Elements = tempElements; // Assign new memory
-    size = vector.size; // Update size
+    size = capacity = vector.size; // Update size
+    growthFactor = vector.growthFactor;
   }
   
   return *this; // Return reference for chaining
@@ -113,11 +168,36 @@ Vector<Data>& Vector<Data>::operator=(const Vector<Data>& vector) {
 
 // Move assignment: Efficiently transfers ownership from another vector
 // Avoids memory allocation by simply swapping resources
-template <typename Data>
-Vector<Data>& Vector<Data>::operator=(Vector<Data>&& vector) noexcept {
+// Storage can only change hands when the allocators propagate or compare equal;
+// otherwise the elements are moved one by one into our own storage
+template <typename Data, typename Alloc>
+Vector<Data, Alloc>& Vector<Data, Alloc>::operator=(Vector<Data, Alloc>&& vector) noexcept(NothrowMoveAssign) {
   if (this != &vector) { // Protect against self-assignment
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      std::swap(alloc, vector.alloc);
+    } else if constexpr (!AllocTraits::is_always_equal::value) {
+      if (alloc != vector.alloc) {
+        Data* tempElements = Allocate(vector.size);
+        try {
+          std::uninitialized_move_n(vector.Elements, vector.size, tempElements);
+        } catch (...) {
+          Deallocate(tempElements, vector.size);
+          throw;
+        }
+        std::destroy_n(Elements, size);
+        ReleaseStorage();
+        Elements = tempElements;
+        size = capacity = vector.size;
+        growthFactor = vector.growthFactor;
+        vector.Resize(0);
+        return *this;
+      }
+    }
     std::swap(Elements, vector.Elements); // Swap array pointers
     std::swap(size, vector.size); // Swap size values
+    std::swap(capacity, vector.capacity); // Swap capacity values
+    std::swap(front, vector.front);
+    std::swap(growthFactor, vector.growthFactor);
     // The moved-from vector will clean up our old data in its destructor
   }
   
@@ -127,11 +207,14 @@ Vector<Data>& Vector<Data>::operator=(Vector<Data>&& vector) noexcept {
 // Comparison operators for structural equality testing
 
 // Equality operator: Returns true if vectors have same size and identical elements
-template <typename Data>
-bool Vector<Data>::operator==(const Vector<Data>& vector) const noexcept {
+template <typename Data, typename Alloc>
+bool Vector<Data, Alloc>::operator==(const Vector<Data, Alloc>& vector) const noexcept {
   if (size != vector.size) {
     return false; // Different sizes means vectors cannot be equal
   }
+  if constexpr (std::is_arithmetic_v<Data>) {
+    return simd::Equal(Elements, vector.Elements, size);
+  }
   
   // Compare each element pair
   for(ulong i = 0; i < size; ++i) {
@@ -144,8 +227,8 @@ bool Vector<Data>::operator==(const Vector<Data>& vector) const noexcept {
 }
 
 // Inequality operator: Returns true if vectors differ in size or content
-template <typename Data>
-bool Vector<Data>::operator!=(const Vector<Data>& vector) const noexcept {
+template <typename Data, typename Alloc>
+bool Vector<Data, Alloc>::operator!=(const Vector<Data, Alloc>& vector) const noexcept {
   return !(*this == vector); // Simply negate the equality result
 }
 
@@ -154,8 +237,8 @@ bool Vector<Data>::operator!=(const Vector<Data>& vector) const noexcept {
 
 // Mutable element access by index: Returns a reference that can be modified
 // Time complexity: O(1) - direct array access
-template <typename Data>
-Data& Vector<Data>::operator[](ulong index) {
+template <typename Data, typename Alloc>
+Data& Vector<Data, Alloc>::operator[](ulong index) {
   if (index >= size) {
     throw std::out_of_range("Access at index " + std::to_string(index) + " on vector of size " + std::to_string(size));
   }
@@ -164,8 +247,8 @@ Data& Vector<Data>::operator[](ulong index) {
 }
 
 // Mutable access to first element: Returns a reference to the front element
-template <typename Data>
-Data& Vector<Data>::Front() {
+template <typename Data, typename Alloc>
+Data& Vector<Data, Alloc>::Front() {
   if (size == 0) {
     throw std::length_error("Access to an empty vector");
   }
@@ -174,8 +257,8 @@ Data& Vector<Data>::Front() {
 }
 
 // Mutable access to last element: Returns a reference to the back element
-template <typename Data>
-Data& Vector<Data>::Back() {
+template <typename Data, typename Alloc>
+Data& Vector<Data, Alloc>::Back() {
   if (size == 0) {
     throw std::length_error("Access to an empty vector");
   }
@@ -188,8 +271,8 @@ Data& Vector<Data>::Back() {
 
 // Immutable element access by index: Returns a const reference for read-only access
 // Time complexity: O(1) - direct array access
-template <typename Data>
-const Data& Vector<Data>::operator[](ulong index) const {
+template <typename Data, typename Alloc>
+const Data& Vector<Data, Alloc>::operator[](ulong index) const {
   if (index >= size) {
     throw std::out_of_range("Access at index " + std::to_string(index) + " on vector of size " + std::to_string(size));
   }
@@ -198,8 +281,8 @@ const Data& Vector<Data>::operator[](ulong index) const {
 }
 
 // Immutable access to first element: Returns a const reference to the front element
-template <typename Data>
-const Data& Vector<Data>::Front() const {
+template <typename Data, typename Alloc>
+const Data& Vector<Data, Alloc>::Front() const {
   if (size == 0) {
     throw std::length_error("Access to an empty vector");
   }
@@ -208,8 +291,8 @@ const Data& Vector<Data>::Front() const {
 }
 
 // Immutable access to last element: Returns a const reference to the back element
-template <typename Data>
-const Data& Vector<Data>::Back() const {
+template <typename Data, typename Alloc>
+const Data& Vector<Data, Alloc>::Back() const {
   if (size == 0) {
     throw std::length_error("Access to an empty vector");
   }
@@ -217,37 +300,491 @@ const Data& Vector<Data>::Back() const {
   return Elements[size - 1]; // Last element is at index (size-1)
 }
 
+// Specific member function (inherited from TestableContainer)
+
+// Exists: Scans the buffer directly instead of going through Traverse and std::function
+template <typename Data, typename Alloc>
+bool Vector<Data, Alloc>::Exists(const Data& value) const noexcept {
+  if constexpr (std::is_arithmetic_v<Data>) {
+    return simd::Contains(Elements, size, value);
+  } else {
+    for (ulong index = 0; index < size; ++index) {
+      if (Elements[index] == value) {
+        return true;
+      }
+    }
+    return false;
+  }
+}
+
+// Early-exit traversals: Plain loops over the buffer, left at the first false
+
+template <typename Data, typename Alloc>
+bool Vector<Data, Alloc>::TraverseWhile(PredicateFun fun) const {
+  return PreOrderTraverseWhile(fun);
+}
+
+template <typename Data, typename Alloc>
+bool Vector<Data, Alloc>::PreOrderTraverseWhile(PredicateFun fun) const {
+  for (ulong index = 0; index < size; ++index) {
+    if (!fun(Elements[index])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Data, typename Alloc>
+bool Vector<Data, Alloc>::PostOrderTraverseWhile(PredicateFun fun) const {
+  for (ulong index = size; index > 0; --index) {
+    if (!fun(Elements[index - 1])) {
+      return false;
+    }
+  }
+  return true;
+}
+
 // Specific member function (inherited from ResizableContainer)
 // Dynamically changes the vector size while preserving existing elements when possible
 
-template <typename Data>
-void Vector<Data>::Resize(ulong newSize) {
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::Resize(ulong newSize) {
+  if (newSize == 0) {
+    // Special case: resizing to empty vector always releases the storage
+    std::destroy_n(Elements, size); // Destroy existing elements
+    ReleaseStorage(); // Free existing memory
+    Elements = nullptr; // Reset pointer to null
+    size = capacity = 0; // Update size and capacity to zero
+    return;
+  }
+
   if (newSize == size) {
     return; // No change needed - optimization for same size
   }
   
-  if (newSize == 0) {
-    // Special case: resizing to empty vector
-    delete[] Elements; // Free existing memory
-    Elements = nullptr; // Reset pointer to null
-    size = 0; // Update size to zero
+  if (newSize < size) {
+    // Shrinking keeps the storage: only the discarded elements are destroyed
+    std::destroy(Elements + newSize, Elements + size);
+    size = newSize;
     return;
   }
-  
-  // General case: create new array with new size
-  Data* tempElements = new Data[newSize]{}; // Allocate and default-construct elements
-  
-  // Copy existing elements up to the minimum of old and new sizes
-  ulong minSize = (size < newSize) ? size : newSize;
-  for(ulong i = 0; i < minSize; ++i) {
-    tempElements[i] = Elements[i]; // Preserve existing data
+
+  // Growing needs default values for the new slots; Resize is virtual, so it is
+  // always instantiated and must still compile for non default-constructible types
+  if constexpr (std::is_default_constructible_v<Data>) {
+    // Reallocate geometrically only if the new size does not fit
+    EnsureCapacity(newSize);
+
+    // New elements are default-constructed in the spare raw slots
+    std::uninitialized_value_construct(Elements + size, Elements + newSize);
+    size = newSize; // Update size
+  } else {
+    throw std::length_error("Cannot grow a vector of non default-constructible elements");
+  }
+}
+
+// Capacity management
+
+// Capacity: Number of elements the current storage can hold without reallocation
+template <typename Data, typename Alloc>
+ulong Vector<Data, Alloc>::Capacity() const noexcept {
+  return capacity;
+}
+
+// Reserve: Grows the storage to hold at least the requested number of elements
+// Never shrinks; the size and the element values are unchanged
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::Reserve(ulong newCapacity) {
+  if (newCapacity > capacity) {
+    Reallocate(newCapacity);
+  }
+}
+
+// ShrinkToFit: Releases the spare capacity so that Capacity() == Size()
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::ShrinkToFit() {
+  if (front + capacity > size) {
+    Reallocate(size);
+  }
+}
+
+// GetAllocator: Returns a copy of the allocator providing the storage
+template <typename Data, typename Alloc>
+Alloc Vector<Data, Alloc>::GetAllocator() const noexcept {
+  return alloc;
+}
+
+// GrowthFactor: Multiplier used when the storage has to grow
+template <typename Data, typename Alloc>
+double Vector<Data, Alloc>::GrowthFactor() const noexcept {
+  return growthFactor;
+}
+
+// SetGrowthFactor: Changes the multiplier used for geometric growth
+// Factors not greater than 1 would not grow the storage, so they are rejected
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::SetGrowthFactor(double factor) {
+  if (!(factor > 1.0)) {
+    throw std::invalid_argument("Vector growth factor must be greater than 1");
+  }
+  growthFactor = factor;
+}
+
+// Amortized O(1) insertion and removal at the back
+
+// PushBack (copy version): Appends a copy of the element
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::PushBack(const Data& data) {
+  EmplaceBack(data);
+}
+
+// PushBack (move version): Appends the element by moving it
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::PushBack(Data&& data) {
+  EmplaceBack(std::move(data));
+}
+
+// PopBack: Removes the last element, keeping the storage for later insertions
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::PopBack() {
+  if (size == 0) {
+    throw std::length_error("Access to an empty vector");
+  }
+  std::destroy_at(Elements + --size); // Destroy the removed element
+}
+
+// Inlinable traversal
+
+// ForEach: Applies a read-only callable to every element, front to back
+template <typename Data, typename Alloc>
+template <typename Fun>
+void Vector<Data, Alloc>::ForEach(Fun&& fun) const {
+  const Data* elements = Elements;
+  for (ulong index = 0; index < size; ++index) {
+    fun(elements[index]);
+  }
+}
+
+// ForEachMut: Applies a mutating callable to every element, front to back
+template <typename Data, typename Alloc>
+template <typename Fun>
+void Vector<Data, Alloc>::ForEachMut(Fun&& fun) {
+  Data* elements = Elements;
+  for (ulong index = 0; index < size; ++index) {
+    fun(elements[index]);
+  }
+}
+
+// Reduce: Folds the elements front to back with the same argument order as Fold
+template <typename Data, typename Alloc>
+template <typename Accumulator, typename Fun>
+Accumulator Vector<Data, Alloc>::Reduce(Fun&& fun, Accumulator acc) const {
+  const Data* elements = Elements;
+  for (ulong index = 0; index < size; ++index) {
+    acc = fun(elements[index], acc);
+  }
+  return acc;
+}
+
+// Arithmetic reductions: Delegated to the SIMD kernels
+
+template <typename Data, typename Alloc>
+Data Vector<Data, Alloc>::Sum() const noexcept requires std::is_arithmetic_v<Data> {
+  return simd::Sum(Elements, size);
+}
+
+template <typename Data, typename Alloc>
+Data Vector<Data, Alloc>::MinValue() const requires std::is_arithmetic_v<Data> {
+  if (size == 0) {
+    throw std::length_error("Access to an empty vector");
+  }
+  return simd::Min(Elements, size);
+}
+
+template <typename Data, typename Alloc>
+Data Vector<Data, Alloc>::MaxValue() const requires std::is_arithmetic_v<Data> {
+  if (size == 0) {
+    throw std::length_error("Access to an empty vector");
+  }
+  return simd::Max(Elements, size);
+}
+
+// STL-compatible iteration over the live elements [Elements, Elements + size)
+
+template <typename Data, typename Alloc>
+typename Vector<Data, Alloc>::iterator Vector<Data, Alloc>::begin() noexcept {
+  return Elements;
+}
+
+template <typename Data, typename Alloc>
+typename Vector<Data, Alloc>::iterator Vector<Data, Alloc>::end() noexcept {
+  return Elements + size;
+}
+
+template <typename Data, typename Alloc>
+typename Vector<Data, Alloc>::const_iterator Vector<Data, Alloc>::begin() const noexcept {
+  return Elements;
+}
+
+template <typename Data, typename Alloc>
+typename Vector<Data, Alloc>::const_iterator Vector<Data, Alloc>::end() const noexcept {
+  return Elements + size;
+}
+
+template <typename Data, typename Alloc>
+typename Vector<Data, Alloc>::const_iterator Vector<Data, Alloc>::cbegin() const noexcept {
+  return Elements;
+}
+
+template <typename Data, typename Alloc>
+typename Vector<Data, Alloc>::const_iterator Vector<Data, Alloc>::cend() const noexcept {
+  return Elements + size;
+}
+
+// Auxiliary functions
+
+// Allocate: Obtains raw, uninitialized storage for 'count' elements from the allocator
+template <typename Data, typename Alloc>
+Data* Vector<Data, Alloc>::Allocate(ulong count) {
+  return (count == 0) ? nullptr : AllocTraits::allocate(alloc, count);
+}
+
+// Deallocate: Releases storage obtained from Allocate (elements must already be destroyed)
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::Deallocate(Data* storage, ulong count) noexcept {
+  if (storage != nullptr) {
+    AllocTraits::deallocate(alloc, storage, count);
+  }
+}
+
+// Relocate: Transfers 'count' live elements into raw storage at 'to', destroying the originals
+// Trivially copyable elements are copied as bytes with a single memcpy. Other elements are
+// moved when the move constructor cannot throw (or no copy exists); otherwise they are
+// copied, so a throwing copy leaves the source untouched
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::Relocate(Data* from, ulong count, Data* to) {
+  if constexpr (std::is_trivially_copyable_v<Data>) {
+    if (count > 0) {
+      std::memcpy(static_cast<void*>(to), static_cast<const void*>(from), count * sizeof(Data));
+    }
+    return; // Nothing to destroy
+  } else {
+    if constexpr (std::is_nothrow_move_constructible_v<Data> || !std::is_copy_constructible_v<Data>) {
+      std::uninitialized_move_n(from, count, to);
+    } else {
+      std::uninitialized_copy_n(from, count, to);
+    }
+    std::destroy_n(from, count);
+  }
+}
+
+// CopyConstruct: Copies 'count' live elements into raw storage at 'to'
+// Trivially copyable elements are copied with a single memcpy
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::CopyConstruct(const Data* from, ulong count, Data* to) {
+  if constexpr (std::is_trivially_copyable_v<Data>) {
+    if (count > 0) {
+      std::memcpy(static_cast<void*>(to), static_cast<const void*>(from), count * sizeof(Data));
+    }
+  } else {
+    std::uninitialized_copy_n(from, count, to);
+  }
+}
+
+// Shift: Move-assigns the live elements in [first, last) onto the live slots starting at 'to'
+// The ranges may overlap in either direction. Trivially copyable elements use a single
+// memmove; other elements are moved front to back or back to front as the overlap requires
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::Shift(Data* first, Data* last, Data* to) {
+  if (first == last || first == to) {
+    return;
+  }
+  if constexpr (std::is_trivially_copyable_v<Data>) {
+    std::memmove(static_cast<void*>(to), static_cast<const void*>(first), (last - first) * sizeof(Data));
+  } else if (to < first) {
+    std::move(first, last, to);
+  } else {
+    std::move_backward(first, last, to + (last - first));
+  }
+}
+
+// ReleaseStorage: Returns the buffer to the allocator; it starts 'front' slots before Elements
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::ReleaseStorage() noexcept {
+  if (Elements != nullptr) {
+    Deallocate(Elements - front, front + capacity);
+  }
+  front = 0;
+}
+
+// Reallocate: Relocates the elements into a new buffer of 'newFront + newCapacity' slots,
+// leaving the first 'newFront' unused
+// The caller guarantees newCapacity >= size
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::Reallocate(ulong newCapacity, ulong newFront) {
+  Data* tempElements = Allocate(newFront + newCapacity);
+  try {
+    Relocate(Elements, size, tempElements + newFront);
+  } catch (...) {
+    Deallocate(tempElements, newFront + newCapacity);
+    throw;
+  }
+
+  ReleaseStorage();
+  Elements = (tempElements != nullptr) ? tempElements + newFront : nullptr;
+  capacity = newCapacity;
+  front = (tempElements != nullptr) ? newFront : 0;
+}
+
+// EmplaceBack: Constructs a new last element from the given arguments
+// When the storage is full the element is constructed in the new buffer before the
+// old one is released, so arguments referring to our own elements stay valid
+template <typename Data, typename Alloc>
+template <typename... Args>
+void Vector<Data, Alloc>::EmplaceBack(Args&&... args) {
+  if (size < capacity) {
+    std::construct_at(Elements + size, std::forward<Args>(args)...);
+    ++size;
+    return;
+  }
+
+  ulong newCapacity = GrownCapacity(size + 1);
+  Data* tempElements = Allocate(newCapacity);
+  try {
+    std::construct_at(tempElements + size, std::forward<Args>(args)...);
+  } catch (...) {
+    Deallocate(tempElements, newCapacity);
+    throw;
+  }
+  try {
+    Relocate(Elements, size, tempElements);
+  } catch (...) {
+    std::destroy_at(tempElements + size);
+    Deallocate(tempElements, newCapacity);
+    throw;
+  }
+
+  ReleaseStorage();
+  Elements = tempElements;
+  capacity = newCapacity;
+  ++size;
+}
+
+// InsertAt: Inserts the element at 'index', shifting the following elements one slot right
+// The caller guarantees index <= size
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::InsertAt(ulong index, Data&& data) {
+  EnsureCapacity(size + 1);
+  if (index == size) {
+    std::construct_at(Elements + size, std::move(data));
+  } else {
+    // The last element moves into the raw slot, the others are move-assigned
+    std::construct_at(Elements + size, std::move(Elements[size - 1]));
+    Shift(Elements + index, Elements + size - 1, Elements + index + 1);
+    Elements[index] = std::move(data);
+  }
+  ++size;
+}
+
+// RemoveAt: Removes the element at 'index', shifting the following elements one slot left
+// The caller guarantees index < size
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::RemoveAt(ulong index) {
+  Shift(Elements + index + 1, Elements + size, Elements + index);
+  std::destroy_at(Elements + --size); // The vacated last slot becomes raw storage again
+}
+
+// InsertNear: Inserts the element at 'index', shifting whichever side of it is shorter
+// Elements before 'index' move one slot back into the front slots; when the shorter side
+// has no room left the buffer grows, with the spare slots split between both ends
+// The caller guarantees index <= size
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::InsertNear(ulong index, Data&& data) {
+  bool toFront = index < size - index;
+  if (toFront ? front == 0 : size == capacity) {
+    ulong total = GrownCapacity(size + 2); // At least one spare slot at each end
+    ulong newFront = (total - size) / 2;
+    Reallocate(total - newFront, newFront);
+  }
+  if (!toFront) {
+    InsertAt(index, std::move(data));
+    return;
+  }
+
+  if (index == 0) {
+    std::construct_at(Elements - 1, std::move(data));
+  } else {
+    // The first element moves into the raw front slot, the others are move-assigned
+    std::construct_at(Elements - 1, std::move(Elements[0]));
+    Shift(Elements + 1, Elements + index, Elements);
+    Elements[index - 1] = std::move(data);
+  }
+  PushFrontSlot();
+  ++size;
+}
+
+// RemoveNear: Removes the element at 'index', shifting whichever side of it is shorter
+// The caller guarantees index < size
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::RemoveNear(ulong index) {
+  if (index < size - 1 - index) {
+    Shift(Elements, Elements + index, Elements + 1);
+    PopFrontSlot(); // The vacated first slot becomes a front slot
+  } else {
+    RemoveAt(index);
+  }
+}
+
+// PushFrontSlot: Moves the start of the array one slot back into the front slots
+// Index 0 is then raw storage, and the caller must construct an element there
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::PushFrontSlot() noexcept {
+  --Elements;
+  --front;
+  ++capacity;
+}
+
+// PopFrontSlot: Destroys the element at index 0 and moves the start of the array past it
+// The slot is kept as a front slot, so no other element moves
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::PopFrontSlot() noexcept {
+  std::destroy_at(Elements);
+  ++Elements;
+  ++front;
+  --capacity;
+  --size;
+}
+
+// GrownCapacity: Capacity to use when at least 'minCapacity' slots are required
+template <typename Data, typename Alloc>
+ulong Vector<Data, Alloc>::GrownCapacity(ulong minCapacity) const noexcept {
+  ulong newCapacity = static_cast<ulong>(capacity * growthFactor);
+  return (newCapacity < minCapacity) ? minCapacity : newCapacity;
+}
+
+// EnsureCapacity: Guarantees room for at least 'minCapacity' elements
+// Grows by 'growthFactor' so that repeated appends cost amortized O(1)
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::EnsureCapacity(ulong minCapacity) {
+  if (minCapacity > capacity) {
+    Reallocate(GrownCapacity(minCapacity));
+  }
+}
+
+// ShrinkCapacity: Halves the storage when at most a quarter of it is in use
+// Small buffers (capacity <= 4) are kept to avoid reallocating on every removal
+// After a bulk removal the halving is repeated, but the buffer is reallocated once
+// The quarter is measured against the whole buffer, front slots included, and the new buffer has none
+template <typename Data, typename Alloc>
+void Vector<Data, Alloc>::ShrinkCapacity() {
+  ulong total = front + capacity;
+  ulong newCapacity = total;
+  while (newCapacity > 4 && size <= newCapacity / 4) {
+    newCapacity /= 2;
+  }
+  if (newCapacity != total) {
+    Reallocate(newCapacity);
   }
-  // Note: If newSize > size, new elements are default-constructed
-  // If newSize < size, excess elements are discarded
-  
-  delete[] Elements; // Free old memory
-  Elements = tempElements; // Assign new memory
-  size = newSize; // Update size
 }
 
 /* ************************************************************************** */
@@ -257,58 +794,224 @@ void Vector<Data>::Resize(ulong newSize) {
 
 // Default constructor: Creates an empty sortable vector
 // Delegates to Vector's default constructor
-template <typename Data>
-SortableVector<Data>::SortableVector() : Vector<Data>() {}
+template <typename Data, typename Alloc>
+SortableVector<Data, Alloc>::SortableVector() : Vector<Data, Alloc>() {}
+
+// Allocator constructor: Creates an empty sortable vector using the given allocator
+template <typename Data, typename Alloc>
+SortableVector<Data, Alloc>::SortableVector(const Alloc& allocator) noexcept : Vector<Data, Alloc>(allocator) {}
 
 // Specific constructors: Initialize sortable vector with various data sources
 // All delegate to corresponding Vector constructors for the actual data management
 
 // Constructor with initial size: Creates sortable vector with specified number of elements
-template <typename Data>
-SortableVector<Data>::SortableVector(const ulong n) : Vector<Data>(n) {}
+template <typename Data, typename Alloc>
+SortableVector<Data, Alloc>::SortableVector(const ulong n, const Alloc& allocator) : Vector<Data, Alloc>(n, allocator) {}
 
 // Constructor from TraversableContainer: Creates sortable vector by copying from any traversable container
-template <typename Data>
-SortableVector<Data>::SortableVector(const TraversableContainer<Data>& con) : Vector<Data>(con) {}
+template <typename Data, typename Alloc>
+SortableVector<Data, Alloc>::SortableVector(const TraversableContainer<Data>& con, const Alloc& allocator) : Vector<Data, Alloc>(con, allocator) {}
 
 // Constructor from MappableContainer: Creates sortable vector by moving from any mappable container
-template <typename Data>
-SortableVector<Data>::SortableVector(MappableContainer<Data>&& con) : Vector<Data>(std::move(con)) {}
+template <typename Data, typename Alloc>
+SortableVector<Data, Alloc>::SortableVector(MappableContainer<Data>&& con, const Alloc& allocator) : Vector<Data, Alloc>(std::move(con), allocator) {}
 
 // Copy constructor: Creates a deep copy of another sortable vector
-template <typename Data>
-SortableVector<Data>::SortableVector(const SortableVector<Data>& sv) : Vector<Data>(sv) {}
+template <typename Data, typename Alloc>
+SortableVector<Data, Alloc>::SortableVector(const SortableVector<Data, Alloc>& sv) : Vector<Data, Alloc>(sv) {}
 
 // Move constructor: Efficiently transfers ownership from another sortable vector
-template <typename Data>
-SortableVector<Data>::SortableVector(SortableVector<Data>&& sv) noexcept : Vector<Data>(std::move(sv)) {}
+template <typename Data, typename Alloc>
+SortableVector<Data, Alloc>::SortableVector(SortableVector<Data, Alloc>&& sv) noexcept : Vector<Data, Alloc>(std::move(sv)) {}
 
 // Copy assignment: Assigns contents of another sortable vector with deep copying
-template <typename Data>
-SortableVector<Data>& SortableVector<Data>::operator=(const SortableVector<Data>& sv) {
-  Vector<Data>::operator=(sv); // Delegate to Vector's copy assignment
+template <typename Data, typename Alloc>
+SortableVector<Data, Alloc>& SortableVector<Data, Alloc>::operator=(const SortableVector<Data, Alloc>& sv) {
+  Vector<Data, Alloc>::operator=(sv); // Delegate to Vector's copy assignment
   return *this; // Return reference for chaining
 }
 
 // Move assignment: Efficiently transfers ownership from another sortable vector
-template <typename Data>
-SortableVector<Data>& SortableVector<Data>::operator=(SortableVector<Data>&& sv) noexcept {
-  Vector<Data>::operator=(std::move(sv)); // Delegate to Vector's move assignment
+template <typename Data, typename Alloc>
+SortableVector<Data, Alloc>& SortableVector<Data, Alloc>::operator=(SortableVector<Data, Alloc>&& sv) noexcept(Vector<Data, Alloc>::NothrowMoveAssign) {
+  Vector<Data, Alloc>::operator=(std::move(sv)); // Delegate to Vector's move assignment
   return *this; // Return reference for chaining
 }
 
-// Implementation of SwapAt method from SortableLinearContainer
-// This method is called during sorting operations to exchange elements at specific positions
-// The temporary values are provided to optimize the swapping process
-template <typename Data>
-void SortableVector<Data>::SwapAt(ulong i, ulong j, const Data& temp_i, const Data& temp_j) {
-  // Direct assignment using the pre-computed temporary values
-  // This is more efficient than using std::swap as it avoids extra copies
-  this->Elements[i] = temp_j; // Place element j's value at position i
-  this->Elements[j] = temp_i; // Place element i's value at position j
-  
-  // Note: The QuickSort algorithm in SortableLinearContainer handles the
-  // temporary value management and calls this method for the actual swapping
+// Sort: Contiguous fast path of the introsort engine
+// The accessor indexes the raw buffer, so the whole sort inlines without virtual calls
+template <typename Data, typename Alloc>
+void SortableVector<Data, Alloc>::Sort() {
+  if constexpr (RadixSortable) {
+    if (this->size >= RadixSortThreshold) {
+      RadixSort();
+      return;
+    }
+  }
+  Data* elements = this->Elements;
+  IntroSort([elements](ulong index) -> Data& { return elements[index]; }, this->size,
+            [](const Data& a, const Data& b) { return a < b; });
+}
+
+// SortBy: Introsort on the buffer with the given comparator
+template <typename Data, typename Alloc>
+template <typename Less>
+void SortableVector<Data, Alloc>::SortBy(const Less& less) {
+  if constexpr (std::is_same_v<Less, std::less<Data>> || std::is_same_v<Less, std::less<>>) {
+    Sort();
+  } else {
+    Data* elements = this->Elements;
+    IntroSort([elements](ulong index) -> Data& { return elements[index]; }, this->size,
+              [&less](const Data& a, const Data& b) { return less(a, b); });
+  }
+}
+
+// RadixSort: Least significant byte first, ping-ponging between the buffer and a scratch area
+// The histograms of every byte are gathered in a single read pass; a byte that
+// is the same in all the keys (common with skewed or narrow-range data) skips
+// its scatter pass entirely. The scratch area is the vector's own spare
+// capacity when it is large enough, otherwise a temporary from the allocator.
+template <typename Data, typename Alloc>
+void SortableVector<Data, Alloc>::RadixSort() {
+  constexpr ulong Bytes = sizeof(RadixKey);
+  const ulong count = this->size;
+  Data* elements = this->Elements;
+
+  // Already sorted input is detected during the same pass and left untouched
+  ulong histograms[Bytes][256] = {};
+  RadixKey previous = 0;
+  bool sorted = true;
+  for (ulong index = 0; index < count; ++index) {
+    RadixKey key = ToRadixKey(elements[index]);
+    sorted = sorted && previous <= key;
+    previous = key;
+    for (ulong byte = 0; byte < Bytes; ++byte) {
+      ++histograms[byte][(key >> (8 * byte)) & 0xFF];
+    }
+  }
+  if (sorted) {
+    return;
+  }
+
+  bool ownScratch = this->capacity - count < count;
+  Data* scratch = ownScratch ? this->Allocate(count) : elements + count;
+  Data* source = elements;
+  Data* target = scratch;
+  RadixKey firstKey = ToRadixKey(elements[0]);
+  for (ulong byte = 0; byte < Bytes; ++byte) {
+    ulong* histogram = histograms[byte];
+    if (histogram[(firstKey >> (8 * byte)) & 0xFF] == count) {
+      continue;
+    }
+    ulong offset = 0;
+    for (ulong digit = 0; digit < 256; ++digit) {
+      ulong digitCount = histogram[digit];
+      histogram[digit] = offset;
+      offset += digitCount;
+    }
+    for (ulong index = 0; index < count; ++index) {
+      target[histogram[(ToRadixKey(source[index]) >> (8 * byte)) & 0xFF]++] = source[index];
+    }
+    std::swap(source, target);
+  }
+  if (source != elements) {
+    std::copy_n(source, count, elements);
+  }
+  if (ownScratch) {
+    this->Deallocate(scratch, count);
+  }
+}
+
+// ToRadixKey: Signed integers get their sign bit flipped; negative floats have
+// all their bits inverted and non-negative ones just the sign bit set
+// (-0.0 is placed before +0.0, and NaNs at the ends according to their sign)
+template <typename Data, typename Alloc>
+typename SortableVector<Data, Alloc>::RadixKey SortableVector<Data, Alloc>::ToRadixKey(Data value) noexcept {
+  constexpr RadixKey SignBit = RadixKey(1) << (8 * sizeof(RadixKey) - 1);
+  RadixKey bits = std::bit_cast<RadixKey>(value);
+  if constexpr (std::is_floating_point_v<Data>) {
+    return (bits & SignBit) ? RadixKey(~bits) : RadixKey(bits | SignBit);
+  } else if constexpr (std::is_signed_v<Data>) {
+    return bits ^ SignBit;
+  } else {
+    return bits;
+  }
+}
+
+// ParallelSort: Chunked introsort followed by rounds of pairwise merges
+template <typename Data, typename Alloc>
+void SortableVector<Data, Alloc>::ParallelSort(ulong threads) {
+  if (threads == 0) {
+    threads = std::thread::hardware_concurrency();
+  }
+  threads = std::min({threads, this->size / ParallelSortMinChunk, MaxSortThreads});
+  if (threads <= 1) {
+    Sort();
+    return;
+  }
+
+  // Chunk 'i' spans [bounds[i], bounds[i + 1])
+  ulong bounds[MaxSortThreads + 1];
+  for (ulong i = 0; i <= threads; ++i) {
+    bounds[i] = this->size / threads * i + std::min(i, this->size % threads);
+  }
+
+  Data* elements = this->Elements;
+  RunConcurrently(threads, [elements, &bounds](ulong chunk) {
+    Data* first = elements + bounds[chunk];
+    IntroSort([first](ulong index) -> Data& { return first[index]; }, bounds[chunk + 1] - bounds[chunk],
+              [](const Data& a, const Data& b) { return a < b; });
+  });
+
+  // Round 'width' merges runs of 'width' chunks two by two
+  for (ulong width = 1; width < threads; width *= 2) {
+    ulong merges = (threads + 2 * width - 1) / (2 * width);
+    RunConcurrently(merges, [elements, &bounds, threads, width](ulong merge) {
+      ulong first = merge * 2 * width;
+      ulong middle = first + width;
+      ulong last = std::min(middle + width, threads);
+      if (middle < last) {
+        std::inplace_merge(elements + bounds[first], elements + bounds[middle], elements + bounds[last],
+                           [](const Data& a, const Data& b) { return a < b; });
+      }
+    });
+  }
+}
+
+// RunConcurrently: Task 0 runs on the calling thread; if a thread cannot be
+// started its task runs inline as well, so the work is always completed
+template <typename Data, typename Alloc>
+template <typename Task>
+void SortableVector<Data, Alloc>::RunConcurrently(ulong count, const Task& task) {
+  std::thread workers[MaxSortThreads];
+  std::exception_ptr errors[MaxSortThreads];
+  auto run = [&task, &errors](ulong index) {
+    try {
+      task(index);
+    } catch (...) {
+      errors[index] = std::current_exception();
+    }
+  };
+
+  for (ulong index = 1; index < count; ++index) {
+    try {
+      workers[index] = std::thread(run, index);
+    } catch (const std::system_error&) {
+      run(index);
+    }
+  }
+  run(0);
+
+  for (ulong index = 1; index < count; ++index) {
+    if (workers[index].joinable()) {
+      workers[index].join();
+    }
+  }
+  for (ulong index = 0; index < count; ++index) {
+    if (errors[index]) {
+      std::rethrow_exception(errors[index]);
+    }
+  }
 }
 
 /* ************************************************************************** */
@@ -9,7 +9,7 @@
  * Key Features:
  * - Contiguous memory storage for cache efficiency
  * - O(1) random access via index operator
- * - Dynamic resizing capabilities
+ * - Dynamic resizing with geometric capacity growth (amortized O(1) appends)
  * - Integration with the container hierarchy
  * - Sorting functionality in SortableVector
  */
@@ -19,7 +19,13 @@
 
 /* ************************************************************************** */
 
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
 #include "../container/linear.hpp"
+#include "../simd/simd.hpp"
 
 /* ************************************************************************** */
 
@@ -39,8 +45,21 @@ namespace lasd {
  * The Vector maintains an array of elements in contiguous memory, allowing
  * for efficient random access and cache-friendly memory usage patterns.
  * It automatically manages memory allocation and deallocation.
+ * 
+ * Storage is tracked separately from the logical size: 'capacity' raw slots are
+ * allocated and only the first 'size' of them hold constructed elements, so
+ * Data need not be default-constructible (only Vector(ulong) and a growing
+ * Resize construct default values). When more room is
+ * needed the capacity grows geometrically (by 'growthFactor'), so a sequence
+ * of PushBack or growing Resize calls costs amortized O(1) per element.
+ * Derived containers (SetVec, PQHeap) reuse this capacity model through the
+ * protected EnsureCapacity/ShrinkCapacity helpers.
+ * 
+ * All storage is obtained from the 'Alloc' allocator (std::allocator by default),
+ * so a vector can be placed in an arena or pool (see allocator/). Allocators
+ * follow the standard propagation traits on copy and move.
  */
-template <typename Data>
+template <typename Data, typename Alloc = std::allocator<Data>>
 class Vector : virtual public MutableLinearContainer<Data>,
                virtual public ResizableContainer {
 
@@ -50,20 +69,35 @@ protected:
 
   using Container::size; // Inherit size from base Container class
 
-  Data* Elements = nullptr; // Pointer to dynamically allocated array of elements
+  using AllocTraits = std::allocator_traits<Alloc>;
+  static_assert(std::is_same_v<typename AllocTraits::value_type, Data>, "Vector allocator must allocate Data");
+
+  [[no_unique_address]] Alloc alloc; // Allocator providing the element storage
+
+  // Move assignment only hands storage over when the allocators propagate or always compare equal;
+  // otherwise it allocates, so it may throw
+  static constexpr bool NothrowMoveAssign = AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value;
+
+  Data* Elements = nullptr; // Pointer to the first element of the dynamically allocated array
+  ulong capacity = 0; // Number of allocated slots from Elements on (always >= size)
+  ulong front = 0; // Unused slots allocated before Elements (left by PopFrontSlot)
+  double growthFactor = 2.0; // Multiplier applied to capacity when the vector must grow
 
 public:
 
   // Default constructor: Creates an empty vector with no allocated memory
   Vector() = default;
 
+  // Allocator constructor: Creates an empty vector that will allocate from the given allocator
+  explicit Vector(const Alloc&) noexcept;
+
   /* ************************************************************************ */
 
   // Specific constructors for different initialization scenarios
   
-  Vector(const ulong); // Creates a vector with specified initial size (elements default-constructed)
-  Vector(const TraversableContainer<Data>&); // Creates vector by copying elements from any traversable container
-  Vector(MappableContainer<Data>&&); // Creates vector by moving elements from any mappable container
+  Vector(const ulong, const Alloc& = Alloc()); // Creates a vector with specified initial size (elements default-constructed)
+  Vector(const TraversableContainer<Data>&, const Alloc& = Alloc()); // Creates vector by copying elements from any traversable container
+  Vector(MappableContainer<Data>&&, const Alloc& = Alloc()); // Creates vector by moving elements from any mappable container
 
   /* ************************************************************************ */
 
@@ -83,7 +117,7 @@ public:
   // Assignment operators for copying and moving vector contents
   
   Vector& operator=(const Vector&); // Copy assignment: Deep copies another vector
-  Vector& operator=(Vector&&) noexcept; // Move assignment: Transfers ownership efficiently
+  Vector& operator=(Vector&&) noexcept(NothrowMoveAssign); // Move assignment: Transfers ownership efficiently
 
   /* ************************************************************************ */
 
@@ -111,6 +145,24 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member function (inherited from TestableContainer)
+
+  // Linear scan of the buffer, vectorized for int, float and double
+  bool Exists(const Data&) const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Early-exit traversals (inherited from LinearContainer)
+  // Loops over the buffer directly, without the virtual operator[]
+
+  using typename TraversableContainer<Data>::PredicateFun;
+
+  bool TraverseWhile(PredicateFun) const override; // Front to back
+  bool PreOrderTraverseWhile(PredicateFun) const override; // Front to back
+  bool PostOrderTraverseWhile(PredicateFun) const override; // Back to front
+
+  /* ************************************************************************ */
+
   // Specific member function (inherited from ResizableContainer)
   // Allows dynamic resizing of the vector with automatic memory management
 
@@ -121,9 +173,98 @@ public:
   // Specific member function (inherited from ClearableContainer)
   // Clear() functionality is inherited from ResizableContainer (resize to 0)
 
+  /* ************************************************************************ */
+
+  // Capacity management
+  // Capacity never shrinks implicitly on a Resize to a non-zero size or on PopBack; use
+  // ShrinkToFit to release memory. Resize(0), and therefore Clear, frees the storage
+
+  ulong Capacity() const noexcept; // Number of elements that fit without reallocating
+  void Reserve(ulong); // Grows capacity to at least the given number of elements
+  void ShrinkToFit(); // Reduces capacity to the current size
+
+  double GrowthFactor() const noexcept; // Current geometric growth factor
+  void SetGrowthFactor(double); // Sets the growth factor (throws invalid_argument if not > 1)
+
+  /* ************************************************************************ */
+
+  // Allocator access
+
+  Alloc GetAllocator() const noexcept; // Returns a copy of the allocator
+
+  /* ************************************************************************ */
+
+  // Amortized O(1) insertion and removal at the back
+
+  void PushBack(const Data&); // Appends a copy of the element
+  void PushBack(Data&&); // Appends the element by moving it
+  void PopBack(); // Removes the last element (throws length_error if empty)
+
+  /* ************************************************************************ */
+
+  // Inlinable traversal
+  // Unlike Traverse/Map/Fold these accept any callable and call it directly on the
+  // storage, with no std::function or virtual dispatch; the virtual API remains for
+  // polymorphic use. The elements are visited from front to back.
+
+  template <typename Fun>
+  void ForEach(Fun&&) const; // Calls fun(const Data&) on every element
+  template <typename Fun>
+  void ForEachMut(Fun&&); // Calls fun(Data&) on every element
+  template <typename Accumulator, typename Fun>
+  Accumulator Reduce(Fun&&, Accumulator) const; // acc = fun(element, acc) over every element, as Fold
+
+  /* ************************************************************************ */
+
+  // Arithmetic reductions (arithmetic Data only)
+  // Vectorized for int, float and double (see simd/simd.hpp: floating-point sums
+  // may differ from a sequential Fold in the last bits)
+
+  Data Sum() const noexcept requires std::is_arithmetic_v<Data>; // Sum of the elements (0 if empty)
+  Data MinValue() const requires std::is_arithmetic_v<Data>; // Smallest element (throws length_error if empty)
+  Data MaxValue() const requires std::is_arithmetic_v<Data>; // Largest element (throws length_error if empty)
+
+  /* ************************************************************************ */
+
+  // STL-compatible iteration
+  // The storage is contiguous, so plain pointers serve as iterators: they model
+  // std::contiguous_iterator and make the vector a std::ranges::contiguous_range.
+  // Iterators are invalidated by any operation that may reallocate or shift elements.
+
+  using iterator = Data*;
+  using const_iterator = const Data*;
+
+  iterator begin() noexcept; // Iterator to the first element
+  iterator end() noexcept; // Iterator past the last element
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
 protected:
 
-  // Auxiliary functions could be added here for internal operations
+  // Auxiliary functions
+
+  Data* Allocate(ulong); // Returns raw storage for the given number of elements
+  void Deallocate(Data*, ulong) noexcept; // Releases raw storage obtained from Allocate
+  static void Relocate(Data*, ulong, Data*); // Moves (or copies, if moving may throw) live elements into raw storage
+  static void CopyConstruct(const Data*, ulong, Data*); // Copies live elements into raw storage
+  static void Shift(Data*, Data*, Data*); // Move-assigns a range of live elements onto live slots (ranges may overlap)
+
+  void ReleaseStorage() noexcept; // Frees the whole buffer, front slots included (elements must already be destroyed)
+  void Reallocate(ulong, ulong = 0); // Moves the elements into a new buffer of the given capacity, after the given front slots
+  void EnsureCapacity(ulong); // Grows geometrically until at least the given capacity is available
+  void ShrinkCapacity(); // Halves the buffer when at most a quarter of it (front slots included) is in use
+  ulong GrownCapacity(ulong) const noexcept; // Geometric capacity that fits at least the given size
+
+  template <typename... Args>
+  void EmplaceBack(Args&&...); // Constructs a new last element in place
+  void InsertAt(ulong, Data&&); // Inserts at an index, shifting the tail right
+  void RemoveAt(ulong); // Removes at an index, shifting the tail left
+  void InsertNear(ulong, Data&&); // Inserts at an index, shifting the shorter side (the head moves into the front slots)
+  void RemoveNear(ulong); // Removes at an index, shifting the shorter side (the head leaves a front slot)
+  void PushFrontSlot() noexcept; // Turns the last front slot into raw storage at index 0 (front > 0)
+  void PopFrontSlot() noexcept; // Destroys the element at index 0 and keeps its slot as a front slot
 
 };
 
@@ -138,16 +279,16 @@ protected:
  * 
  * Key Features:
  * - All Vector functionality (random access, resizing, etc.)
- * - Built-in QuickSort implementation from SortableLinearContainer
- * - Efficient element swapping for sorting operations
+ * - Introsort engine from SortableLinearContainer
+ * - Move-based element swapping for sorting operations
  * - Maintains contiguous memory layout during sorting
  * 
- * The sorting functionality uses the QuickSort algorithm implemented in the
- * parent SortableLinearContainer class, with optimized swapping operations
- * that take advantage of the vector's contiguous memory structure.
+ * Sort() runs the introsort engine of SortableLinearContainer directly on the
+ * contiguous buffer, so comparisons and moves compile down to plain pointer
+ * accesses instead of virtual operator[] calls.
  */
-template <typename Data>
-class SortableVector : public Vector<Data>,
+template <typename Data, typename Alloc = std::allocator<Data>>
+class SortableVector : public Vector<Data, Alloc>,
                        public SortableLinearContainer<Data> {
 
 private:
@@ -159,13 +300,16 @@ public:
   // Default constructor: Creates an empty sortable vector
   SortableVector();
 
+  // Allocator constructor: Creates an empty sortable vector using the given allocator
+  explicit SortableVector(const Alloc&) noexcept;
+
   /* ************************************************************************ */
 
   // Specific constructors for different initialization scenarios
   
-  SortableVector(const ulong); // Creates a sortable vector with specified initial size
-  SortableVector(const TraversableContainer<Data>&); // Creates sortable vector from any traversable container
-  SortableVector(MappableContainer<Data>&&); // Creates sortable vector by moving from any mappable container
+  SortableVector(const ulong, const Alloc& = Alloc()); // Creates a sortable vector with specified initial size
+  SortableVector(const TraversableContainer<Data>&, const Alloc& = Alloc()); // Creates sortable vector from any traversable container
+  SortableVector(MappableContainer<Data>&&, const Alloc& = Alloc()); // Creates sortable vector by moving from any mappable container
 
   /* ************************************************************************ */
 
@@ -185,20 +329,55 @@ public:
   // Assignment operators for copying and moving sortable vector contents
   
   SortableVector& operator=(const SortableVector&); // Copy assignment with deep copying
-  SortableVector& operator=(SortableVector&&) noexcept; // Move assignment with resource transfer
+  SortableVector& operator=(SortableVector&&) noexcept(Vector<Data, Alloc>::NothrowMoveAssign); // Move assignment with resource transfer
 
   /* ************************************************************************ */
 
-  // Note: Sort functionality is inherited from SortableLinearContainer
-  // The Sort() method uses QuickSort algorithm for efficient O(n log n) average-case sorting
+  // Specific member function (inherited from SortableLinearContainer)
+
+  // Introsort on the contiguous buffer, O(n log n) worst case; integral and IEEE
+  // floating-point types of at least RadixSortThreshold elements are radix sorted
+  void Sort() override;
+
+  // SortBy() - Sorts in the order of the given strict weak ordering
+  // The natural order (std::less) goes through Sort(), radix sorting included
+  template <typename Less>
+  void SortBy(const Less&);
+
+  // ParallelSort() - Sorts the buffer with up to 'threads' threads (0 = hardware concurrency)
+  // The buffer is cut into one chunk per thread, the chunks are introsorted
+  // concurrently and then merged pairwise, each merge round running in parallel.
+  // Each thread gets at least ParallelSortMinChunk elements, so small vectors fall
+  // back to the sequential Sort(); at most MaxSortThreads threads are used.
+  // The first exception thrown by a comparison or a move is rethrown once every
+  // thread has been joined (the vector is then left in an unspecified order).
+  void ParallelSort(ulong threads = 0);
+
+  static constexpr ulong ParallelSortMinChunk = 1UL << 16;
+  static constexpr ulong MaxSortThreads = 64;
+
+  // Types sorted by RadixSort(): integers (bool excluded) and 32/64-bit IEEE floats
+  static constexpr bool RadixSortable = (std::is_integral_v<Data> && !std::is_same_v<Data, bool> && sizeof(Data) <= 8)
+    || (std::is_floating_point_v<Data> && std::numeric_limits<Data>::is_iec559 && (sizeof(Data) == 4 || sizeof(Data) == 8));
+  static constexpr ulong RadixSortThreshold = 1024;
 
 protected:
 
-  // Implementation of virtual method from SortableLinearContainer
-  // This method performs the actual element swapping during sorting operations
-  virtual void SwapAt(ulong, ulong, const Data&, const Data&) override;
+  using SortableLinearContainer<Data>::IntroSort;
+
+  // Unsigned integer of the same width as Data, whose natural order is the order of Data
+  using RadixKey = std::conditional_t<sizeof(Data) == 1, std::uint8_t,
+                   std::conditional_t<sizeof(Data) == 2, std::uint16_t,
+                   std::conditional_t<sizeof(Data) == 4, std::uint32_t, std::uint64_t>>>;
+
+  // Auxiliary functions
+
+  void RadixSort(); // LSD radix sort, one stable counting pass per key byte
+  static RadixKey ToRadixKey(Data) noexcept; // Order-preserving map from Data to RadixKey
 
-  // Additional auxiliary functions could be added here for sorting optimizations
+  // RunConcurrently() - Runs task(0), ..., task(count - 1) on separate threads and joins them
+  template <typename Task>
+  static void RunConcurrently(ulong count, const Task& task);
 
 };
 
@@ -0,0 +1,118 @@
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+#include "../list/list.hpp"
+#include "../set/lst/setlst.hpp"
+#include "../allocator/arena.hpp"
+#include "../allocator/pool.hpp"
+#include <string>
+
+// Builds the containers of one simulated request with the given allocator
+template <typename Alloc>
+static long runRequest(const Alloc& alloc, unsigned long elements) {
+    using IntAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<int>;
+    lasd::Vector<int, IntAlloc> vec{IntAlloc(alloc)};
+    lasd::List<int, IntAlloc> lst{IntAlloc(alloc)};
+    lasd::SetLst<int, IntAlloc> set{IntAlloc(alloc)};
+    for (unsigned long i = 0; i < elements; i++) {
+        vec.PushBack(i);
+        lst.InsertAtBack(i);
+        set.Insert((i * 7919) % elements);
+    }
+    while (lst.Size() > elements / 2) {
+        lst.RemoveFromFront();
+    }
+    return vec.Back() + lst.Front() + set.Max();
+}
+
+void benchAllocator() {
+    const unsigned long pushes = scaled(10000000);
+    const unsigned long nodes = scaled(2000000);
+    const unsigned long requests = scaled(20000);
+    const unsigned long perRequest = 64;
+
+    // ========== PUSHBACK SU VECTOR ==========
+
+    double ms = measureMs([&] {
+        lasd::Vector<int> vec;
+        for (unsigned long i = 0; i < pushes; i++) vec.PushBack(i);
+        doNotOptimize(vec.Back());
+    });
+    printBenchResult("Vector<int>::PushBack", "std::allocator", ms, pushes);
+
+    ms = measureMs([&] {
+        lasd::MonotonicArena arena;
+        lasd::Vector<int, lasd::ArenaAllocator<int>> vec{lasd::ArenaAllocator<int>(arena)};
+        for (unsigned long i = 0; i < pushes; i++) vec.PushBack(i);
+        doNotOptimize(vec.Back());
+    });
+    printBenchResult("Vector<int>::PushBack", "MonotonicArena", ms, pushes);
+
+    ms = measureMs([&] {
+        lasd::PoolResource pool;
+        lasd::Vector<int, lasd::PoolAllocator<int>> vec{lasd::PoolAllocator<int>(pool)};
+        for (unsigned long i = 0; i < pushes; i++) vec.PushBack(i);
+        doNotOptimize(vec.Back());
+    });
+    printBenchResult("Vector<int>::PushBack", "PoolResource", ms, pushes);
+
+    // ========== COSTRUZIONE E DISTRUZIONE DI LIST ==========
+
+    ms = measureMs([&] {
+        lasd::List<int> lst;
+        for (unsigned long i = 0; i < nodes; i++) lst.InsertAtBack(i);
+        doNotOptimize(lst.Back());
+    });
+    printBenchResult("List<int>::InsertAtBack+~List", "std::allocator", ms, nodes);
+
+    ms = measureMs([&] {
+        lasd::MonotonicArena arena;
+        {
+            lasd::List<int, lasd::ArenaAllocator<int>> lst{lasd::ArenaAllocator<int>(arena)};
+            for (unsigned long i = 0; i < nodes; i++) lst.InsertAtBack(i);
+            doNotOptimize(lst.Back());
+        }
+    });
+    printBenchResult("List<int>::InsertAtBack+~List", "MonotonicArena", ms, nodes);
+
+    ms = measureMs([&] {
+        lasd::PoolResource pool;
+        {
+            lasd::List<int, lasd::PoolAllocator<int>> lst{lasd::PoolAllocator<int>(pool)};
+            for (unsigned long i = 0; i < nodes; i++) lst.InsertAtBack(i);
+            doNotOptimize(lst.Back());
+        }
+    });
+    printBenchResult("List<int>::InsertAtBack+~List", "PoolResource", ms, nodes);
+
+    // ========== RICHIESTE SIMULATE (Vector + List + SetLst) ==========
+
+    ms = measureMs([&] {
+        long total = 0;
+        for (unsigned long r = 0; r < requests; r++) {
+            total += runRequest(std::allocator<int>(), perRequest);
+        }
+        doNotOptimize(total);
+    });
+    printBenchResult("Richieste", "std::allocator", ms, requests);
+
+    ms = measureMs([&] {
+        long total = 0;
+        lasd::MonotonicArena arena;
+        for (unsigned long r = 0; r < requests; r++) {
+            total += runRequest(lasd::ArenaAllocator<int>(arena), perRequest);
+            arena.Release(); // One-shot release of the whole request
+        }
+        doNotOptimize(total);
+    });
+    printBenchResult("Richieste", "MonotonicArena (Release per richiesta)", ms, requests);
+
+    ms = measureMs([&] {
+        long total = 0;
+        lasd::PoolResource pool;
+        for (unsigned long r = 0; r < requests; r++) {
+            total += runRequest(lasd::PoolAllocator<int>(pool), perRequest);
+        }
+        doNotOptimize(total);
+    });
+    printBenchResult("Richieste", "PoolResource", ms, requests);
+}
@@ -0,0 +1,70 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+
+#include "bench.hpp"
+
+// Global scale factor
+double benchScale = 1.0;
+
+unsigned long scaled(unsigned long count) {
+    unsigned long result = static_cast<unsigned long>(count * benchScale);
+    return result > 0 ? result : 1;
+}
+
+// Helper function to print benchmark results
+void printBenchResult(const std::string& benchName, const std::string& description, double ms, unsigned long operations) {
+    std::cout << "[" << benchName << "]: " << std::fixed << std::setprecision(2) << ms << " ms";
+    if (operations > 0 && ms > 0.0) {
+        std::cout << " (" << std::setprecision(1) << operations / (ms * 1000.0) << " Mop/s)";
+    }
+    std::cout << " - " << description << std::endl;
+}
+
+// Registered benchmarks, selectable by name from the command line
+struct BenchEntry {
+    const char* name;
+    void (*run)();
+};
+
+static const BenchEntry benchmarks[] = {
+    {"allocator", benchAllocator},
+    {"list", benchList},
+    {"fold", benchFold},
+    {"sort", benchSort},
+    {"parallelsort", benchParallelSort},
+    {"simd", benchSimd},
+    {"set", benchSet},
+};
+
+// Usage: ./bench [nome|all] [scala]
+int main(int argc, char** argv) {
+    std::string selected = argc > 1 ? argv[1] : "all";
+    if (argc > 2) {
+        benchScale = std::atof(argv[2]);
+        if (benchScale <= 0.0) {
+            std::cout << "Scala non valida: " << argv[2] << std::endl;
+            return 1;
+        }
+    }
+
+    bool found = false;
+    for (const BenchEntry& entry : benchmarks) {
+        if (selected == "all" || selected == entry.name) {
+            found = true;
+            std::cout << "\n=== Benchmark " << entry.name << " ===" << std::endl;
+            entry.run();
+        }
+    }
+
+    if (!found) {
+        std::cout << "Benchmark sconosciuto: " << selected << "\nDisponibili:";
+        for (const BenchEntry& entry : benchmarks) {
+            std::cout << " " << entry.name;
+        }
+        std::cout << std::endl;
+        return 1;
+    }
+    return 0;
+}
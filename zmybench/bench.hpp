@@ -0,0 +1,56 @@
+#ifndef MYBENCH_HPP
+#define MYBENCH_HPP
+
+/* ************************************************************************** */
+
+#include <chrono>
+#include <string>
+#include <iostream>
+
+/* ************************************************************************** */
+
+// Scale factor applied to the element counts of every benchmark (default 1.0);
+// set from the command line to run quick smoke runs or longer measurements
+extern double benchScale;
+
+// Returns the scaled element count for a benchmark
+unsigned long scaled(unsigned long count);
+
+// Funzione helper per stampare il risultato di un benchmark
+// Prints the elapsed time and, when operations > 0, the throughput in Mop/s
+void printBenchResult(const std::string& benchName, const std::string& description, double ms, unsigned long operations = 0);
+
+// Keeps the compiler from optimizing away a value computed by a benchmark
+template <typename T>
+inline void doNotOptimize(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Runs fun 'repetitions' times and returns the best wall-clock time in milliseconds
+template <typename Fun>
+double measureMs(Fun&& fun, unsigned int repetitions = 3) {
+  double best = -1.0;
+  for (unsigned int i = 0; i < repetitions; i++) {
+    auto start = std::chrono::steady_clock::now();
+    fun();
+    auto stop = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(stop - start).count();
+    if (best < 0.0 || ms < best) {
+      best = ms;
+    }
+  }
+  return best;
+}
+
+/* ************************************************************************** */
+
+// Declarations for benchmarks in separate files
+void benchAllocator();
+void benchList();
+void benchFold();
+void benchSort();
+void benchParallelSort();
+void benchSimd();
+void benchSet();
+
+#endif
@@ -0,0 +1,65 @@
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+#include "../list/list.hpp"
+
+// Compares the virtual std::function traversal (Fold) with the inlinable Reduce/ForEach
+
+void benchFold() {
+    const unsigned long elements = scaled(100000000);
+    const unsigned long listElements = scaled(10000000);
+
+    // ========== VECTOR ==========
+
+    lasd::Vector<int> vec(elements);
+    vec.ForEachMut([value = 0](int& element) mutable { element = value++ & 0xFF; });
+
+    double ms = measureMs([&] {
+        long sum = vec.Fold<long>([](const int& element, const long& acc) { return acc + element; }, 0L);
+        doNotOptimize(sum);
+    });
+    printBenchResult("Vector<int>::Fold", "somma (std::function + dispatch virtuale)", ms, elements);
+
+    ms = measureMs([&] {
+        long sum = vec.Reduce([](const int& element, long acc) { return acc + element; }, 0L);
+        doNotOptimize(sum);
+    });
+    printBenchResult("Vector<int>::Reduce", "somma (callable inline)", ms, elements);
+
+    ms = measureMs([&] {
+        long sum = 0;
+        vec.ForEach([&sum](const int& element) { sum += element; });
+        doNotOptimize(sum);
+    });
+    printBenchResult("Vector<int>::ForEach", "somma (callable inline)", ms, elements);
+
+    ms = measureMs([&] {
+        vec.Map([](int& element) { element ^= 1; });
+        doNotOptimize(vec.Front());
+    });
+    printBenchResult("Vector<int>::Map", "xor su ogni elemento", ms, elements);
+
+    ms = measureMs([&] {
+        vec.ForEachMut([](int& element) { element ^= 1; });
+        doNotOptimize(vec.Front());
+    });
+    printBenchResult("Vector<int>::ForEachMut", "xor su ogni elemento", ms, elements);
+
+    vec.Clear();
+
+    // ========== LIST ==========
+
+    lasd::List<int> lst;
+    for (unsigned long i = 0; i < listElements; i++) lst.InsertAtBack(i & 0xFF);
+
+    ms = measureMs([&] {
+        long sum = lst.Fold<long>([](const int& element, const long& acc) { return acc + element; }, 0L);
+        doNotOptimize(sum);
+    });
+    printBenchResult("List<int>::Fold", "somma (std::function + dispatch virtuale)", ms, listElements);
+
+    ms = measureMs([&] {
+        long sum = lst.Reduce([](const int& element, long acc) { return acc + element; }, 0L);
+        doNotOptimize(sum);
+    });
+    printBenchResult("List<int>::Reduce", "somma (callable inline)", ms, listElements);
+}
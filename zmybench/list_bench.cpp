@@ -0,0 +1,88 @@
+#include "bench.hpp"
+#include "../list/list.hpp"
+#include "../set/lst/setlst.hpp"
+#include <forward_list>
+
+// std::forward_list (one heap allocation per node) is measured alongside as reference
+
+void benchList() {
+    const unsigned long elements = scaled(10000000);
+    const unsigned long cycles = scaled(10000000);
+
+    // ========== INSERIMENTO IN CODA ==========
+
+    double ms = measureMs([&] {
+        lasd::List<int> lst;
+        for (unsigned long i = 0; i < elements; i++) lst.InsertAtBack(i);
+        doNotOptimize(lst.Back());
+    });
+    printBenchResult("List<int>::InsertAtBack", "lista con pool di nodi (incluso ~List)", ms, elements);
+
+    ms = measureMs([&] {
+        std::forward_list<int> lst;
+        auto last = lst.before_begin();
+        for (unsigned long i = 0; i < elements; i++) last = lst.insert_after(last, i);
+        doNotOptimize(*last);
+    });
+    printBenchResult("std::forward_list<int>::insert_after", "riferimento, un'allocazione per nodo", ms, elements);
+
+    // ========== ATTRAVERSAMENTO ==========
+
+    lasd::List<int> lst;
+    for (unsigned long i = 0; i < elements; i++) lst.InsertAtBack(i);
+    ms = measureMs([&] {
+        long sum = 0;
+        lst.Traverse([&sum](const int& value) { sum += value; });
+        doNotOptimize(sum);
+    });
+    printBenchResult("List<int>::Traverse", "somma degli elementi", ms, elements);
+
+    std::forward_list<int> fwd;
+    auto last = fwd.before_begin();
+    for (unsigned long i = 0; i < elements; i++) last = fwd.insert_after(last, i);
+    ms = measureMs([&] {
+        long sum = 0;
+        for (int value : fwd) sum += value;
+        doNotOptimize(sum);
+    });
+    printBenchResult("std::forward_list<int>", "somma degli elementi (riferimento)", ms, elements);
+
+    // ========== INSERIMENTO E RIMOZIONE (CODA FIFO) ==========
+
+    ms = measureMs([&] {
+        for (unsigned long i = 0; i < cycles; i++) {
+            lst.InsertAtBack(lst.Front());
+            lst.RemoveFromFront();
+        }
+        doNotOptimize(lst.Front());
+    });
+    printBenchResult("List<int>::InsertAtBack+RemoveFromFront", "riuso dei nodi tramite free list", ms, 2 * cycles);
+
+    ms = measureMs([&] {
+        for (unsigned long i = 0; i < cycles; i++) {
+            fwd.push_front(fwd.front());
+            fwd.pop_front();
+        }
+        doNotOptimize(fwd.front());
+    });
+    printBenchResult("std::forward_list<int>::push_front+pop_front", "riferimento", ms, 2 * cycles);
+
+    // ========== CLEAR E RIEMPIMENTO ==========
+
+    ms = measureMs([&] {
+        lst.Clear();
+        for (unsigned long i = 0; i < elements; i++) lst.InsertAtBack(i);
+        doNotOptimize(lst.Back());
+    });
+    printBenchResult("List<int>::Clear+InsertAtBack", "nodi riciclati dopo Clear", ms, 2 * elements);
+
+    // ========== SETLST ==========
+
+    ms = measureMs([&] {
+        lasd::SetLst<int> set;
+        for (unsigned long i = elements; i > 0; i--) set.Insert(static_cast<int>(i));
+        while (!set.Empty()) set.RemoveMin();
+        doNotOptimize(set.Size());
+    });
+    printBenchResult("SetLst<int>::Insert+RemoveMin", "inserimenti decrescenti (in testa) e rimozione del minimo", ms, 2 * elements);
+}
@@ -0,0 +1,39 @@
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+#include <thread>
+
+// Sorts a fresh copy of the input on every repetition (the copy is excluded from the timing)
+static double timeParallelSort(const lasd::SortableVector<int>& input, unsigned long threads) {
+    double best = -1.0;
+    for (int rep = 0; rep < 3; rep++) {
+        lasd::SortableVector<int> vec(input);
+        double ms = measureMs([&] { vec.ParallelSort(threads); }, 1);
+        doNotOptimize(vec.Front());
+        if (best < 0.0 || ms < best) best = ms;
+    }
+    return best;
+}
+
+void benchParallelSort() {
+    const unsigned long elements = scaled(20000000);
+
+    lasd::SortableVector<int> data(elements);
+    unsigned int state = 2463534242u;
+    for (unsigned long i = 0; i < elements; i++) {
+        state ^= state << 13; state ^= state >> 17; state ^= state << 5; // xorshift32
+        data[i] = static_cast<int>(state);
+    }
+
+    std::cout << "Thread hardware disponibili: " << std::thread::hardware_concurrency() << std::endl;
+
+    // One thread takes the sequential fallback and is the baseline for the speedups
+    double baseline = timeParallelSort(data, 1);
+    printBenchResult("SortableVector<int>::ParallelSort(1)", "sequenziale, input casuale", baseline, elements);
+
+    for (unsigned long threads : {2UL, 4UL, 8UL, 16UL}) {
+        double ms = timeParallelSort(data, threads);
+        std::string speedup = std::to_string(baseline / ms);
+        printBenchResult("SortableVector<int>::ParallelSort(" + std::to_string(threads) + ")",
+                         "input casuale, speedup " + speedup.substr(0, speedup.find('.') + 3) + "x", ms, elements);
+    }
+}
@@ -0,0 +1,518 @@
+#include <random>
+#include <string>
+#include <cmath>
+#include <unordered_set>
+
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+#include "../set/vec/setvec.hpp"
+#include "../set/lst/setlst.hpp"
+#include "../set/btree/setbtree.hpp"
+#include "../set/hash/sethash.hpp"
+
+// Compares bulk insertion (sort + single merge) and bulk removal (sort + single
+// compaction) with inserting or removing one element at a time, and times the
+// merge-based set algebra, the frozen (Eytzinger) lookups and the learned lookup
+// model on uniform, Zipfian and clustered keys; min removals and inserts near the
+// front are timed against their counterparts at the back, and random inserts are
+// timed for trivially copyable (memmove shifts) and non-trivial elements; the
+// SetLst skip-list index is timed against walking the list, and its finger
+// search on ascending, nearly ascending and random streams; the SetBTree B+-tree
+// is timed against SetVec and the indexed SetLst, and alone on a larger set; the
+// SetHash open-addressing table is timed against std::unordered_set, SetVec and
+// the indexed SetLst, and against std::unordered_set alone on a larger set; the
+// Bloom prefilter is timed on lookups of mostly absent elements in SetVec and SetLst
+
+// std::unordered_set behind the dictionary member names, for the shared runner
+struct StdHashSet {
+    std::unordered_set<int> set;
+    bool Insert(int element) { return set.insert(element).second; }
+    bool Exists(int element) const { return set.count(element) != 0; }
+    bool Remove(int element) { return set.erase(element) != 0; }
+    unsigned long Size() const { return set.size(); }
+};
+
+void benchSet() {
+    const unsigned long initial = scaled(200000);
+    const unsigned long batchSize = scaled(200000);
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 1 << 30);
+
+    lasd::Vector<int> seed(initial);
+    seed.ForEachMut([&](int& element) { element = dist(gen); });
+    lasd::Vector<int> batch(batchSize);
+    batch.ForEachMut([&](int& element) { element = dist(gen); });
+
+    double ms = measureMs([&] {
+        lasd::SetVec<int> set(seed);
+        batch.ForEach([&set](const int& element) { set.Insert(element); });
+        doNotOptimize(set.Size());
+    });
+    printBenchResult("SetVec<int>::Insert", "inserimento di un elemento alla volta", ms, batchSize);
+
+    ms = measureMs([&] {
+        lasd::SetVec<int> set(seed);
+        bool inserted = set.InsertSome(batch);
+        doNotOptimize(inserted);
+    });
+    printBenchResult("SetVec<int>::InsertSome", "ordinamento del blocco e fusione unica", ms, batchSize);
+
+    ms = measureMs([&] {
+        lasd::SetVec<int> set(batch);
+        doNotOptimize(set.Size());
+    });
+    printBenchResult("SetVec<int>::SetVec", "costruzione da contenitore", ms, batchSize);
+
+    lasd::SetVec<int> full(seed);
+    lasd::Vector<int> victims(full);
+
+    ms = measureMs([&] {
+        lasd::SetVec<int> set(full);
+        victims.ForEach([&set](const int& element) { set.Remove(element); });
+        doNotOptimize(set.Size());
+    });
+    printBenchResult("SetVec<int>::Remove", "rimozione di un elemento alla volta", ms, victims.Size());
+
+    ms = measureMs([&] {
+        lasd::SetVec<int> set(full);
+        bool removed = set.RemoveAll(victims);
+        doNotOptimize(removed);
+    });
+    printBenchResult("SetVec<int>::RemoveAll", "ordinamento del blocco e compattazione unica", ms, victims.Size());
+
+    const unsigned long listElements = scaled(20000);
+    lasd::SetLst<int> fullList;
+    lasd::Vector<int> listVictims(listElements);
+    for (unsigned long i = 0; i < listElements; i++) {
+        fullList.Insert(static_cast<int>(i));
+        listVictims[i] = static_cast<int>(listElements - 1 - i); // From the largest: a full walk per Remove
+    }
+
+    lasd::SetLst<int> listSet(fullList);
+    ms = measureMs([&] {
+        listVictims.ForEach([&listSet](const int& element) { listSet.Remove(element); });
+        doNotOptimize(listSet.Size());
+    }, 1);
+    printBenchResult("SetLst<int>::Remove", "rimozione di un elemento alla volta", ms, listElements);
+
+    listSet = fullList;
+    ms = measureMs([&] {
+        bool removed = listSet.RemoveAll(listVictims);
+        doNotOptimize(removed);
+    }, 1);
+    printBenchResult("SetLst<int>::RemoveAll", "ordinamento del blocco e visita unica della lista", ms, listElements);
+
+    // ========== SET ALGEBRA ==========
+
+    lasd::SetVec<int> other(batch);
+    ms = measureMs([&] {
+        lasd::SetVec<int> set(full);
+        set.InsertAll(other);
+        doNotOptimize(set.Size());
+    });
+    printBenchResult("SetVec<int>::InsertAll", "unione tramite InsertAll", ms, full.Size() + other.Size());
+
+    ms = measureMs([&] {
+        lasd::SetVec<int> set = full.Union(other);
+        doNotOptimize(set.Size());
+    });
+    printBenchResult("SetVec<int>::Union", "fusione lineare di insiemi simili", ms, full.Size() + other.Size());
+
+    lasd::SetVec<int> small;
+    for (unsigned long i = 0; i < 64; i++) small.Insert(seed[i]);
+    const unsigned long lookups = 10000;
+    ms = measureMs([&] {
+        bool all = true;
+        for (unsigned long k = 0; k < lookups; k++) all = small.IsSubsetOf(full) && all;
+        doNotOptimize(all);
+    });
+    printBenchResult("SetVec<int>::IsSubsetOf", "64 elementi in un insieme grande (galoppo)", ms, lookups * small.Size());
+
+    ms = measureMs([&] {
+        ulong total = 0;
+        for (unsigned long k = 0; k < lookups; k++) total += full.Intersection(small).Size();
+        doNotOptimize(total);
+    });
+    printBenchResult("SetVec<int>::Intersection", "insieme grande con 64 elementi (galoppo)", ms, lookups * small.Size());
+
+    // ========== FRONT SLOTS ==========
+
+    const unsigned long queueElements = scaled(200000);
+    lasd::Vector<int> ascending(queueElements);
+    ascending.ForEachMut([value = 0](int& element) mutable { element = value++; });
+
+    ms = measureMs([&] {
+        lasd::SetVec<int> set(ascending);
+        while (!set.Empty()) set.RemoveMin();
+        doNotOptimize(set.Size());
+    });
+    printBenchResult("SetVec<int>::RemoveMin", "svuotamento dal minimo", ms, queueElements);
+
+    ms = measureMs([&] {
+        lasd::SetVec<int> set(ascending);
+        while (!set.Empty()) set.RemoveMax();
+        doNotOptimize(set.Size());
+    });
+    printBenchResult("SetVec<int>::RemoveMax", "svuotamento dal massimo", ms, queueElements);
+
+    ms = measureMs([&] {
+        lasd::SetVec<int> set;
+        for (unsigned long i = queueElements; i > 0; i--) set.Insert(static_cast<int>(i));
+        doNotOptimize(set.Size());
+    });
+    printBenchResult("SetVec<int>::Insert", "chiavi decrescenti (sempre in testa)", ms, queueElements);
+
+    ms = measureMs([&] {
+        lasd::SetVec<int> set;
+        for (unsigned long i = 0; i < queueElements; i++) set.Insert(static_cast<int>(i));
+        doNotOptimize(set.Size());
+    });
+    printBenchResult("SetVec<int>::Insert", "chiavi crescenti (sempre in coda)", ms, queueElements);
+
+    ms = measureMs([&] {
+        lasd::SetVec<int> set(ascending);
+        for (unsigned long i = 0; i < queueElements; i++) {
+            set.RemoveMin();
+            set.Insert(static_cast<int>(queueElements + i));
+        }
+        doNotOptimize(set.Size());
+    });
+    printBenchResult("SetVec<int>::RemoveMin", "coda di priorita' (estrazione e inserimento)", ms, queueElements);
+
+    // ========== ELEMENT SHIFTING ==========
+
+    const unsigned long shiftElements = scaled(50000);
+    lasd::Vector<int> shiftKeys(shiftElements);
+    shiftKeys.ForEachMut([&](int& element) { element = dist(gen); });
+    lasd::Vector<std::string> shiftWords(shiftElements);
+    for (unsigned long i = 0; i < shiftElements; i++) shiftWords[i] = "parola-" + std::to_string(shiftKeys[i]);
+
+    ms = measureMs([&] {
+        lasd::SetVec<int> set;
+        shiftKeys.ForEach([&set](const int& element) { set.Insert(element); });
+        doNotOptimize(set.Size());
+    });
+    printBenchResult("SetVec<int>::Insert", "chiavi casuali (spostamento con memmove)", ms, shiftElements);
+
+    ms = measureMs([&] {
+        lasd::SetVec<std::string> set;
+        shiftWords.ForEach([&set](const std::string& element) { set.Insert(element); });
+        doNotOptimize(set.Size());
+    });
+    printBenchResult("SetVec<string>::Insert", "chiavi casuali (spostamento per move)", ms, shiftElements);
+
+    lasd::SetVec<int> shiftFull(shiftKeys);
+    ms = measureMs([&] {
+        lasd::SetVec<int> copy(shiftFull);
+        doNotOptimize(copy.Size());
+    });
+    printBenchResult("SetVec<int>::SetVec", "copia (memcpy)", ms, shiftFull.Size());
+
+    // ========== FROZEN LOOKUPS ==========
+
+    const unsigned long frozenElements = scaled(10000000);
+    const unsigned long queries = scaled(10000000);
+    lasd::Vector<int> keys(frozenElements);
+    keys.ForEachMut([value = 0](int& element) mutable { element = value; value += 2; });
+    lasd::SetVec<int> lookup(keys);
+    lasd::Vector<int> probes(queries);
+    std::uniform_int_distribution<int> probeDist(0, static_cast<int>(2 * frozenElements));
+    probes.ForEachMut([&](int& element) { element = probeDist(gen); });
+
+    auto runLookups = [&](const char* mode) {
+        double time = measureMs([&] {
+            unsigned long hits = 0;
+            probes.ForEach([&](const int& probe) { hits += lookup.Exists(probe); });
+            doNotOptimize(hits);
+        });
+        printBenchResult("SetVec<int>::Exists", std::string("10M elementi, ") + mode, time, queries);
+        time = measureMs([&] {
+            long sum = 0;
+            probes.ForEach([&](const int& probe) {
+                if (probe < 2 * static_cast<int>(frozenElements) - 2) sum += lookup.Successor(probe);
+            });
+            doNotOptimize(sum);
+        });
+        printBenchResult("SetVec<int>::Successor", std::string("10M elementi, ") + mode, time, queries);
+    };
+
+    runLookups("ricerca binaria");
+    lookup.Freeze();
+    runLookups("layout di Eytzinger");
+
+    // ========== LEARNED LOOKUP MODEL ==========
+
+    const unsigned long modelElements = scaled(5000000);
+    lasd::Vector<int> modelKeys(modelElements);
+
+    auto runModel = [&](const char* distribution) {
+        lasd::SetVec<int> set(modelKeys);
+        lasd::Vector<int> modelProbes(queries);
+        std::uniform_int_distribution<unsigned long> pick(0, set.Size() - 1);
+        std::uniform_int_distribution<int> anyKey(set.Min(), set.Max());
+        modelProbes.ForEachMut([&](int& element) { element = (gen() & 1) ? set[pick(gen)] : anyKey(gen); });
+
+        auto lookups = [&](const char* mode) {
+            double time = measureMs([&] {
+                unsigned long hits = 0;
+                modelProbes.ForEach([&](const int& probe) { hits += set.Exists(probe); });
+                doNotOptimize(hits);
+            });
+            printBenchResult("SetVec<int>::Exists", std::string(distribution) + ", " + mode, time, queries);
+        };
+        lookups("ricerca binaria");
+        set.EnableModel();
+        lookups("modello");
+    };
+
+    // Uniform: evenly spaced keys with random jitter
+    std::uniform_int_distribution<int> jitter(0, 99);
+    for (unsigned long i = 0; i < modelElements; i++) modelKeys[i] = static_cast<int>(i * 200) + jitter(gen);
+    runModel("uniformi");
+
+    // Zipfian: gaps drawn from a power law, so a few huge gaps and many tiny ones
+    std::uniform_real_distribution<double> unit(1e-9, 1.0);
+    long key = 0;
+    for (unsigned long i = 0; i < modelElements; i++) {
+        key += 1 + static_cast<long>(std::min(std::pow(unit(gen), -1.2), 1e4));
+        modelKeys[i] = static_cast<int>(key);
+    }
+    runModel("zipfiane");
+
+    // Clustered: 64 dense clusters at random centers
+    std::uniform_int_distribution<int> center(0, 1 << 30);
+    for (unsigned long i = 0; i < modelElements; i += 64 * 1024) {
+        int base = center(gen);
+        for (unsigned long k = i; k < modelElements && k < i + 64 * 1024; k++) modelKeys[k] = base + static_cast<int>((k - i) * 3);
+    }
+    runModel("raggruppate");
+
+    // ========== SKIP-LIST INDEX ==========
+
+    const unsigned long laneElements = scaled(20000);
+    lasd::Vector<int> laneKeys(laneElements);
+    laneKeys.ForEachMut([&](int& element) { element = dist(gen); });
+
+    auto runLanes = [&](bool indexed, const char* mode) {
+        lasd::SetLst<int> set;
+        if (indexed) set.EnableIndex(42);
+        double time = measureMs([&] {
+            laneKeys.ForEach([&set](const int& element) { set.Insert(element); });
+            doNotOptimize(set.Size());
+        }, 1);
+        printBenchResult("SetLst<int>::Insert", mode, time, laneElements);
+
+        time = measureMs([&] {
+            unsigned long hits = 0;
+            laneKeys.ForEach([&](const int& probe) { hits += set.Exists(probe) + set.Exists(probe + 1); });
+            doNotOptimize(hits);
+        }, 1);
+        printBenchResult("SetLst<int>::Exists", mode, time, 2 * laneElements);
+
+        time = measureMs([&] {
+            laneKeys.ForEach([&set](const int& element) { set.Remove(element); });
+            doNotOptimize(set.Size());
+        }, 1);
+        printBenchResult("SetLst<int>::Remove", mode, time, laneElements);
+    };
+    runLanes(false, "visita della lista");
+    runLanes(true, "corsie dell'indice skip-list");
+
+    // ========== FINGER SEARCH ==========
+
+    const unsigned long fingerElements = scaled(50000);
+    lasd::Vector<int> fingerAscending(fingerElements), fingerNear(fingerElements), fingerRandom(fingerElements);
+    std::uniform_int_distribution<int> wobble(-8, 8);
+    std::uniform_int_distribution<int> anyPosition(0, static_cast<int>(fingerElements) * 4);
+    for (unsigned long i = 0; i < fingerElements; i++) {
+        fingerAscending[i] = static_cast<int>(i) * 4;
+        fingerNear[i] = static_cast<int>(i) * 4 + wobble(gen); // Local jitter around an ascending sweep
+        fingerRandom[i] = anyPosition(gen);
+    }
+
+    auto runFinger = [&](bool indexed, const char* mode) {
+        lasd::SetLst<int> set;
+        if (indexed) set.EnableIndex(42);
+        double time = measureMs([&] {
+            fingerAscending.ForEach([&set](const int& element) { set.Insert(element); });
+            doNotOptimize(set.Size());
+        }, 1);
+        printBenchResult("SetLst<int>::Insert", std::string("crescente, ") + mode, time, fingerElements);
+
+        auto lookups = [&](const lasd::Vector<int>& stream, const char* name) {
+            double streamTime = measureMs([&] {
+                unsigned long hits = 0;
+                stream.ForEach([&](const int& probe) { hits += set.Exists(probe); });
+                doNotOptimize(hits);
+            }, 1);
+            printBenchResult("SetLst<int>::Exists", std::string(name) + ", " + mode, streamTime, fingerElements);
+        };
+        lookups(fingerAscending, "crescente");
+        lookups(fingerNear, "quasi crescente");
+        lookups(fingerRandom, "casuale");
+    };
+    runFinger(false, "dito");
+    runFinger(true, "dito e indice");
+
+    // ========== B+-TREE ==========
+
+    const unsigned long treeElements = scaled(50000);
+    lasd::Vector<int> treeKeys(treeElements);
+    treeKeys.ForEachMut([&](int& element) { element = dist(gen); });
+
+    // Same random inserts, lookups (half misses), in-order visit and removals on each set
+    auto runTree = [&](auto& set, const char* name) {
+        double time = measureMs([&] {
+            treeKeys.ForEach([&set](const int& element) { set.Insert(element); });
+            doNotOptimize(set.Size());
+        }, 1);
+        printBenchResult(std::string(name) + "::Insert", "inserimenti casuali", time, treeElements);
+
+        time = measureMs([&] {
+            unsigned long hits = 0;
+            treeKeys.ForEach([&](const int& probe) { hits += set.Exists(probe) + set.Exists(probe + 1); });
+            doNotOptimize(hits);
+        }, 1);
+        printBenchResult(std::string(name) + "::Exists", "ricerche casuali", time, 2 * treeElements);
+
+        time = measureMs([&] {
+            long sum = 0;
+            set.Traverse([&sum](const int& element) { sum += element; });
+            doNotOptimize(sum);
+        });
+        printBenchResult(std::string(name) + "::Traverse", "visita in ordine", time, set.Size());
+
+        time = measureMs([&] {
+            treeKeys.ForEach([&set](const int& element) { set.Remove(element); });
+            doNotOptimize(set.Size());
+        }, 1);
+        printBenchResult(std::string(name) + "::Remove", "rimozioni casuali", time, treeElements);
+    };
+    {
+        lasd::SetVec<int> vecSet;
+        runTree(vecSet, "SetVec<int>");
+        lasd::SetLst<int> lstSet;
+        lstSet.EnableIndex(42);
+        runTree(lstSet, "SetLst<int> (indice)");
+        lasd::SetBTree<int> treeSet;
+        runTree(treeSet, "SetBTree<int>");
+        lasd::SetBTree<int, std::allocator<int>, std::less<int>, 8> narrowSet;
+        runTree(narrowSet, "SetBTree<int, 8>");
+    }
+
+    // Larger set, out of reach of the shifting and list-based sets
+    const unsigned long largeElements = scaled(2000000);
+    lasd::Vector<int> largeKeys(largeElements);
+    largeKeys.ForEachMut([&](int& element) { element = dist(gen); });
+    lasd::SetBTree<int> largeSet;
+    ms = measureMs([&] {
+        largeKeys.ForEach([&largeSet](const int& element) { largeSet.Insert(element); });
+        doNotOptimize(largeSet.Size());
+    }, 1);
+    printBenchResult("SetBTree<int>::Insert", "inserimenti casuali, insieme grande", ms, largeElements);
+
+    ms = measureMs([&] {
+        unsigned long hits = 0;
+        largeKeys.ForEach([&](const int& probe) { hits += largeSet.Exists(probe); });
+        doNotOptimize(hits);
+    }, 1);
+    printBenchResult("SetBTree<int>::Exists", "ricerche casuali, insieme grande", ms, largeElements);
+
+    ms = measureMs([&] {
+        unsigned long position = 0;
+        for (unsigned long i = 0; i < largeElements; i += 16) { position += largeSet[(i * 2654435761UL) % largeSet.Size()]; }
+        doNotOptimize(position);
+    }, 1);
+    printBenchResult("SetBTree<int>::operator[]", "accesso per indice, insieme grande", ms, largeElements / 16);
+
+    // ========== HASH SET ==========
+
+    const unsigned long hashElements = scaled(50000);
+    lasd::Vector<int> hashKeys(hashElements);
+    hashKeys.ForEachMut([&](int& element) { element = dist(gen); });
+
+    // Same random inserts, lookups (half misses) and removals on each set
+    auto runHash = [&](auto& set, const char* name, const lasd::Vector<int>& keys, const char* mode) {
+        double time = measureMs([&] {
+            keys.ForEach([&set](const int& element) { set.Insert(element); });
+            doNotOptimize(set.Size());
+        }, 1);
+        printBenchResult(std::string(name) + "::Insert", std::string("inserimenti casuali") + mode, time, keys.Size());
+
+        time = measureMs([&] {
+            unsigned long hits = 0;
+            keys.ForEach([&](const int& probe) { hits += set.Exists(probe) + set.Exists(probe + 1); });
+            doNotOptimize(hits);
+        }, 1);
+        printBenchResult(std::string(name) + "::Exists", std::string("ricerche casuali") + mode, time, 2 * keys.Size());
+
+        time = measureMs([&] {
+            keys.ForEach([&set](const int& element) { set.Remove(element); });
+            doNotOptimize(set.Size());
+        }, 1);
+        printBenchResult(std::string(name) + "::Remove", std::string("rimozioni casuali") + mode, time, keys.Size());
+    };
+    {
+        lasd::SetVec<int> vecSet;
+        runHash(vecSet, "SetVec<int>", hashKeys, "");
+        lasd::SetLst<int> lstSet;
+        lstSet.EnableIndex(42);
+        runHash(lstSet, "SetLst<int> (indice)", hashKeys, "");
+        StdHashSet stdSet;
+        runHash(stdSet, "std::unordered_set<int>", hashKeys, "");
+        lasd::SetHash<int> hashSet;
+        runHash(hashSet, "SetHash<int>", hashKeys, "");
+        lasd::SetHash<int> reservedSet;
+        reservedSet.Reserve(hashElements);
+        runHash(reservedSet, "SetHash<int>", hashKeys, ", dopo Reserve");
+    }
+
+    // Larger set, where the table no longer fits in cache
+    {
+        StdHashSet stdSet;
+        runHash(stdSet, "std::unordered_set<int>", largeKeys, ", insieme grande");
+        lasd::SetHash<int> hashSet;
+        runHash(hashSet, "SetHash<int>", largeKeys, ", insieme grande");
+    }
+
+    // ========== BLOOM PREFILTER ==========
+
+    // Nine lookups out of ten are for absent elements
+    auto mostlyAbsent = [&](const lasd::Vector<int>& keys) {
+        lasd::Vector<int> probes(keys.Size());
+        for (unsigned long i = 0; i < probes.Size(); i++) {
+            probes[i] = (i % 10 == 0) ? keys[i] : dist(gen);
+        }
+        return probes;
+    };
+
+    auto runFilter = [&](auto& set, const char* name, const lasd::Vector<int>& probes, unsigned long bitsPerKey) {
+        std::string mode = "90% assenti, senza filtro";
+        if (bitsPerKey > 0) {
+            set.EnableFilter(bitsPerKey);
+            mode = "90% assenti, filtro a " + std::to_string(bitsPerKey) + " bit per chiave";
+        }
+        double time = measureMs([&] {
+            unsigned long hits = 0;
+            probes.ForEach([&](const int& probe) { hits += set.Exists(probe); });
+            doNotOptimize(hits);
+        }, 1);
+        if (bitsPerKey > 0) {
+            mode += ", falsi positivi " + std::to_string(set.FilterStats().FalsePositiveRate() * 100.0).substr(0, 4) + "%";
+            set.DisableFilter();
+        }
+        printBenchResult(std::string(name) + "::Exists", mode, time, probes.Size());
+    };
+    {
+        lasd::SetVec<int> vecSet(hashKeys);
+        lasd::Vector<int> probes = mostlyAbsent(hashKeys);
+        for (unsigned long bits : {0UL, 6UL, 10UL, 16UL}) { runFilter(vecSet, "SetVec<int>", probes, bits); }
+
+        lasd::SetLst<int> lstSet(laneKeys);
+        lasd::Vector<int> lstProbes = mostlyAbsent(laneKeys);
+        for (unsigned long bits : {0UL, 10UL}) { runFilter(lstSet, "SetLst<int>", lstProbes, bits); }
+        lstSet.EnableIndex(42);
+        for (unsigned long bits : {0UL, 10UL}) { runFilter(lstSet, "SetLst<int> (indice)", lstProbes, bits); }
+    }
+}
@@ -0,0 +1,63 @@
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+
+// Compares the SIMD kernels of Vector at every level with the generic
+// Traverse-based Exists, a Fold sum and the virtual operator[] equality
+
+static const char* LevelName(lasd::simd::Level level) {
+    switch (level) {
+        case lasd::simd::Level::Scalar: return "scalare";
+        case lasd::simd::Level::Vector128: return "128 bit";
+        default: return "256 bit";
+    }
+}
+
+template <typename Data>
+static void benchSimdType(const std::string& type, unsigned long elements) {
+    lasd::Vector<Data> vec(elements);
+    vec.ForEachMut([value = 0](Data& element) mutable { element = static_cast<Data>(value++ & 0xFF); });
+    lasd::Vector<Data> copy(vec);
+    const Data missing = static_cast<Data>(1000); // Forces a full scan
+
+    double ms = measureMs([&] { doNotOptimize(vec.lasd::TraversableContainer<Data>::Exists(missing)); });
+    printBenchResult("TraversableContainer<" + type + ">::Exists", "Traverse + std::function, valore assente", ms, elements);
+
+    ms = measureMs([&] { doNotOptimize(vec.template Fold<Data>([](const Data& element, const Data& acc) { return acc + element; }, Data())); });
+    printBenchResult("Vector<" + type + ">::Fold", "somma (std::function + dispatch virtuale)", ms, elements);
+
+    ms = measureMs([&] {
+        const lasd::LinearContainer<Data>& base = vec;
+        const lasd::LinearContainer<Data>& other = copy;
+        doNotOptimize(base == other);
+    });
+    printBenchResult("LinearContainer<" + type + ">::operator==", "confronto tramite operator[] virtuale", ms, elements);
+
+    for (lasd::simd::Level level : {lasd::simd::Level::Scalar, lasd::simd::Level::Vector128, lasd::simd::Level::Vector256}) {
+        lasd::simd::SetLevel(level);
+        if (lasd::simd::CurrentLevel() != level) {
+            continue; // Not supported by this CPU
+        }
+        std::string name = LevelName(level);
+
+        ms = measureMs([&] { doNotOptimize(vec.Exists(missing)); });
+        printBenchResult("Vector<" + type + ">::Exists", "kernel " + name + ", valore assente", ms, elements);
+
+        ms = measureMs([&] { doNotOptimize(vec.Sum()); });
+        printBenchResult("Vector<" + type + ">::Sum", "kernel " + name, ms, elements);
+
+        ms = measureMs([&] { doNotOptimize(vec.MinValue()); doNotOptimize(vec.MaxValue()); });
+        printBenchResult("Vector<" + type + ">::MinValue/MaxValue", "kernel " + name + ", due passate", ms, 2 * elements);
+
+        ms = measureMs([&] { doNotOptimize(vec == copy); });
+        printBenchResult("Vector<" + type + ">::operator==", "kernel " + name, ms, elements);
+    }
+    lasd::simd::SetLevel(lasd::simd::SupportedLevel());
+}
+
+void benchSimd() {
+    const unsigned long elements = scaled(100000000);
+
+    benchSimdType<int>("int", elements);
+    benchSimdType<float>("float", elements);
+    benchSimdType<double>("double", elements);
+}
@@ -0,0 +1,101 @@
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+#include "../list/list.hpp"
+#include <algorithm>
+#include <list>
+#include <vector>
+
+// Input patterns used by the sorting benchmarks
+// Skewed inputs draw from 64 distinct values, so most of the key bytes are constant
+enum class SortInput { Random, Skewed, Ascending, Descending };
+
+static const char* SortInputName(SortInput input) {
+    switch (input) {
+        case SortInput::Random: return "casuale";
+        case SortInput::Skewed: return "concentrato";
+        case SortInput::Ascending: return "ordinato";
+        default: return "inverso";
+    }
+}
+
+template <typename Data>
+static void FillInput(lasd::SortableVector<Data>& vec, SortInput input) {
+    unsigned long count = vec.Size();
+    unsigned int state = 2463534242u;
+    for (unsigned long i = 0; i < count; i++) {
+        state ^= state << 13; state ^= state >> 17; state ^= state << 5; // xorshift32
+        switch (input) {
+            case SortInput::Random: vec[i] = static_cast<Data>(static_cast<int>(state)); break;
+            case SortInput::Skewed: vec[i] = static_cast<Data>(1000 + state % 64); break;
+            case SortInput::Ascending: vec[i] = i; break;
+            default: vec[i] = count - i; break;
+        }
+    }
+}
+
+// Sorts a fresh copy of the input on every repetition (the copy is excluded from the timing)
+template <typename Data, typename SortFun>
+static double timeSort(const lasd::SortableVector<Data>& input, SortFun sort) {
+    double best = -1.0;
+    for (int rep = 0; rep < 3; rep++) {
+        lasd::SortableVector<Data> vec(input);
+        double ms = measureMs([&] { sort(vec); }, 1);
+        doNotOptimize(vec.Front());
+        if (best < 0.0 || ms < best) best = ms;
+    }
+    return best;
+}
+
+// Compares Sort() (radix sort for arithmetic types) with the comparison-based
+// introsort of the generic path and with std::sort
+template <typename Data>
+static void benchSortType(const std::string& type, unsigned long elements) {
+    for (SortInput input : {SortInput::Random, SortInput::Skewed, SortInput::Ascending, SortInput::Descending}) {
+        lasd::SortableVector<Data> data(elements);
+        FillInput(data, input);
+        std::string name = SortInputName(input);
+
+        double ms = timeSort(data, [](lasd::SortableVector<Data>& vec) { vec.Sort(); });
+        printBenchResult("SortableVector<" + type + ">::Sort", "radix sort LSD, input " + name, ms, elements);
+
+        ms = timeSort(data, [](lasd::SortableVector<Data>& vec) { vec.lasd::SortableLinearContainer<Data>::Sort(); });
+        printBenchResult("SortableLinearContainer<" + type + ">::Sort", "introsort tramite operator[] virtuale, input " + name, ms, elements);
+
+        ms = timeSort(data, [](lasd::SortableVector<Data>& vec) { std::sort(vec.begin(), vec.end()); });
+        printBenchResult("std::sort", "riferimento, input " + name, ms, elements);
+    }
+}
+
+void benchSort() {
+    const unsigned long elements = scaled(10000000);
+
+    benchSortType<int>("int", elements);
+    benchSortType<long>("long", elements);
+    benchSortType<double>("double", elements);
+
+    // Linked lists: the nodes are relinked, never moved
+    const unsigned long nodes = scaled(5000000);
+    lasd::SortableVector<int> data(nodes);
+    FillInput(data, SortInput::Random);
+
+    double ms = timeSort(data, [](lasd::SortableVector<int>& vec) { std::sort(vec.begin(), vec.end()); });
+    printBenchResult("std::sort", "riferimento contiguo, input casuale", ms, nodes);
+
+    double best = -1.0;
+    for (int rep = 0; rep < 3; rep++) {
+        lasd::List<int> lst(data);
+        ms = measureMs([&] { lst.Sort(); }, 1);
+        doNotOptimize(lst.Front());
+        if (best < 0.0 || ms < best) best = ms;
+    }
+    printBenchResult("List<int>::Sort", "merge sort per ricollegamento dei nodi, input casuale", best, nodes);
+
+    best = -1.0;
+    for (int rep = 0; rep < 3; rep++) {
+        std::list<int> lst(data.begin(), data.end());
+        ms = measureMs([&] { lst.sort(); }, 1);
+        doNotOptimize(lst.front());
+        if (best < 0.0 || ms < best) best = ms;
+    }
+    printBenchResult("std::list::sort", "riferimento, input casuale", best, nodes);
+}
@@ -3,6 +3,7 @@
 #include <stdexcept>
 #include <limits>
 #include <algorithm>
+#include <ranges>
 #include "test.hpp"
 #include "../heap/vec/heapvec.hpp"
 
@@ -110,6 +111,17 @@ void testHeap() {
         }
     }
     printTestResult(isSorted, "HeapVec<int>::Sort", "Verifica ordinamento dopo Sort");
+
+    // ========== TEST REDUCE ==========
+
+    long foldSum = heap6.Fold<long>([](const int& x, const long& acc) { return acc + x; }, 0L);
+    long reduceSum = heap6.Reduce([](const int& x, long acc) { return acc + x; }, 0L);
+    printTestResult(foldSum == reduceSum, "HeapVec<int>::Reduce", "Verifica Reduce coerente con Fold");
+
+    // ========== TEST ITERATORI ==========
+
+    lasd::HeapVec<int> heapIter(heap2);
+    printTestResult(std::ranges::is_heap(heapIter) && *std::ranges::max_element(heapIter) == heapIter[0], "HeapVec<int>::begin/end", "Verifica proprieta' di heap tramite std::ranges::is_heap");
     
     // ========== TEST CON TIPI DIVERSI ==========
     
@@ -537,5 +549,15 @@ void testHeapStress() {
     printTestResult(move3.Size() == multiOpHeap.Size(), "HeapVec<int>::HeapVec(HeapVec &&)", "Movimento multiplo - verifica size finale");
     printTestResult(copy1.Empty() && move1.Empty() && move2.Empty(), "HeapVec<int>::HeapVec(HeapVec &&)", "Movimento multiplo - sorgenti vuote");
     
+    // Heap con comparatore invertito: min-heap e ordinamento decrescente
+    lasd::Vector<int> descVec(15);
+    for (ulong i = 0; i < descVec.Size(); i++) {
+        descVec[i] = static_cast<int>((i * 4) % 15);
+    }
+    lasd::HeapVec<int, std::allocator<int>, std::greater<int>> minHeap(descVec);
+    bool minHeapOk = minHeap.IsHeap() && minHeap[0] == 0;
+    minHeap.Sort();
+    printTestResult(minHeapOk && std::ranges::is_sorted(minHeap, std::greater<int>()), "HeapVec<int, greater>::Sort", "Verifica min-heap e ordinamento decrescente");
+
     std::cout << "=== Fine test Heap - Stress e Performance ===" << std::endl;
 }
@@ -1,10 +1,21 @@
 #include "test.hpp"
 #include "../list/list.hpp"
 #include "../vector/vector.hpp" // For testing constructor from TraversableContainer
+#include "../allocator/arena.hpp"
+#include "../allocator/pool.hpp"
 #include <iostream>
 #include <string>      // For std::to_string and lasd::List<std::string>
 #include <stdexcept>   // For std::length_error and std::out_of_range
 #include <functional>  // For std::function in Fold
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+static_assert(std::forward_iterator<lasd::List<int>::iterator>);
+static_assert(std::forward_iterator<lasd::List<int>::const_iterator>);
+static_assert(std::ranges::forward_range<const lasd::List<int>>);
 
 // void testList(); // Declaration is in test.hpp
 
@@ -381,6 +392,28 @@ void testList() {
         initial_acc_val // Passa l'accumulatore iniziale direttamente
     );
     printTestResult(sum_fold_val == 109, "List<int>::Fold", "Test Fold per somma elementi con valore iniziale (100+1+3+5=109)");
+
+    // Test Reduce, ForEach e ForEachMut (su {1,3,5})
+    printTestResult(l16.Reduce([](const int& dat, int acc_val) { return acc_val * 10 + dat; }, 0) == 135, "List<int>::Reduce", "Test Reduce nell'ordine della lista (135)");
+    lasd::List<int> l16Copy(l16);
+    l16Copy.ForEachMut([](int& dat) { dat *= 2; });
+    result_traverse = "";
+    l16Copy.ForEach([&result_traverse](const int& value) { result_traverse += std::to_string(value) + " "; });
+    printTestResult(result_traverse == "2 6 10 ", "List<int>::ForEachMut", "Test ForEachMut e ForEach (2 6 10 )");
+
+    // Test iteratori (su {2,6,10})
+    for (int& dat : l16Copy) {
+        dat += 1;
+    }
+    result_traverse = "";
+    for (const int& dat : std::as_const(l16Copy)) {
+        result_traverse += std::to_string(dat) + " ";
+    }
+    printTestResult(result_traverse == "3 7 11 ", "List<int>::begin/end", "Test range-for mutabile e costante (3 7 11 )");
+    auto found = std::ranges::find(l16Copy, 7);
+    lasd::List<int>::const_iterator foundConst = found;
+    printTestResult(found != l16Copy.end() && *foundConst == 7 && std::ranges::distance(l16Copy) == 3, "List<int>::iterator", "Test std::ranges::find e conversione a const_iterator");
+    printTestResult(lasd::List<int>().begin() == lasd::List<int>().end(), "List<int>::begin/end", "Test iteratori su lista vuota");
     
     // Test Insert, InsertAll, Remove, RemoveAll (Dictionary)
     std::cout << "\n=== Test funzioni Dictionary ===" << std::endl;
@@ -459,5 +492,198 @@ void testList() {
     printTestResult(!l18.Exists(100) && !l18.Exists(300), "List<int>::Exists", "Test elementi rimossi dopo RemoveSome");
     printTestResult(l18.Exists(200) && l18.Exists(400), "List<int>::Exists", "Test elementi rimasti dopo RemoveSome");
 
+    // Test pool di nodi
+    std::cout << "\n=== Test pool di nodi ===" << std::endl;
+    {
+        lasd::List<int> l23;
+        for (int round = 0; round < 3; round++) {
+            for (int i = 0; i < 1000; i++) {
+                l23.InsertAtBack(i);
+            }
+            l23.Clear();
+        }
+        for (int i = 0; i < 1000; i++) {
+            l23.InsertAtFront(i);
+        }
+        for (int i = 0; i < 500; i++) {
+            l23.RemoveFromFront();
+            l23.InsertAtBack(-i);
+        }
+        printTestResult(l23.Size() == 1000 && l23.Front() == 499 && l23.Back() == -499, "List<int>::Clear", "Test riuso dei nodi dopo Clear e rimozioni");
+
+        lasd::List<int> l24(std::move(l23));
+        l23.InsertAtBack(7);
+        l24.RemoveFromFront();
+        printTestResult(l24.Size() == 999 && l24.Front() == 498 && l23.Size() == 1 && l23.Front() == 7, "List<int>::List(List&&)", "Test spostamento del pool con i nodi");
+
+        lasd::List<std::string> l25;
+        l25.InsertAtBack("a");
+        l25.InsertAtBack("b");
+        lasd::List<std::string> l26;
+        l26.InsertAtBack("c");
+        l26 = std::move(l25);
+        l25.InsertAtBack("d");
+        printTestResult(l26.Size() == 2 && l26.Back() == "b" && l25.Size() == 2 && l25.Front() == "c" && l25.Back() == "d", "List<string>::operator=(List&&)", "Test scambio dei pool nell'assegnamento per spostamento");
+    }
+
+    // Test attraversamento con uscita anticipata
+    std::cout << "\n=== Test attraversamento con uscita anticipata ===" << std::endl;
+    {
+        lasd::List<int> l31;
+        for (int i = 1; i <= 1000; i++) {
+            l31.InsertAtBack(i);
+        }
+        int visited = 0;
+        bool complete = l31.TraverseWhile([&visited](const int& value) { visited++; return value < 10; });
+        int visitedBack = 0;
+        bool completeBack = l31.PostOrderTraverseWhile([&visitedBack](const int& value) { visitedBack++; return value > 991; });
+        printTestResult(!complete && visited == 10 && !completeBack && visitedBack == 10 && l31.PreOrderTraverseWhile([](const int& value) { return value > 0; }),
+                        "List<int>::TraverseWhile", "Test arresto al primo false in entrambi i versi");
+
+        visited = 0;
+        bool any = l31.Any([&visited](const int& value) { visited++; return value % 7 == 0; });
+        bool all = l31.All([](const int& value) { return value <= 1000; });
+        printTestResult(any && visited == 7 && all && !l31.Any([](const int& value) { return value > 1000; }), "List<int>::Any/All", "Test predicati con uscita anticipata");
+
+        const int* found = l31.FindFirst([](const int& value) { return value * value > 500; });
+        printTestResult(found != nullptr && *found == 23 && found == &l31[22] && l31.FindFirst([](const int& value) { return value < 0; }) == nullptr,
+                        "List<int>::FindFirst", "Test ricerca del primo elemento che soddisfa il predicato");
+    }
+
+    // Test ordinamento
+    std::cout << "\n=== Test ordinamento ===" << std::endl;
+    {
+        lasd::List<int> l27;
+        l27.Sort();
+        l27.InsertAtBack(5);
+        l27.Sort();
+        printTestResult(l27.Size() == 1 && l27.Front() == 5 && l27.Back() == 5, "List<int>::Sort", "Test ordinamento di lista vuota e con un elemento");
+
+        lasd::List<int> l28;
+        unsigned int state = 12345u;
+        for (int i = 0; i < 1000; i++) {
+            state = state * 1103515245u + 12345u;
+            l28.InsertAtBack(static_cast<int>((state >> 16) % 100));
+        }
+        int* tracked = &l28.Front();
+        int trackedValue = *tracked;
+        l28.Sort();
+        bool found = false;
+        for (const int& value : l28) {
+            found = found || &value == tracked;
+        }
+        printTestResult(std::is_sorted(l28.begin(), l28.end()) && l28.Size() == 1000 && found && *tracked == trackedValue, "List<int>::Sort", "Test ordinamento casuale senza spostare gli elementi");
+
+        l28.InsertAtBack(-1);
+        printTestResult(l28.Back() == -1 && l28.Size() == 1001, "List<int>::Sort", "Test coda aggiornata dopo l'ordinamento");
+
+        lasd::List<int> l29;
+        for (int i = 100; i > 0; i--) {
+            l29.InsertAtBack(i);
+        }
+        l29.Sort();
+        printTestResult(l29.Front() == 1 && l29.Back() == 100 && l29[49] == 50, "List<int>::Sort", "Test ordinamento di lista inversa");
+
+        // Keys compared on the first component only: the second one records the insertion order
+        struct Keyed {
+            int key;
+            int order;
+            bool operator<(const Keyed& other) const { return key < other.key; }
+            bool operator==(const Keyed& other) const { return key == other.key && order == other.order; }
+        };
+        lasd::List<Keyed> l30;
+        for (int i = 0; i < 300; i++) {
+            l30.InsertAtBack(Keyed{(i * 7) % 5, i});
+        }
+        l30.Sort();
+        bool stable = true;
+        const Keyed* previous = nullptr;
+        for (const Keyed& item : l30) {
+            if (previous != nullptr && (item.key < previous->key || (item.key == previous->key && item.order < previous->order))) {
+                stable = false;
+            }
+            previous = &item;
+        }
+        printTestResult(stable && l30.Size() == 300, "List<Keyed>::Sort", "Test stabilita' dell'ordinamento");
+
+        // Comparison that throws once its budget is exhausted: the list must keep every element
+        struct Fragile {
+            int key;
+            long* budget;
+            bool operator<(const Fragile& other) const {
+                if (--*budget < 0) {
+                    throw std::runtime_error("comparison failed");
+                }
+                return key < other.key;
+            }
+            bool operator==(const Fragile& other) const { return key == other.key; }
+        };
+        bool intact = true;
+        for (long limit : {0L, 1L, 17L, 250L, 700L, 1000L}) {
+            long budget = 1L << 40;
+            lasd::List<Fragile> l31;
+            for (int i = 0; i < 200; i++) {
+                l31.InsertAtBack(Fragile{(i * 37) % 200, &budget});
+            }
+            budget = limit;
+            bool thrown = false;
+            try {
+                l31.Sort();
+            } catch (const std::runtime_error&) {
+                thrown = true;
+            }
+            std::vector<int> keys;
+            for (const Fragile& item : l31) {
+                keys.push_back(item.key);
+            }
+            std::sort(keys.begin(), keys.end());
+            bool complete = keys.size() == 200 && l31.Size() == 200;
+            for (int i = 0; i < static_cast<int>(keys.size()); i++) {
+                complete = complete && keys[i] == i;
+            }
+            const Fragile* last = nullptr;
+            for (const Fragile& item : l31) {
+                last = &item;
+            }
+            intact = intact && thrown && complete && last == &l31.Back();
+        }
+        printTestResult(intact, "List<Fragile>::Sort", "Test elementi conservati se il confronto lancia un'eccezione");
+    }
+
+    // Test allocatori
+    std::cout << "\n=== Test allocatori ===" << std::endl;
+    {
+        lasd::MonotonicArena arena;
+        lasd::List<int, lasd::ArenaAllocator<int>> l19{lasd::ArenaAllocator<int>(arena)};
+        for (int i = 0; i < 100; i++) {
+            l19.InsertAtBack(i);
+        }
+        printTestResult(l19.Size() == 100 && l19.Back() == 99 && arena.Allocated() > 0, "List<int, ArenaAllocator>::InsertAtBack", "Test nodi allocati dall'arena");
+
+        lasd::List<int, lasd::ArenaAllocator<int>> l20(l19);
+        l19.Clear();
+        printTestResult(l20.Size() == 100 && l20[50] == 50, "List<int, ArenaAllocator>::List(const List&)", "Test copia con allocatore ad arena");
+    }
+    {
+        lasd::PoolResource pool;
+        lasd::List<std::string, lasd::PoolAllocator<std::string>> l21{lasd::PoolAllocator<std::string>(pool)};
+        for (int i = 0; i < 100; i++) {
+            l21.InsertAtFront(std::to_string(i));
+        }
+        for (int i = 0; i < 50; i++) {
+            l21.RemoveFromFront();
+        }
+        for (int i = 0; i < 50; i++) {
+            l21.InsertAtBack("x" + std::to_string(i));
+        }
+        printTestResult(l21.Size() == 100 && l21.Front() == "49" && l21.Back() == "x49", "List<string, PoolAllocator>::RemoveFromFront", "Test riuso dei nodi del pool");
+
+        lasd::PoolResource otherPool;
+        lasd::List<std::string, lasd::PoolAllocator<std::string>> l22{lasd::PoolAllocator<std::string>(otherPool)};
+        l22.InsertAtBack("old");
+        l22 = l21;
+        printTestResult(l22 == l21 && &l22.GetAllocator().Resource() == &pool, "List<string, PoolAllocator>::operator=(const List&)", "Test propagazione dell'allocatore nella copia");
+    }
+
     std::cout << "=== Fine test List ===" << std::endl;
 }
\ No newline at end of file
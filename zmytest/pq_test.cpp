@@ -5,6 +5,7 @@
 #include <limits>
 #include "test.hpp"
 #include "../pq/heap/pqheap.hpp"
+#include "../allocator/arena.hpp"
 
 void testPriorityQueue() {
     std::cout << "\n=== Inizio test Priority Queue ===" << std::endl;
@@ -407,6 +408,18 @@ void testPriorityQueue() {
     printTestResult(firstRemoved > secondRemoved, "PQHeap<int>::TipNRemove", "Verifica ordine rimozione in PQ grande");
     printTestResult(largePQ.Size() == largeSize - 2, "PQHeap<int>::Size", "Verifica size dopo rimozioni in PQ grande");
     
+    // ========== TEST ALLOCATORE AD ARENA ==========
+
+    {
+        lasd::MonotonicArena arena;
+        lasd::PQHeap<int, lasd::ArenaAllocator<int>> arenaPQ{lasd::ArenaAllocator<int>(arena)};
+        for (int i = 0; i < 500; i++) {
+            arenaPQ.Insert((i * 7) % 500);
+        }
+        int top = arenaPQ.TipNRemove();
+        printTestResult(top == 499 && arenaPQ.Tip() == 498 && arenaPQ.Size() == 499, "PQHeap<int, ArenaAllocator>::Insert", "Verifica PQ con memoria dall'arena");
+    }
+
     // ========== CHIAMATA AI TEST AGGIUNTIVI ==========
     
     // Esegui i test per casi limite con tipi diversi
@@ -664,5 +677,25 @@ void testPriorityQueueStressAndPerformance() {
     
     printTestResult(strictlyDecreasingPQ.Tip() == 5, "PQHeap<int>::Tip", "Verifica Tip con sequenza strettamente decrescente");
     
+    // Coda a priorita minima tramite comparatore
+    lasd::Vector<int> minVec(20);
+    for (ulong i = 0; i < minVec.Size(); i++) {
+        minVec[i] = static_cast<int>((i * 7) % 20) + 10;
+    }
+    lasd::PQHeap<int, std::allocator<int>, std::greater<int>> minPQ(minVec);
+    printTestResult(minPQ.Tip() == 10, "PQHeap<int, greater>::Tip", "Verifica Tip come minimo");
+
+    minPQ.Change(15, 1);
+    minPQ.Change(10, 50);
+    minPQ.Insert(5);
+    bool ascending = minPQ.TipNRemove() == 1 && minPQ.TipNRemove() == 5;
+    int previous = 0;
+    while (ascending && !minPQ.Empty()) {
+        int current = minPQ.TipNRemove();
+        ascending = current > previous;
+        previous = current;
+    }
+    printTestResult(ascending && previous == 50, "PQHeap<int, greater>::Change/TipNRemove", "Verifica estrazione crescente con Change");
+
     std::cout << "=== Fine test Priority Queue - Stress e Performance ===" << std::endl;
 }
@@ -0,0 +1,222 @@
+#include "test.hpp"
+#include "../set/btree/setbtree.hpp"
+#include "../vector/vector.hpp" // For constructing SetBTree from Vector
+#include "../list/list.hpp"     // For constructing SetBTree from List
+#include "../allocator/pool.hpp"
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <vector>
+#include <algorithm>
+#include <ranges>
+#include <random>
+#include <set>
+#include <memory_resource>
+#include <type_traits>
+
+static_assert(std::is_nothrow_move_assignable_v<lasd::SetBTree<int>>);
+static_assert(!std::is_nothrow_move_assignable_v<lasd::SetBTree<int, std::pmr::polymorphic_allocator<int>>>);
+
+// Confronta un SetBTree con un std::set di riferimento: elementi in ordine,
+// accesso per indice, visita inversa, minimo e massimo
+template <typename Tree, typename Reference>
+static bool MatchesReference(const Tree& tree, const Reference& reference) {
+    if (tree.Size() != reference.size() || !std::ranges::equal(tree, reference)) {
+        return false;
+    }
+    ulong index = 0;
+    for (const auto& item : reference) {
+        if (!(tree[index++] == item)) {
+            return false;
+        }
+    }
+    std::vector<typename Reference::value_type> backward;
+    tree.PostOrderTraverse([&backward](const auto& item) { backward.push_back(item); });
+    if (!std::ranges::equal(backward, reference | std::views::reverse)) {
+        return false;
+    }
+    return reference.empty() || (tree.Min() == *reference.begin() && tree.Max() == *reference.rbegin());
+}
+
+void testSetBTree() {
+    std::cout << "\n=== Inizio test SetBTree ===" << std::endl;
+
+    // ========== TEST COSTRUTTORI E OPERAZIONI DI BASE ==========
+
+    lasd::SetBTree<int> s1;
+    printTestResult(s1.Empty() && s1.Size() == 0 && s1.begin() == s1.end(), "SetBTree<int>::Empty", "Verifica set vuoto dopo costruttore default");
+
+    bool inserted = s1.Insert(10) && s1.Insert(30) && s1.Insert(20);
+    printTestResult(inserted && s1.Size() == 3 && s1.Exists(20) && !s1.Exists(15), "SetBTree<int>::Insert/Exists", "Verifica inserimenti e ricerca");
+    printTestResult(!s1.Insert(10) && s1.Size() == 3, "SetBTree<int>::Insert", "Verifica rifiuto del duplicato");
+    printTestResult(s1.Remove(20) && !s1.Remove(25) && s1.Size() == 2 && !s1.Exists(20), "SetBTree<int>::Remove", "Verifica rimozione esistente e non esistente");
+    printTestResult(s1.Front() == 10 && s1.Back() == 30 && s1[1] == 30, "SetBTree<int>::Front/Back/operator[]", "Verifica accesso agli estremi e per indice");
+
+    bool emptyThrows = true;
+    lasd::SetBTree<int> empty;
+    try { empty.Min(); emptyThrows = false; } catch (const std::length_error&) {}
+    try { empty.RemoveMax(); emptyThrows = false; } catch (const std::length_error&) {}
+    try { empty.Predecessor(1); emptyThrows = false; } catch (const std::length_error&) {}
+    try { s1[2]; emptyThrows = false; } catch (const std::out_of_range&) {}
+    printTestResult(emptyThrows, "SetBTree<int>::Min/RemoveMax/Predecessor/operator[]", "Verifica eccezioni su set vuoto e indice non valido");
+
+    // Costruzione da altri contenitori
+    lasd::Vector<int> vec(6);
+    for (ulong i = 0; i < 6; ++i) { vec[i] = static_cast<int>((i * 7) % 5); }
+    lasd::SetBTree<int> fromVec(vec);
+    printTestResult(fromVec.Size() == 5 && fromVec.Min() == 0 && fromVec.Max() == 4, "SetBTree<int>::SetBTree(Vector)", "Verifica costruzione da Vector senza duplicati");
+    lasd::List<int> lst;
+    lst.InsertAtBack(3);
+    lst.InsertAtBack(1);
+    lasd::SetBTree<int> fromList(std::move(lst));
+    printTestResult(fromList.Size() == 2 && fromList[0] == 1 && lst.Empty(), "SetBTree<int>::SetBTree(List&&)", "Verifica costruzione per spostamento da List");
+
+    // ========== TEST DIVISIONI E FUSIONI ==========
+    {
+        std::cout << "\n--- Test divisioni e fusioni dei nodi ---" << std::endl;
+
+        // Nodi da 4 posizioni: pochi elementi bastano a far crescere l'albero di molti livelli
+        using SmallTree = lasd::SetBTree<int, std::allocator<int>, std::less<int>, 4>;
+        SmallTree ascending;
+        std::set<int> reference;
+        for (int i = 0; i < 500; ++i) { ascending.Insert(i); reference.insert(i); }
+        printTestResult(MatchesReference(ascending, reference), "SetBTree<int, 4>::Insert", "Verifica inserimenti crescenti con divisioni fino alla radice");
+
+        bool neighbours = ascending.Predecessor(100) == 99 && ascending.Successor(100) == 101 && ascending.Successor(-5) == 0 && ascending.Predecessor(1000) == 499;
+        printTestResult(neighbours, "SetBTree<int, 4>::Predecessor/Successor", "Verifica vicini attraverso i confini delle foglie");
+
+        for (int i = 0; i < 500; i += 2) { ascending.Remove(i); reference.erase(i); }
+        printTestResult(MatchesReference(ascending, reference), "SetBTree<int, 4>::Remove", "Verifica rimozioni alternate con prestiti e fusioni");
+
+        while (ascending.Size() > 1) { ascending.RemoveMax(); }
+        printTestResult(ascending.Size() == 1 && ascending.Min() == 1 && ascending.Max() == 1, "SetBTree<int, 4>::RemoveMax", "Verifica riduzione dell'altezza fino a una foglia");
+        ascending.RemoveMin();
+        printTestResult(ascending.Empty() && ascending.begin() == ascending.end() && ascending.Insert(7) && ascending.Min() == 7,
+                        "SetBTree<int, 4>::RemoveMin", "Verifica svuotamento e riuso");
+
+        // Sequenza casuale confrontata con std::set, con controlli periodici completi
+        std::mt19937 gen(2024);
+        std::uniform_int_distribution<int> dist(0, 2000);
+        SmallTree tree;
+        std::set<int> model;
+        bool agree = true, consistent = true;
+        for (int step = 0; step < 20000; ++step) {
+            int value = dist(gen);
+            switch (gen() % 4) {
+                case 0: case 1:
+                    agree = agree && (tree.Insert(value) == model.insert(value).second);
+                    break;
+                case 2:
+                    agree = agree && (tree.Remove(value) == (model.erase(value) == 1));
+                    break;
+                default:
+                    agree = agree && (tree.Exists(value) == (model.count(value) == 1));
+                    break;
+            }
+            if (step % 1000 == 999) { consistent = consistent && MatchesReference(tree, model); }
+        }
+        printTestResult(agree && consistent, "SetBTree<int, 4>::Insert/Remove/Exists", "Verifica sequenza casuale rispetto a std::set");
+
+        bool neighboursAgree = true;
+        for (int probe = -1; probe <= 2001; probe += 7) {
+            auto after = model.upper_bound(probe);
+            auto before = model.lower_bound(probe);
+            try {
+                int found = tree.Successor(probe);
+                neighboursAgree = neighboursAgree && after != model.end() && found == *after;
+            } catch (const std::length_error&) { neighboursAgree = neighboursAgree && after == model.end(); }
+            try {
+                int found = tree.Predecessor(probe);
+                neighboursAgree = neighboursAgree && before != model.begin() && found == *std::prev(before);
+            } catch (const std::length_error&) { neighboursAgree = neighboursAgree && before == model.begin(); }
+        }
+        printTestResult(neighboursAgree, "SetBTree<int, 4>::Predecessor/Successor", "Verifica vicini rispetto a std::set");
+
+        int median = tree[tree.Size() / 2];
+        int successor = tree.SuccessorNRemove(median);
+        int predecessor = tree.PredecessorNRemove(median);
+        model.erase(successor);
+        model.erase(predecessor);
+        printTestResult(successor > median && predecessor < median && MatchesReference(tree, model),
+                        "SetBTree<int, 4>::SuccessorNRemove/PredecessorNRemove", "Verifica rimozione dei vicini");
+
+        // Svuotamento dai due estremi
+        bool drained = true;
+        while (!model.empty()) {
+            int min = tree.MinNRemove();
+            drained = drained && min == *model.begin();
+            model.erase(model.begin());
+            if (!model.empty()) {
+                int max = tree.MaxNRemove();
+                drained = drained && max == *model.rbegin();
+                model.erase(std::prev(model.end()));
+            }
+        }
+        printTestResult(drained && tree.Empty(), "SetBTree<int, 4>::MinNRemove/MaxNRemove", "Verifica svuotamento alternato dagli estremi");
+    }
+
+    // ========== TEST COPIA, SPOSTAMENTO E CONFRONTO ==========
+    {
+        std::cout << "\n--- Test copia e spostamento ---" << std::endl;
+
+        lasd::SetBTree<int> big;
+        for (int i = 0; i < 10000; ++i) { big.Insert((i * 7919) % 10007); }
+        lasd::SetBTree<int> copy(big);
+        printTestResult(copy == big && copy.Size() == 10000 && std::ranges::is_sorted(copy), "SetBTree<int>::SetBTree(const&)", "Verifica copia profonda");
+        copy.Remove(5);
+        printTestResult(copy != big && big.Exists(5), "SetBTree<int>::operator!=", "Verifica indipendenza della copia");
+
+        lasd::SetBTree<int> moved(std::move(copy));
+        printTestResult(copy.Empty() && moved.Size() == 9999 && !moved.Exists(5), "SetBTree<int>::SetBTree(&&)", "Verifica costruttore di spostamento");
+
+        lasd::SetBTree<int> assigned;
+        assigned.Insert(-1);
+        assigned = big;
+        bool copyAssigned = assigned == big && !assigned.Exists(-1);
+        assigned = std::move(moved);
+        printTestResult(copyAssigned && assigned.Size() == 9999 && assigned[0] == 0, "SetBTree<int>::operator=", "Verifica assegnamento per copia e spostamento");
+
+        lasd::Vector<int> batch(3);
+        batch[0] = 5; batch[1] = 20000; batch[2] = 6;
+        bool bulk = !assigned.InsertAll(batch) && assigned.Exists(5) && assigned.Exists(20000) && assigned.RemoveAll(batch)
+                    && !assigned.RemoveSome(batch) && assigned.InsertSome(batch) && assigned.Size() == 10001;
+        printTestResult(bulk, "SetBTree<int>::InsertAll/RemoveAll/InsertSome/RemoveSome", "Verifica operazioni in blocco");
+
+        int sum = big.Fold<int>([](const int& item, const int& acc) { return acc + (item & 1); }, 0);
+        bool stopped = !big.TraverseWhile([](const int& item) { return item < 100; }) && big.PostOrderTraverseWhile([](const int& item) { return item >= 0; });
+        printTestResult(sum == 5000 && stopped, "SetBTree<int>::Fold/TraverseWhile", "Verifica visite sulla lista delle foglie");
+    }
+
+    // ========== TEST TIPI E POLITICHE ==========
+    {
+        std::cout << "\n--- Test stringhe, comparatore e allocatore ---" << std::endl;
+
+        lasd::SetBTree<std::string, std::allocator<std::string>, std::less<std::string>, 4> words;
+        std::set<std::string> wordModel;
+        for (int i = 0; i < 300; ++i) {
+            std::string word = "parola-lunga-abbastanza-da-allocare-" + std::to_string((i * 31) % 211);
+            words.Insert(word);
+            wordModel.insert(word);
+        }
+        for (int i = 0; i < 211; i += 3) {
+            std::string word = "parola-lunga-abbastanza-da-allocare-" + std::to_string(i);
+            words.Remove(word);
+            wordModel.erase(word);
+        }
+        printTestResult(MatchesReference(words, wordModel), "SetBTree<string, 4>::Insert/Remove", "Verifica stringhe con divisioni e fusioni");
+
+        using DescTree = lasd::SetBTree<int, std::allocator<int>, std::greater<int>, 6>;
+        DescTree desc;
+        for (int i = 0; i < 200; ++i) { desc.Insert((i * 37) % 151); }
+        bool descOrder = std::ranges::is_sorted(desc, std::greater<int>()) && desc.Min() == 150 && desc.Max() == 0
+                         && desc.Predecessor(30) == 31 && desc.Successor(30) == 29;
+        printTestResult(descOrder, "SetBTree<int, greater>::Insert", "Verifica ordine decrescente e vicini");
+
+        lasd::PoolResource pool;
+        lasd::SetBTree<int, lasd::PoolAllocator<int>> pooled{lasd::PoolAllocator<int>(pool)};
+        for (int i = 0; i < 3000; ++i) { pooled.Insert(i); }
+        for (int i = 0; i < 3000; i += 3) { pooled.Remove(i); }
+        lasd::SetBTree<int, lasd::PoolAllocator<int>> pooledCopy(pooled);
+        printTestResult(pooledCopy == pooled && pooledCopy.Size() == 2000 && pooledCopy[0] == 1, "SetBTree<int, PoolAllocator>::Insert", "Verifica nodi dal pool");
+    }
+}
@@ -0,0 +1,201 @@
+#include "test.hpp"
+#include "../set/hash/sethash.hpp"
+#include "../vector/vector.hpp" // For constructing SetHash from Vector
+#include "../list/list.hpp"     // For constructing SetHash from List
+#include "../allocator/pool.hpp"
+#include "../simd/simd.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cctype>
+#include <random>
+#include <unordered_set>
+#include <memory_resource>
+#include <type_traits>
+
+static_assert(std::is_nothrow_move_assignable_v<lasd::SetHash<int>>);
+static_assert(!std::is_nothrow_move_assignable_v<lasd::SetHash<int, std::pmr::polymorphic_allocator<int>>>);
+
+// Elementi di un SetHash in ordine crescente, per confrontarli con un riferimento
+template <typename Table>
+static std::vector<int> SortedContents(const Table& table) {
+    std::vector<int> items;
+    table.Traverse([&items](const int& item) { items.push_back(item); });
+    std::sort(items.begin(), items.end());
+    return items;
+}
+
+// Sequenza casuale di inserimenti, rimozioni e ricerche confrontata con std::unordered_set
+template <typename Table>
+static bool MatchesRandomOps(Table& table, unsigned seed, int range, int steps) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, range);
+    std::unordered_set<int> model;
+    bool agree = true;
+    for (int step = 0; step < steps; ++step) {
+        int value = dist(gen);
+        switch (gen() % 4) {
+            case 0: case 1:
+                agree = agree && (table.Insert(value) == model.insert(value).second);
+                break;
+            case 2:
+                agree = agree && (table.Remove(value) == (model.erase(value) == 1));
+                break;
+            default:
+                agree = agree && (table.Exists(value) == (model.count(value) == 1));
+                break;
+        }
+    }
+    std::vector<int> expected(model.begin(), model.end());
+    std::sort(expected.begin(), expected.end());
+    return agree && table.Size() == model.size() && SortedContents(table) == expected;
+}
+
+// Hash pessimo: tutti gli elementi nella stessa sequenza di scansione, che fa il giro della tabella
+struct ConstantHash {
+    std::size_t operator()(int) const noexcept { return 42; }
+};
+
+// Hash e uguaglianza che ignorano maiuscole e minuscole
+struct CaseInsensitiveHash {
+    std::size_t operator()(const std::string& text) const noexcept {
+        std::string lower(text);
+        for (char& c : lower) { c = static_cast<char>(std::tolower(static_cast<unsigned char>(c))); }
+        return std::hash<std::string>()(lower);
+    }
+};
+
+struct CaseInsensitiveEqual {
+    bool operator()(const std::string& a, const std::string& b) const noexcept {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+            return std::tolower(static_cast<unsigned char>(x)) == std::tolower(static_cast<unsigned char>(y));
+        });
+    }
+};
+
+void testSetHash() {
+    std::cout << "\n=== Inizio test SetHash ===" << std::endl;
+
+    // ========== TEST COSTRUTTORI E OPERAZIONI DI BASE ==========
+
+    lasd::SetHash<int> h1;
+    printTestResult(h1.Empty() && h1.Capacity() == 0 && !h1.Exists(0) && !h1.Remove(0), "SetHash<int>::Empty", "Verifica set vuoto senza tabella");
+
+    bool inserted = h1.Insert(10) && h1.Insert(20) && h1.Insert(30);
+    printTestResult(inserted && h1.Size() == 3 && h1.Exists(20) && !h1.Exists(25), "SetHash<int>::Insert/Exists", "Verifica inserimenti e ricerca");
+    printTestResult(!h1.Insert(10) && h1.Size() == 3, "SetHash<int>::Insert", "Verifica rifiuto del duplicato");
+    printTestResult(h1.Remove(20) && !h1.Remove(20) && h1.Size() == 2 && !h1.Exists(20) && h1.Exists(10) && h1.Exists(30),
+                    "SetHash<int>::Remove", "Verifica rimozione esistente e ripetuta");
+
+    lasd::Vector<int> vec(8);
+    for (ulong i = 0; i < 8; ++i) { vec[i] = static_cast<int>(i % 5); }
+    lasd::SetHash<int> fromVec(vec);
+    printTestResult(fromVec.Size() == 5 && fromVec.Exists(4) && !fromVec.Exists(5), "SetHash<int>::SetHash(Vector)", "Verifica costruzione da Vector senza duplicati");
+    lasd::List<int> lst;
+    lst.InsertAtBack(7);
+    lst.InsertAtBack(9);
+    lasd::SetHash<int> fromList(std::move(lst));
+    printTestResult(fromList.Size() == 2 && fromList.Exists(9) && lst.Empty(), "SetHash<int>::SetHash(List&&)", "Verifica costruzione per spostamento da List");
+
+    // ========== TEST CONTRO std::unordered_set ==========
+    {
+        std::cout << "\n--- Test confronto con std::unordered_set ---" << std::endl;
+
+        lasd::SetHash<int> table;
+        printTestResult(MatchesRandomOps(table, 7, 5000, 60000), "SetHash<int>::Insert/Remove/Exists", "Verifica sequenza casuale rispetto a std::unordered_set");
+
+        // Le rimozioni non lasciano marcatori: dopo molti cicli la tabella non cresce
+        lasd::SetHash<int> churn;
+        churn.Reserve(1000);
+        ulong reserved = churn.Capacity();
+        bool churnOk = true;
+        for (int round = 0; round < 50; ++round) {
+            for (int i = 0; i < 1000; ++i) { churnOk = churnOk && churn.Insert(round * 1000 + i); }
+            for (int i = 0; i < 1000; ++i) { churnOk = churnOk && churn.Remove(round * 1000 + i); }
+        }
+        printTestResult(churnOk && churn.Empty() && churn.Capacity() == reserved, "SetHash<int>::Remove", "Verifica cicli di inserimento e rimozione senza crescita della tabella");
+
+        // Tutti gli elementi nella stessa sequenza: spostamenti all'indietro attraverso la fine della tabella
+        lasd::SetHash<int, std::allocator<int>, ConstantHash> collisions;
+        printTestResult(MatchesRandomOps(collisions, 11, 300, 3000), "SetHash<int, ConstantHash>::Remove", "Verifica spostamento all'indietro con collisioni totali");
+
+        // Stessi risultati con il confronto dei gruppi scalare e vettoriale
+        bool allLevels = true;
+        for (lasd::simd::Level level : {lasd::simd::Level::Scalar, lasd::simd::Level::Vector128, lasd::simd::Level::Vector256}) {
+            lasd::simd::SetLevel(level);
+            lasd::SetHash<int> leveled;
+            allLevels = allLevels && MatchesRandomOps(leveled, 13, 2000, 20000);
+        }
+        lasd::simd::SetLevel(lasd::simd::SupportedLevel());
+        unsigned char group[lasd::simd::GroupWidth] = {};
+        group[3] = group[15] = 0x80;
+        printTestResult(allLevels && lasd::simd::MatchByte(group, 0x80) == ((1U << 3) | (1U << 15)) && lasd::simd::MatchByte(group, 0) == 0x7FF7,
+                        "SetHash<int>::Exists (simd::MatchByte)", "Verifica del confronto dei gruppi su ogni livello");
+    }
+
+    // ========== TEST CAPACITA', COPIA E OPERAZIONI IN BLOCCO ==========
+    {
+        std::cout << "\n--- Test capacita' e copia ---" << std::endl;
+
+        lasd::SetHash<int> reserved;
+        reserved.Reserve(1000);
+        ulong capacity = reserved.Capacity();
+        for (int i = 0; i < 1000; ++i) { reserved.Insert(i * 3); }
+        printTestResult(capacity >= 1000 + 1000 / 7 && reserved.Capacity() == capacity, "SetHash<int>::Reserve", "Verifica inserimenti senza ridimensionamento dopo Reserve");
+
+        for (int i = 0; i < 1000; i += 2) { reserved.Remove(i * 3); }
+        reserved.ShrinkToFit();
+        bool shrunk = reserved.Capacity() < capacity && reserved.Size() == 500 && reserved.Exists(3) && !reserved.Exists(6);
+        printTestResult(shrunk, "SetHash<int>::ShrinkToFit", "Verifica riduzione della tabella");
+
+        lasd::SetHash<int> copy(reserved);
+        printTestResult(copy == reserved && copy.Capacity() == reserved.Capacity(), "SetHash<int>::SetHash(const&)", "Verifica copia della tabella");
+        copy.Remove(3);
+        lasd::SetHash<int> other;
+        for (int i = 999; i >= 0; i -= 2) { other.Insert(i * 3); }
+        printTestResult(copy != reserved && other == reserved && reserved.Exists(3), "SetHash<int>::operator==", "Verifica uguaglianza indipendente dalla posizione");
+
+        lasd::SetHash<int> moved(std::move(copy));
+        lasd::SetHash<int> assigned;
+        assigned.Insert(-1);
+        assigned = reserved;
+        bool copyAssigned = assigned == reserved && !assigned.Exists(-1);
+        assigned = std::move(moved);
+        printTestResult(copy.Empty() && copyAssigned && assigned.Size() == 499 && !assigned.Exists(3), "SetHash<int>::operator=", "Verifica assegnamento per copia e spostamento");
+
+        lasd::Vector<int> batch(3);
+        batch[0] = 3; batch[1] = 100000; batch[2] = 9;
+        bool bulk = !assigned.InsertAll(batch) && assigned.Exists(3) && assigned.RemoveAll(batch)
+                    && !assigned.RemoveSome(batch) && assigned.InsertSome(batch) && assigned.Size() == 501;
+        int odd = assigned.Fold<int>([](const int& item, const int& acc) { return acc + (item & 1); }, 0);
+        printTestResult(bulk && odd == 500 && !assigned.TraverseWhile([](const int& item) { return item != 100000; }),
+                        "SetHash<int>::InsertAll/RemoveAll/InsertSome/RemoveSome", "Verifica operazioni in blocco e visite");
+
+        assigned.Clear();
+        printTestResult(assigned.Empty() && assigned.Capacity() == 0 && assigned.Insert(5) && assigned.Exists(5), "SetHash<int>::Clear", "Verifica svuotamento e riuso");
+    }
+
+    // ========== TEST TIPI, FUNTORI E ALLOCATORE ==========
+    {
+        std::cout << "\n--- Test stringhe, funtori e allocatore ---" << std::endl;
+
+        lasd::SetHash<std::string> words;
+        bool wordsOk = true;
+        for (int i = 0; i < 2000; ++i) { wordsOk = wordsOk && words.Insert("parola-lunga-abbastanza-da-allocare-" + std::to_string(i)); }
+        for (int i = 0; i < 2000; i += 3) { wordsOk = wordsOk && words.Remove("parola-lunga-abbastanza-da-allocare-" + std::to_string(i)); }
+        for (int i = 0; i < 2000; ++i) { wordsOk = wordsOk && words.Exists("parola-lunga-abbastanza-da-allocare-" + std::to_string(i)) == (i % 3 != 0); }
+        printTestResult(wordsOk && words.Size() == 1333, "SetHash<string>::Insert/Remove", "Verifica stringhe con spostamenti e ridimensionamenti");
+
+        lasd::SetHash<std::string, std::allocator<std::string>, CaseInsensitiveHash, CaseInsensitiveEqual> names;
+        bool namesOk = names.Insert("Napoli") && !names.Insert("NAPOLI") && names.Exists("napoli") && names.Insert("Roma") && names.Remove("ROMA");
+        printTestResult(namesOk && names.Size() == 1, "SetHash<string, CaseInsensitive>::Insert", "Verifica hash e uguaglianza personalizzati");
+
+        lasd::PoolResource pool;
+        lasd::SetHash<int, lasd::PoolAllocator<int>> pooled{lasd::PoolAllocator<int>(pool)};
+        for (int i = 0; i < 3000; ++i) { pooled.Insert(i); }
+        for (int i = 0; i < 3000; i += 3) { pooled.Remove(i); }
+        lasd::SetHash<int, lasd::PoolAllocator<int>> pooledCopy(pooled);
+        printTestResult(pooledCopy == pooled && pooledCopy.Size() == 2000 && !pooledCopy.Exists(0), "SetHash<int, PoolAllocator>::Insert", "Verifica tabella dal pool");
+    }
+}
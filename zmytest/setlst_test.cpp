@@ -2,11 +2,22 @@
 #include "../set/lst/setlst.hpp"
 #include "../vector/vector.hpp" // For constructing SetLst from Vector
 #include "../list/list.hpp"     // For constructing SetLst from List
+#include "../allocator/arena.hpp"
+#include "../allocator/pool.hpp"
 #include <iostream>
 #include <string>
 #include <stdexcept>
 #include <vector> // For std::vector in tests
 #include <functional> // For std::function
+#include <algorithm>
+#include <ranges>
+#include <set>
+
+// Sorting by operator< is not part of the set's interface
+template <typename S>
+concept ResortableList = requires(S& s) { s.Sort(); };
+static_assert(!ResortableList<lasd::SetLst<int>>);
+static_assert(ResortableList<lasd::List<int>>);
 
 void testSetLst() {
     std::cout << "\n=== Inizio test SetLst ===" << std::endl;
@@ -406,6 +417,15 @@ void testSetLst() {
     int product = mapSet.Fold(FoldFunctionInt([](const int& val, const int& acc) { return acc * val; }), 1);
     printTestResult(product == (2*4*6), "SetLst<int>::Fold", "Verifica risultato Fold (prodotto)");
 
+    // Test Reduce e ForEach (callable inline)
+    printTestResult(mapSet.Reduce([](const int& val, int acc) { return acc * 10 + val; }, 0) == 246, "SetLst<int>::Reduce", "Verifica Reduce in ordine crescente");
+    int visitedCount = 0;
+    mapSet.ForEach([&visitedCount](const int&) { visitedCount++; });
+    printTestResult(visitedCount == 3, "SetLst<int>::ForEach", "Verifica ForEach su tutti gli elementi");
+
+    // Test iteratori
+    printTestResult(std::ranges::is_sorted(mapSet) && std::ranges::count_if(mapSet, [](int x) { return x > 2; }) == 2, "SetLst<int>::begin/end", "Verifica algoritmi std::ranges sugli iteratori");
+
     // Test su SetLst vuoto per Min, Max, Successor, Predecessor
     lasd::SetLst<int> emptySetForOps;
     exceptionThrown = false;
@@ -421,6 +441,20 @@ void testSetLst() {
     try { [[maybe_unused]] auto val = emptySetForOps.Predecessor(1); } catch (const std::length_error&) { exceptionThrown = true; } catch (...) {}
     printTestResult(exceptionThrown, "SetLst<int>::Predecessor", "Test eccezione Predecessor su set vuoto");
 
+    // Test con allocatore a pool
+    {
+      lasd::PoolResource pool;
+      lasd::SetLst<int, lasd::PoolAllocator<int>> poolSet{lasd::PoolAllocator<int>(pool)};
+      for (int i = 0; i < 200; i++) {
+        poolSet.Insert((i * 37) % 200);
+      }
+      for (int i = 0; i < 200; i += 2) {
+        poolSet.Remove(i);
+      }
+      lasd::SetLst<int, lasd::PoolAllocator<int>> poolCopy(poolSet);
+      printTestResult(poolCopy.Size() == 100 && poolCopy.Min() == 1 && poolCopy.Max() == 199, "SetLst<int, PoolAllocator>::Insert", "Verifica set con nodi dal pool");
+    }
+
     // Test con elemento di tipo personalizzato (rimosso se non definito)
     // std::cout << "Test con elemento di tipo personalizzato non implementato." << std::endl;
     
@@ -558,4 +592,318 @@ void testSetLst() {
       printTestResult(someInserted, "SetLst<int>::InsertSome", "Verifica InsertSome (comportamento casuale)");
       printTestResult(someRemoved, "SetLst<int>::RemoveSome", "Verifica RemoveSome (comportamento casuale)");
     }
+
+    // === Test rimozione in blocco per SetLst ===
+    {
+      lasd::SetLst<int> removeSet;
+      for (int i = 0; i < 300; ++i) { removeSet.Insert(i); }
+      lasd::Vector<int> removeBatch(250);
+      for (ulong i = 0; i < removeBatch.Size(); ++i) { removeBatch[i] = static_cast<int>((i * 2) % 400); }
+      bool removed = removeSet.RemoveAll(removeBatch);
+      bool onlyOdd = removeSet.All([](const int& value) { return value % 2 != 0; });
+      printTestResult(removed && removeSet.Size() == 150 && onlyOdd && std::ranges::is_sorted(removeSet) && removeSet.Max() == 299,
+                      "SetLst<int>::RemoveAll", "Verifica rimozione in un solo passaggio con duplicati e valori assenti");
+
+      // Rimozione di coda e testa: il puntatore tail deve restare valido
+      lasd::Vector<int> ends(2);
+      ends[0] = 299;
+      ends[1] = 1;
+      removeSet.RemoveAll(ends);
+      removeSet.Insert(1000);
+      printTestResult(removeSet.Min() == 3 && removeSet.Max() == 1000 && removeSet.Size() == 149 && !removeSet.RemoveAll(ends),
+                      "SetLst<int>::RemoveAll", "Verifica testa e coda dopo la rimozione in blocco");
+    }
+
+    // === Test algebra degli insiemi per SetLst ===
+    {
+      lasd::SetLst<int> evens, triples, few;
+      for (int i = 0; i < 300; i += 2) { evens.Insert(i); }
+      for (int i = 0; i < 300; i += 3) { triples.Insert(i); }
+      few.Insert(-1); few.Insert(6); few.Insert(151); few.Insert(298);
+
+      bool allOk = true;
+      for (const lasd::SetLst<int>* left : {&evens, &few}) {
+        for (const lasd::SetLst<int>* right : {&triples, &few, &evens}) {
+          std::vector<int> unionRef, interRef, diffRef, symRef;
+          std::ranges::set_union(*left, *right, std::back_inserter(unionRef));
+          std::ranges::set_intersection(*left, *right, std::back_inserter(interRef));
+          std::ranges::set_difference(*left, *right, std::back_inserter(diffRef));
+          std::ranges::set_symmetric_difference(*left, *right, std::back_inserter(symRef));
+
+          lasd::SetLst<int> unite(*left), intersect(*left), subtract(*left), symmetric(*left);
+          unite.UnionWith(*right);
+          intersect.IntersectWith(*right);
+          subtract.DifferenceWith(*right);
+          symmetric.SymmetricDifferenceWith(*right);
+          allOk = allOk && std::ranges::equal(left->Union(*right), unionRef) && std::ranges::equal(unite, unionRef)
+                        && std::ranges::equal(left->Intersection(*right), interRef) && std::ranges::equal(intersect, interRef)
+                        && std::ranges::equal(left->Difference(*right), diffRef) && std::ranges::equal(subtract, diffRef)
+                        && std::ranges::equal(left->SymmetricDifference(*right), symRef) && std::ranges::equal(symmetric, symRef)
+                        && unite.Size() == unionRef.size() && symmetric.Size() == symRef.size()
+                        && (symRef.empty() || symmetric.Max() == symRef.back());
+        }
+      }
+      printTestResult(allOk, "SetLst<int>::Union/Intersection/Difference", "Verifica operazioni nuove e sul posto");
+
+      lasd::SetLst<int> sixes = evens.Intersection(triples);
+      printTestResult(sixes.IsSubsetOf(evens) && !few.IsSubsetOf(evens) && evens.Intersects(few) && !sixes.Intersects(lasd::SetLst<int>()),
+                      "SetLst<int>::IsSubsetOf/Intersects", "Verifica predicati su insiemi");
+    }
+
+    {
+      std::cout << "\n--- Test indice skip-list ---" << std::endl;
+
+      // Operazioni ordinate con l'indice confrontate con un insieme di riferimento
+      lasd::SetLst<int> indexed;
+      indexed.EnableIndex(7);
+      std::set<int> reference;
+      bool sameAnswers = indexed.IndexEnabled();
+      for (int i = 0; i < 3000; ++i) {
+        int key = (i * 7919) % 5003;
+        sameAnswers = sameAnswers && indexed.Insert(key) == reference.insert(key).second;
+        if (i % 4 == 3) {
+          int victim = (i * 104729) % 5003;
+          sameAnswers = sameAnswers && indexed.Remove(victim) == (reference.erase(victim) == 1);
+        }
+      }
+      for (int probe = -5; probe < 5010 && sameAnswers; probe += 3) {
+        auto atOrAbove = reference.lower_bound(probe);
+        auto above = reference.upper_bound(probe);
+        sameAnswers = indexed.Exists(probe) == reference.contains(probe);
+        try {
+          int pred = indexed.Predecessor(probe);
+          sameAnswers = sameAnswers && atOrAbove != reference.begin() && pred == *std::prev(atOrAbove);
+        } catch (const std::length_error&) {
+          sameAnswers = sameAnswers && atOrAbove == reference.begin();
+        }
+        try {
+          int succ = indexed.Successor(probe);
+          sameAnswers = sameAnswers && above != reference.end() && succ == *above;
+        } catch (const std::length_error&) {
+          sameAnswers = sameAnswers && above == reference.end();
+        }
+      }
+      sameAnswers = sameAnswers && indexed.Size() == reference.size() && std::ranges::equal(indexed, reference);
+      printTestResult(sameAnswers, "SetLst<int>::EnableIndex", "Verifica Insert/Remove/Exists/Predecessor/Successor con indice");
+
+      // Rimozioni di estremi e vicini mantengono l'indice coerente
+      bool removalsOk = indexed.MinNRemove() == *reference.begin() && indexed.MaxNRemove() == *reference.rbegin();
+      reference.erase(reference.begin());
+      reference.erase(std::prev(reference.end()));
+      indexed.RemoveMin();
+      indexed.RemoveMax();
+      reference.erase(reference.begin());
+      reference.erase(std::prev(reference.end()));
+      for (int probe = 100; probe < 4900 && removalsOk; probe += 97) {
+        int pred = *std::prev(reference.lower_bound(probe));
+        int succ = *reference.upper_bound(probe);
+        removalsOk = indexed.PredecessorNRemove(probe) == pred && indexed.SuccessorNRemove(probe) == succ;
+        reference.erase(pred);
+        reference.erase(succ);
+      }
+      removalsOk = removalsOk && std::ranges::equal(indexed, reference) && indexed.Exists(*reference.begin()) && !indexed.Exists(-1);
+      printTestResult(removalsOk, "SetLst<int>::PredecessorNRemove/MaxNRemove", "Verifica rimozioni con indice");
+
+      // Modifiche in blocco, copie e spostamenti ricostruiscono l'indice alla ricerca successiva
+      lasd::Vector<int> smallBatch(10), largeBatch(2000);
+      for (ulong i = 0; i < smallBatch.Size(); ++i) { smallBatch[i] = static_cast<int>(i * 211); }
+      for (ulong i = 0; i < largeBatch.Size(); ++i) { largeBatch[i] = static_cast<int>(i * 3); }
+      indexed.RemoveAll(smallBatch);
+      smallBatch.ForEach([&reference](const int& key) { reference.erase(key); });
+      lasd::SetLst<int> copied(indexed);
+      copied.RemoveAll(largeBatch);
+      std::set<int> copiedRef(reference);
+      largeBatch.ForEach([&copiedRef](const int& key) { copiedRef.erase(key); });
+      lasd::SetLst<int> merged = copied.Union(indexed);
+      lasd::SetLst<int> moved(std::move(copied));
+      bool bulkOk = copied.Empty() && moved.IndexEnabled() && merged.IndexEnabled() && std::ranges::equal(moved, copiedRef)
+                    && std::ranges::equal(merged, reference) && std::ranges::equal(indexed, reference);
+      for (int probe = 0; probe < 5003 && bulkOk; probe += 11) {
+        bulkOk = moved.Exists(probe) == copiedRef.contains(probe) && merged.Exists(probe) == reference.contains(probe);
+      }
+      moved.IntersectWith(merged);
+      moved.Insert(-50);
+      merged = std::move(moved);
+      bulkOk = bulkOk && merged.Min() == -50 && merged.Exists(-50) && merged.Size() == copiedRef.size() + 1;
+      merged.DisableIndex();
+      bulkOk = bulkOk && !merged.IndexEnabled() && merged.Remove(-50) && std::ranges::equal(merged, copiedRef);
+      printTestResult(bulkOk, "SetLst<int>::RemoveAll/Union con indice", "Verifica ricostruzione dell'indice dopo modifiche in blocco");
+
+      // Stesso seme, stessi livelli: due insiemi indicizzati restano uguali dopo le stesse operazioni
+      lasd::SetLst<std::string> wordsA, wordsB;
+      wordsA.EnableIndex(99);
+      wordsB.EnableIndex(99);
+      for (int i = 0; i < 500; ++i) {
+        std::string word = "parola-" + std::to_string((i * 37) % 211);
+        wordsA.Insert(word);
+        wordsB.Insert(std::string(word));
+      }
+      wordsA.Clear();
+      bool wordsOk = wordsA.Empty() && !wordsA.Exists("parola-0") && wordsA.Insert("zeta") && wordsA.Min() == "zeta"
+                     && wordsB.Size() == 211 && wordsB.Successor("parola-1") == "parola-10" && wordsB.Predecessor("parola-2") == "parola-199";
+      printTestResult(wordsOk, "SetLst<string>::EnableIndex", "Verifica indice con stringhe e Clear");
+    }
+
+    {
+      std::cout << "\n--- Test ricerca dal dito ---" << std::endl;
+
+      // Flusso quasi crescente con salti all'indietro: ogni operazione confrontata con std::set
+      for (bool withIndex : {false, true}) {
+        lasd::SetLst<int> stream;
+        if (withIndex) { stream.EnableIndex(3); }
+        std::set<int> reference;
+        bool streamOk = true;
+        int position = 0;
+        for (int step = 0; step < 6000 && streamOk; ++step) {
+          position += (step % 97 == 0) ? -700 : (step * 31) % 7; // Avanti a piccoli passi, a volte indietro
+          int key = position + (step % 5) - 2;
+          switch (step % 4) {
+            case 0: streamOk = stream.Insert(key) == reference.insert(key).second; break;
+            case 1: streamOk = stream.Exists(key) == reference.contains(key); break;
+            case 2: streamOk = stream.Remove(key - 3) == (reference.erase(key - 3) == 1); break;
+            default: {
+              auto above = reference.upper_bound(key);
+              streamOk = (above == reference.end()) || stream.Successor(key) == *above;
+              stream.Insert(key + 1);
+              reference.insert(key + 1);
+            }
+          }
+        }
+        streamOk = streamOk && stream.Size() == reference.size() && std::ranges::equal(stream, reference);
+        printTestResult(streamOk, withIndex ? "SetLst<int>::Insert/Remove (dito e indice)" : "SetLst<int>::Insert/Remove (dito)",
+                        "Verifica flusso quasi crescente rispetto a std::set");
+
+        // Il dito non sopravvive a modifiche in blocco e svuotamenti
+        lasd::Vector<int> allKeys(stream);
+        stream.Exists(allKeys[allKeys.Size() - 1]);
+        stream.RemoveAll(allKeys);
+        bool resetOk = stream.Empty() && !stream.Exists(position) && stream.Insert(position) && stream.Exists(position);
+        stream.Exists(position + 10);
+        stream.Clear();
+        resetOk = resetOk && stream.Insert(1) && stream.Insert(0) && stream.Min() == 0 && stream.Successor(0) == 1;
+        printTestResult(resetOk, "SetLst<int>::RemoveAll/Clear (dito)", "Verifica dito dopo modifiche in blocco");
+      }
+    }
+
+    {
+      std::cout << "\n--- Test filtro di Bloom ---" << std::endl;
+
+      // Stesse risposte di un insieme senza filtro, con e senza indice, anche dopo modifiche in blocco
+      for (bool withIndex : {false, true}) {
+        lasd::SetLst<int> filtered;
+        if (withIndex) { filtered.EnableIndex(5); }
+        filtered.EnableFilter(4);
+        std::set<int> reference;
+        bool filterOk = filtered.FilterEnabled();
+        for (int i = 0; i < 3000 && filterOk; ++i) {
+          int key = (i * 7919) % 4001;
+          filterOk = filtered.Insert(key) == reference.insert(key).second;
+          if (i % 3 == 0) {
+            int victim = (i * 104729) % 4001;
+            filterOk = filterOk && filtered.Remove(victim) == (reference.erase(victim) == 1);
+          }
+          if (i % 500 == 499) {
+            filterOk = filterOk && filtered.MinNRemove() == *reference.begin();
+            reference.erase(reference.begin());
+          }
+          filterOk = filterOk && filtered.Exists(key + 1) == reference.contains(key + 1) && filtered.Exists(key) == reference.contains(key);
+        }
+        lasd::Vector<int> batch(300);
+        for (ulong i = 0; i < batch.Size(); ++i) { batch[i] = static_cast<int>(i * 13); }
+        filtered.RemoveAll(batch);
+        batch.ForEach([&reference](const int& key) { reference.erase(key); });
+        lasd::SetLst<int> extra(batch);
+        filtered.UnionWith(extra);
+        batch.ForEach([&reference](const int& key) { reference.insert(key); });
+        for (int probe = -10; probe < 4010 && filterOk; ++probe) {
+          filterOk = filtered.Exists(probe) == reference.contains(probe);
+        }
+        lasd::BloomStats bloomStats = filtered.FilterStats();
+        filterOk = filterOk && std::ranges::equal(filtered, reference) && bloomStats.rejected > 0 && bloomStats.queries > bloomStats.rejected;
+        printTestResult(filterOk, withIndex ? "SetLst<int>::EnableFilter (indice)" : "SetLst<int>::EnableFilter",
+                        "Verifica filtro rispetto a std::set con rimozioni e modifiche in blocco");
+      }
+
+      // Map ricostruisce il filtro e le corsie: gli elementi spostati restano visibili
+      for (bool withIndex : {false, true}) {
+        lasd::SetLst<int> mappedSet;
+        for (int i = 0; i < 100; ++i) { mappedSet.Insert(2 * i); }
+        if (withIndex) { mappedSet.EnableIndex(3); }
+        mappedSet.EnableFilter();
+        mappedSet.Map([](int& value) { value += 1000; });
+        bool mapped = mappedSet.Exists(1000) && mappedSet.Exists(1198) && !mappedSet.Exists(0) && !mappedSet.Exists(1001);
+        mappedSet.PreOrderMap([](int& value) { value += 1000; });
+        mapped = mapped && mappedSet.Exists(2000) && !mappedSet.Exists(1000);
+        mappedSet.PostOrderMap([](int& value) { value -= 2000; });
+        int present = 0;
+        for (int i = 0; i < 100; ++i) { present += mappedSet.Exists(2 * i) ? 1 : 0; }
+        printTestResult(mapped && present == 100 && !mappedSet.Exists(2000) && mappedSet.Successor(10) == 12,
+                        withIndex ? "SetLst<int>::Map (filtro, indice)" : "SetLst<int>::Map (filtro)", "Verifica ricostruzione del filtro dopo Map");
+      }
+
+      // Le ricerche di stringhe assenti non visitano la lista; copie e risultati dell'algebra mantengono il filtro
+      lasd::SetLst<std::string> words;
+      for (int i = 0; i < 1000; ++i) { words.Insert("parola-" + std::to_string(i)); }
+      words.EnableFilter();
+      bool wordsOk = true;
+      for (int i = 0; i < 2000; ++i) { wordsOk = wordsOk && words.Exists("parola-" + std::to_string(i)) == (i < 1000); }
+      lasd::BloomStats wordStats = words.FilterStats();
+      lasd::SetLst<std::string> wordsCopy(words);
+      lasd::SetLst<std::string> wordsUnion = words.Union(wordsCopy);
+      wordsOk = wordsOk && wordStats.queries == 2000 && wordStats.FalsePositiveRate() < 0.03 && wordsCopy.FilterEnabled() && wordsUnion.FilterEnabled()
+                && wordsCopy.Exists("parola-999") && wordsUnion.Exists("parola-0") && !wordsUnion.Exists("parola-1000");
+      words.Clear();
+      wordsOk = wordsOk && !words.Exists("parola-1") && words.Insert("parola-1") && words.Exists("parola-1");
+      words.DisableFilter();
+      printTestResult(wordsOk && !words.FilterEnabled() && words.Exists("parola-1"), "SetLst<string>::EnableFilter", "Verifica filtro con stringhe, copie e Clear");
+    }
+
+    // I blocchi del filtro vengono allocati dall'arena dell'insieme
+    {
+      lasd::MonotonicArena arena;
+      lasd::SetLst<int, lasd::ArenaAllocator<int>> arenaSet{lasd::ArenaAllocator<int>(arena)};
+      for (int i = 0; i < 1000; ++i) { arenaSet.Insert(2 * i); }
+      ulong before = arena.Allocated();
+      arenaSet.EnableFilter();
+      bool fromArena = arena.Allocated() >= before + 1000 * 10 / 8;
+      printTestResult(fromArena && arenaSet.Exists(1998) && !arenaSet.Exists(1), "SetLst<int, ArenaAllocator>::EnableFilter",
+                      "Verifica filtro allocato dall'arena");
+    }
+
+    // Le corsie dell'indice vengono allocate dall'arena dell'insieme
+    {
+      lasd::MonotonicArena arena;
+      lasd::SetLst<int, lasd::ArenaAllocator<int>> arenaSet{lasd::ArenaAllocator<int>(arena)};
+      for (int i = 0; i < 1000; ++i) { arenaSet.Insert(2 * i); }
+      ulong before = arena.Allocated();
+      arenaSet.EnableIndex();
+      bool fromArena = arena.Allocated() >= before + 32 * sizeof(ulong) + 300 * 3 * sizeof(ulong);
+      lasd::SetLst<int, lasd::ArenaAllocator<int>> arenaCopy(arenaSet);
+      before = arena.Allocated();
+      bool copyFound = arenaCopy.Exists(1500) && !arenaCopy.Exists(1501);
+      fromArena = fromArena && arena.Allocated() > before;
+      printTestResult(fromArena && copyFound && arenaSet.Exists(1998) && !arenaSet.Exists(1), "SetLst<int, ArenaAllocator>::EnableIndex",
+                      "Verifica corsie dell'indice allocate dall'arena");
+    }
+
+    {
+      std::cout << "\n--- Test comparatore personalizzato ---" << std::endl;
+
+      // Ordine decrescente con confronto a tre vie nelle fusioni
+      using DescSetLst = lasd::SetLst<int, std::allocator<int>, std::greater<int>>;
+      DescSetLst desc, other;
+      for (int i = 0; i < 30; ++i) { desc.Insert((i * 37) % 61); other.Insert((i * 11) % 45); }
+      bool descOrder = std::ranges::is_sorted(desc, std::greater<int>()) && std::ranges::adjacent_find(desc) == desc.end();
+      printTestResult(descOrder && desc.Min() == 60 && desc.Predecessor(30) > 30 && desc.Successor(30) < 30,
+                      "SetLst<int, greater>::Insert", "Verifica ordine decrescente e vicini");
+
+      std::vector<int> unionRef, interRef;
+      std::ranges::set_union(desc, other, std::back_inserter(unionRef), std::greater<int>());
+      std::ranges::set_intersection(desc, other, std::back_inserter(interRef), std::greater<int>());
+      DescSetLst merged(desc);
+      merged.UnionWith(other);
+      printTestResult(std::ranges::equal(merged, unionRef) && std::ranges::equal(desc.Intersection(other), interRef)
+                      && desc.Remove(60) && !desc.Exists(60) && desc.Min() < 60,
+                      "SetLst<int, greater>::Union/Intersection", "Verifica algebra con comparatore");
+    }
 }
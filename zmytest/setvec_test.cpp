@@ -3,10 +3,41 @@
 #include "../set/lst/setlst.hpp" // Added missing include for SetLst
 #include "../vector/vector.hpp"
 #include "../list/list.hpp"
+#include "../allocator/arena.hpp"
 #include <iostream>
 #include <stdexcept>
 #include <string>
 #include <functional> // For std::function
+#include <algorithm>
+#include <ranges>
+#include <vector>
+#include <iterator>
+#include <limits>
+#include <cctype>
+
+// Reordering a set outside its comparator is not part of its interface
+template <typename S>
+concept ReorderableSet = requires(S& s) { s.Sort(); } || requires(S& s) { s.SortBy(std::greater<int>()); } || requires(S& s) { s.ParallelSort(); };
+static_assert(!ReorderableSet<lasd::SetVec<int>>);
+static_assert(ReorderableSet<lasd::SortableVector<int>>);
+
+// Comparatore che conta i confronti eseguiti
+struct CountingLess {
+    static inline ulong calls = 0;
+    bool operator()(int a, int b) const { ++calls; return a < b; }
+};
+
+// Comparatore di stringhe che lancia un'eccezione esaurito il budget di confronti
+struct FragileLess {
+    static inline long budget = -1; // Negativo: nessun limite
+    bool operator()(const std::string& a, const std::string& b) const {
+        if (budget == 0) {
+            throw std::runtime_error("comparison failed");
+        }
+        if (budget > 0) { --budget; }
+        return a < b;
+    }
+};
 
 void testSetVec() {
     std::cout << "\n=== Inizio test SetVec ===" << std::endl;
@@ -672,6 +703,12 @@ void testSetVec() {
     // Test Fold per prodotto
     int product = setForMap.Fold(FoldFunctionInt([](const int& val, const int& acc) { return val * acc; }), 1);
     printTestResult(product == 48, "SetVec<int>::Fold", "Verifica prodotto con Fold");
+
+    // Test Reduce (callable inline)
+    printTestResult(setForMap.Reduce([](const int& val, int acc) { return acc * 10 + val; }, 0) == 246, "SetVec<int>::Reduce", "Verifica Reduce in ordine crescente");
+
+    // Test iteratori
+    printTestResult(std::ranges::is_sorted(setForMap) && std::ranges::binary_search(setForMap, 4) && !std::ranges::binary_search(setForMap, 5), "SetVec<int>::begin/end", "Verifica algoritmi std::ranges sugli iteratori");
     
     // ========== TEST CON TIPI DIVERSI ==========
     
@@ -748,5 +785,526 @@ void testSetVec() {
     printTestResult(exceptionThrown, "SetVec<int>::Predecessor", "Test eccezione Predecessor su set vuoto");
 
 
+    // ========== TEST INSERIMENTO IN BLOCCO ==========
+
+    std::cout << "\n=== Test inserimento in blocco ===" << std::endl;
+
+    // Blocco con elementi ripetuti e in parte gia' presenti
+    lasd::SetVec<int> bulkSet;
+    for (int i = 0; i < 100; i += 2) { bulkSet.Insert(i); }
+    lasd::Vector<int> bulkBatch(200);
+    for (ulong i = 0; i < bulkBatch.Size(); ++i) { bulkBatch[i] = static_cast<int>((bulkBatch.Size() - i) % 120); }
+    bool someInserted = bulkSet.InsertSome(bulkBatch);
+    printTestResult(someInserted && bulkSet.Size() == 120 && std::ranges::is_sorted(bulkSet) && std::ranges::adjacent_find(bulkSet) == bulkSet.end(),
+                    "SetVec<int>::InsertSome", "Verifica fusione di un blocco con duplicati e sovrapposizioni");
+
+    // InsertAll e' vero solo se ogni elemento del blocco era nuovo e distinto
+    lasd::Vector<int> freshBatch(20);
+    for (ulong i = 0; i < freshBatch.Size(); ++i) { freshBatch[i] = 1000 - static_cast<int>(i); }
+    bool allFresh = bulkSet.InsertAll(freshBatch);
+    freshBatch[0] = 2000;
+    freshBatch[1] = 2000;
+    bool allWithRepeat = bulkSet.InsertAll(freshBatch);
+    printTestResult(allFresh && !allWithRepeat && !bulkSet.InsertSome(freshBatch) && bulkSet.Size() == 141 && bulkSet.Max() == 2000,
+                    "SetVec<int>::InsertAll", "Verifica valori di ritorno con blocchi nuovi, ripetuti e gia' presenti");
+
+    // Costruttore e versione per spostamento con stringhe ripetute
+    lasd::List<std::string> wordList;
+    for (int i = 0; i < 30; ++i) { wordList.InsertAtBack("w" + std::to_string(i % 12)); }
+    lasd::SetVec<std::string> wordSet(wordList);
+    lasd::SetVec<std::string> movedSet(std::move(wordList));
+    printTestResult(wordSet.Size() == 12 && wordSet == movedSet && std::ranges::is_sorted(wordSet) && wordList.Empty(),
+                    "SetVec<string>::SetVec", "Verifica costruzione da contenitore con duplicati");
+
+    // ========== TEST RIMOZIONE IN BLOCCO ==========
+
+    std::cout << "\n=== Test rimozione in blocco ===" << std::endl;
+
+    // Rimozione di tutti i multipli di 3 (con ripetizioni e valori assenti)
+    lasd::SetVec<int> removeSet;
+    for (int i = 0; i < 1000; ++i) { removeSet.Insert(i); }
+    lasd::Vector<int> removeBatch(700);
+    for (ulong i = 0; i < removeBatch.Size(); ++i) { removeBatch[i] = static_cast<int>((i * 3) % 1200); }
+    bool someRemoved = removeSet.RemoveSome(removeBatch);
+    bool noMultiples = removeSet.All([](const int& value) { return value % 3 != 0; });
+    printTestResult(someRemoved && removeSet.Size() == 666 && noMultiples && std::ranges::is_sorted(removeSet),
+                    "SetVec<int>::RemoveSome", "Verifica compattazione con duplicati e valori assenti");
+
+    // RemoveAll e' vero solo se ogni elemento era presente e non ripetuto
+    lasd::Vector<int> presentBatch(20);
+    for (ulong i = 0; i < presentBatch.Size(); ++i) { presentBatch[i] = static_cast<int>(3 * i + 1); }
+    bool allPresent = removeSet.RemoveAll(presentBatch);
+    bool allAgain = removeSet.RemoveAll(presentBatch);
+    printTestResult(allPresent && !allAgain && removeSet.Size() == 646 && !removeSet.Exists(1),
+                    "SetVec<int>::RemoveAll", "Verifica valori di ritorno con elementi presenti e gia' rimossi");
+
+    // Una sola riduzione della capacita' dopo una rimozione massiccia
+    lasd::Vector<int> everything(removeSet);
+    removeSet.RemoveAll(everything);
+    printTestResult(removeSet.Empty() && removeSet.Capacity() <= 4,
+                    "SetVec<int>::RemoveAll", "Verifica riduzione della capacita' dopo lo svuotamento");
+
+    // ========== TEST ALGEBRA DEGLI INSIEMI ==========
+
+    std::cout << "\n=== Test algebra degli insiemi ===" << std::endl;
+
+    // Multipli di 2 e di 3 (fusione lineare) e un insieme piccolo contro uno grande (galoppo)
+    lasd::SetVec<int> evens, triples, few;
+    for (int i = 0; i < 600; i += 2) { evens.Insert(i); }
+    for (int i = 0; i < 600; i += 3) { triples.Insert(i); }
+    few.Insert(-1); few.Insert(6); few.Insert(301); few.Insert(598);
+
+    auto expected = [](const lasd::SetVec<int>& a, const lasd::SetVec<int>& b, int op) {
+      std::vector<int> out;
+      if (op == 0) { std::ranges::set_union(a, b, std::back_inserter(out)); }
+      if (op == 1) { std::ranges::set_intersection(a, b, std::back_inserter(out)); }
+      if (op == 2) { std::ranges::set_difference(a, b, std::back_inserter(out)); }
+      if (op == 3) { std::ranges::set_symmetric_difference(a, b, std::back_inserter(out)); }
+      return out;
+    };
+    auto matches = [](const lasd::SetVec<int>& set, const std::vector<int>& values) {
+      return std::ranges::equal(set, values);
+    };
+
+    bool newSetsOk = true;
+    bool inPlaceOk = true;
+    for (const lasd::SetVec<int>* left : {&evens, &few}) {
+      for (const lasd::SetVec<int>* right : {&triples, &few, &evens}) {
+        newSetsOk = newSetsOk && matches(left->Union(*right), expected(*left, *right, 0))
+                              && matches(left->Intersection(*right), expected(*left, *right, 1))
+                              && matches(left->Difference(*right), expected(*left, *right, 2))
+                              && matches(left->SymmetricDifference(*right), expected(*left, *right, 3));
+        lasd::SetVec<int> unite(*left), intersect(*left), subtract(*left), symmetric(*left);
+        unite.UnionWith(*right);
+        intersect.IntersectWith(*right);
+        subtract.DifferenceWith(*right);
+        symmetric.SymmetricDifferenceWith(*right);
+        inPlaceOk = inPlaceOk && matches(unite, expected(*left, *right, 0)) && matches(intersect, expected(*left, *right, 1))
+                              && matches(subtract, expected(*left, *right, 2)) && matches(symmetric, expected(*left, *right, 3));
+      }
+    }
+    printTestResult(newSetsOk, "SetVec<int>::Union/Intersection/Difference", "Verifica operazioni che restituiscono un nuovo insieme");
+    printTestResult(inPlaceOk, "SetVec<int>::UnionWith/IntersectWith/DifferenceWith", "Verifica operazioni sul posto");
+
+    // Operazioni con se stesso
+    lasd::SetVec<int> self(few);
+    self.UnionWith(self);
+    bool selfUnion = self == few;
+    self.SymmetricDifferenceWith(self);
+    printTestResult(selfUnion && self.Empty(), "SetVec<int>::SymmetricDifferenceWith", "Verifica operazioni con se stesso");
+
+    // Predicati
+    lasd::SetVec<int> sixes = evens.Intersection(triples);
+    lasd::SetVec<int> odds;
+    for (int i = 1; i < 600; i += 2) { odds.Insert(i); }
+    printTestResult(sixes.IsSubsetOf(evens) && sixes.IsSubsetOf(triples) && !few.IsSubsetOf(evens) && lasd::SetVec<int>().IsSubsetOf(few),
+                    "SetVec<int>::IsSubsetOf", "Verifica inclusione tra insiemi");
+    printTestResult(evens.Intersects(few) && !evens.Intersects(odds) && odds.Intersects(few) && !evens.Intersects(lasd::SetVec<int>()),
+                    "SetVec<int>::Intersects", "Verifica intersezione non vuota");
+
+    // ========== TEST MODALITA' IN SOLA LETTURA ==========
+
+    std::cout << "\n=== Test modalita' congelata ===" << std::endl;
+
+    // Ricerche sul layout di Eytzinger confrontate con quelle sull'array ordinato
+    for (ulong count : {1UL, 2UL, 7UL, 100UL, 1000UL}) {
+      lasd::SetVec<int> reference;
+      for (ulong i = 0; i < count; ++i) { reference.Insert(static_cast<int>(3 * i)); }
+      lasd::SetVec<int> frozenSet(reference);
+      frozenSet.Freeze();
+
+      // Risposta (eventualmente assente) di Predecessor o Successor
+      auto answer = [](const lasd::SetVec<int>& set, int value, bool predecessor) {
+        try { return predecessor ? set.Predecessor(value) : set.Successor(value); }
+        catch (std::length_error&) { return -100; }
+      };
+      bool sameAnswers = frozenSet.IsFrozen();
+      for (int value = -2; value <= static_cast<int>(3 * count) + 1 && sameAnswers; ++value) {
+        sameAnswers = frozenSet.Exists(value) == reference.Exists(value)
+                      && answer(frozenSet, value, true) == answer(reference, value, true)
+                      && answer(frozenSet, value, false) == answer(reference, value, false);
+      }
+      printTestResult(sameAnswers, "SetVec<int>::Freeze", "Verifica Exists/Predecessor/Successor congelati con " + std::to_string(count) + " elementi");
+    }
+
+    // Ogni modifica scongela l'insieme
+    lasd::SetVec<std::string> frozenWords;
+    frozenWords.Insert("b"); frozenWords.Insert("d"); frozenWords.Insert("f");
+    frozenWords.Freeze();
+    bool frozenReads = frozenWords.Exists("d") && !frozenWords.Exists("c") && frozenWords.Successor("b") == "d" && frozenWords.Predecessor("f") == "d";
+    bool stillFrozen = !frozenWords.Insert("d") && !frozenWords.Remove("c") && frozenWords.IsFrozen();
+    frozenWords.Insert("c");
+    bool thawed = !frozenWords.IsFrozen() && frozenWords.Exists("c") && frozenWords.Successor("b") == "c";
+    frozenWords.Freeze();
+    frozenWords.Map([](std::string& word) { word += "!"; });
+    bool mapThawed = !frozenWords.IsFrozen() && frozenWords.Exists("c!");
+    printTestResult(frozenReads && stillFrozen && thawed && mapThawed, "SetVec<string>::Thaw",
+                    "Verifica scongelamento alla prima modifica");
+
+    // Il layout congelato viene allocato dall'arena dell'insieme
+    {
+      lasd::MonotonicArena arena;
+      lasd::SetVec<int, lasd::ArenaAllocator<int>> arenaSet{lasd::ArenaAllocator<int>(arena)};
+      for (int i = 0; i < 1000; ++i) { arenaSet.Insert(2 * i); }
+      ulong before = arena.Allocated();
+      arenaSet.Freeze();
+      bool fromArena = arena.Allocated() >= before + 1000 * sizeof(int);
+      lasd::SetVec<int, lasd::ArenaAllocator<int>> arenaCopy(arenaSet);
+      arenaCopy.Freeze();
+      printTestResult(fromArena && arenaSet.IsFrozen() && arenaSet.Exists(1998) && !arenaSet.Exists(1) && arenaCopy.IsFrozen() && arenaCopy.Exists(500),
+                      "SetVec<int, ArenaAllocator>::Freeze", "Verifica layout congelato allocato dall'arena");
+    }
+
+    // Il layout congelato copia ogni elemento una sola volta, anche senza costruttore di default,
+    // e una copia che fallisce lascia l'insieme scongelato
+    {
+      struct Ticket {
+        int value;
+        int* copies;
+        Ticket(int v, int* c) : value(v), copies(c) {}
+        Ticket(const Ticket& other) : value(other.value), copies(other.copies) {
+          if (*copies == 0) {
+            throw std::runtime_error("copy failed");
+          }
+          --*copies;
+        }
+        Ticket(Ticket&&) noexcept = default;
+        Ticket& operator=(const Ticket&) = default;
+        Ticket& operator=(Ticket&&) noexcept = default;
+        bool operator<(const Ticket& other) const { return value < other.value; }
+        bool operator==(const Ticket& other) const { return value == other.value; }
+      };
+      int copies = 1 << 30;
+      lasd::SetVec<Ticket> tickets;
+      for (int i = 0; i < 500; ++i) { tickets.Insert(Ticket((i * 7) % 500, &copies)); }
+      copies = 499;
+      bool failed = false;
+      try {
+        tickets.Freeze();
+      } catch (const std::runtime_error&) {
+        failed = true;
+      }
+      bool thawed = failed && !tickets.IsFrozen() && tickets.Exists(Ticket(250, &copies));
+      copies = 500;
+      tickets.Freeze();
+      printTestResult(thawed && tickets.IsFrozen() && copies == 0 && tickets.Exists(Ticket(499, &copies)) && !tickets.Exists(Ticket(500, &copies))
+                      && tickets.Successor(Ticket(10, &copies)).value == 11,
+                      "SetVec<Ticket>::Freeze", "Verifica una copia per elemento e scongelamento dopo una copia fallita");
+    }
+
+    // ========== TEST MODELLO DI RICERCA ==========
+
+    std::cout << "\n=== Test modello di ricerca ===" << std::endl;
+
+    // Chiavi uniformi, raggruppate e con valori estremi confrontate con la ricerca binaria
+    auto modelAgrees = [](const lasd::SetVec<long>& reference, const lasd::Vector<long>& probes) {
+      lasd::SetVec<long> modelSet(reference);
+      modelSet.EnableModel();
+      auto answer = [](const lasd::SetVec<long>& set, long value, bool predecessor) {
+        try { return predecessor ? set.Predecessor(value) : set.Successor(value); }
+        catch (std::length_error&) { return 12345L; }
+      };
+      return modelSet.ModelEnabled() && probes.All([&](const long& value) {
+        return modelSet.Exists(value) == reference.Exists(value)
+               && answer(modelSet, value, true) == answer(reference, value, true)
+               && answer(modelSet, value, false) == answer(reference, value, false);
+      });
+    };
+
+    lasd::SetVec<long> uniformKeys, clusteredKeys, extremeKeys;
+    lasd::Vector<long> probes(3000);
+    for (long i = 0; i < 2000; ++i) { uniformKeys.Insert(7 * i - 3000); }
+    for (long i = 0; i < 2000; ++i) { clusteredKeys.Insert((i % 4) * 1000000 + (i / 4) * (i % 4 + 1)); }
+    for (long i = 0; i < 200; ++i) { extremeKeys.Insert(std::numeric_limits<long>::max() - i); extremeKeys.Insert(std::numeric_limits<long>::min() + 3 * i); extremeKeys.Insert(i); }
+    for (ulong i = 0; i < probes.Size(); ++i) { probes[i] = static_cast<long>(i) * 5 - 3500; }
+    bool uniformOk = modelAgrees(uniformKeys, probes);
+    for (ulong i = 0; i < probes.Size(); ++i) { probes[i] = (static_cast<long>(i) % 4) * 1000000 + static_cast<long>(i) - 100; }
+    bool clusteredOk = modelAgrees(clusteredKeys, probes);
+    for (ulong i = 0; i < probes.Size(); ++i) { probes[i] = (i % 3 == 0) ? std::numeric_limits<long>::max() - static_cast<long>(i) : (i % 3 == 1) ? std::numeric_limits<long>::min() + static_cast<long>(i) : static_cast<long>(i) - 100; }
+    bool extremeOk = modelAgrees(extremeKeys, probes);
+    printTestResult(uniformOk && clusteredOk && extremeOk, "SetVec<long>::EnableModel", "Verifica ricerche con il modello su chiavi uniformi, raggruppate ed estreme");
+
+    // Il modello viene ricostruito dopo le modifiche
+    lasd::SetVec<double> modelDoubles;
+    for (int i = 0; i < 500; ++i) { modelDoubles.Insert(i * 0.5); }
+    modelDoubles.EnableModel();
+    bool beforeChange = modelDoubles.Exists(10.0) && !modelDoubles.Exists(10.25);
+    modelDoubles.Insert(10.25);
+    modelDoubles.Remove(10.0);
+    modelDoubles.Insert(-1e6);
+    bool afterChange = modelDoubles.Exists(10.25) && !modelDoubles.Exists(10.0) && modelDoubles.Successor(9.75) == 10.25
+                       && modelDoubles.Predecessor(0.0) == -1e6 && modelDoubles.Exists(249.5);
+    modelDoubles.DisableModel();
+    printTestResult(beforeChange && afterChange && !modelDoubles.ModelEnabled() && modelDoubles.Exists(10.25),
+                    "SetVec<double>::EnableModel", "Verifica ricostruzione del modello dopo inserimenti e rimozioni");
+
+    // I segmenti del modello vengono allocati dall'arena dell'insieme
+    {
+      lasd::MonotonicArena arena;
+      lasd::SetVec<int, lasd::ArenaAllocator<int>> arenaSet{lasd::ArenaAllocator<int>(arena)};
+      for (int i = 0; i < 6400; ++i) { arenaSet.Insert(3 * i); }
+      ulong before = arena.Allocated();
+      arenaSet.EnableModel();
+      bool fromArena = arena.Allocated() >= before + 100 * 4 * sizeof(double);
+      printTestResult(fromArena && arenaSet.Exists(300) && !arenaSet.Exists(301), "SetVec<int, ArenaAllocator>::EnableModel",
+                      "Verifica modello allocato dall'arena");
+    }
+
+    // ========== TEST FILTRO DI BLOOM ==========
+
+    std::cout << "\n=== Test filtro di Bloom ===" << std::endl;
+
+    // Filtro da solo: ogni chiave inserita passa, con 16 bit per chiave si usano 8 bit per chiave
+    lasd::Vector<std::string> bloomWords(500);
+    for (ulong i = 0; i < bloomWords.Size(); ++i) { bloomWords[i] = "filtro-" + std::to_string(i * 13); }
+    lasd::BloomFilter<std::string> wordFilter(16);
+    bool unbuiltPasses = !wordFilter.Built() && wordFilter.MayContain("qualsiasi") && wordFilter.Bits() == 0;
+    wordFilter.Build(bloomWords);
+    bool allPass = bloomWords.All([&wordFilter](const std::string& word) { return wordFilter.MayContain(word); });
+    printTestResult(unbuiltPasses && allPass && wordFilter.Probes() == 8 && wordFilter.Bits() >= 500 * 16 && wordFilter.Fresh(500) && !wordFilter.Fresh(200),
+                    "BloomFilter<string>::Build", "Verifica costruzione e assenza di falsi negativi");
+
+    // Nessun falso negativo, e quasi tutte le ricerche di elementi assenti risolte dal filtro
+    lasd::SetVec<int> filtered;
+    for (int i = 0; i < 5000; ++i) { filtered.Insert(2 * i); }
+    filtered.EnableFilter();
+    bool noMisses = filtered.FilterEnabled();
+    for (int i = 0; i < 10000; ++i) { noMisses = noMisses && filtered.Exists(i) == (i % 2 == 0); }
+    lasd::BloomStats bloomStats = filtered.FilterStats();
+    printTestResult(noMisses && bloomStats.queries == 10000 && bloomStats.rejected + bloomStats.falsePositives == 5000 && bloomStats.FalsePositiveRate() < 0.03,
+                    "SetVec<int>::EnableFilter", "Verifica filtro senza falsi negativi e con pochi falsi positivi");
+
+    // Inserimenti oltre la dimensione prevista, rimozioni, lotti e Map aggiornano o ricostruiscono il filtro
+    for (int i = 0; i < 20000; ++i) { filtered.Insert(-1 - 2 * i); }
+    bool grown = filtered.Exists(-39999) && filtered.Exists(-1) && !filtered.Exists(-2) && filtered.Exists(9998);
+    for (int i = 0; i < 20000; ++i) { filtered.Remove(-1 - 2 * i); }
+    bool shrunk = !filtered.Exists(-1) && !filtered.Exists(-39999) && filtered.Exists(0) && filtered.Size() == 5000;
+    lasd::Vector<int> bloomOdds(100);
+    for (ulong i = 0; i < bloomOdds.Size(); ++i) { bloomOdds[i] = 2 * static_cast<int>(i) + 1; }
+    filtered.InsertAll(bloomOdds);
+    bool batched = bloomOdds.All([&filtered](const int& value) { return filtered.Exists(value); }) && !filtered.Exists(201);
+    filtered.Map([](int& value) { value += 100000; });
+    bool mapped = filtered.Exists(100001) && filtered.Exists(109998) && !filtered.Exists(1) && !filtered.Exists(100201);
+    printTestResult(grown && shrunk && batched && mapped, "SetVec<int>::Insert/Remove/InsertAll/Map (filtro)", "Verifica aggiornamento e ricostruzione del filtro");
+
+    // Copie e spostamenti mantengono il filtro; disattivandolo le ricerche non lo consultano piu'
+    lasd::SetVec<int> filteredCopy(filtered);
+    lasd::SetVec<int> filteredAssigned;
+    filteredAssigned.Insert(-7);
+    filteredAssigned = filtered;
+    lasd::SetVec<int> filteredMoved(std::move(filteredCopy));
+    bool copiesOk = filteredAssigned.FilterEnabled() && filteredMoved.FilterEnabled() && filteredAssigned.Exists(100001) && !filteredAssigned.Exists(-7)
+                    && filteredMoved.Exists(109998) && !filteredMoved.Exists(100201) && filteredCopy.Empty() && !filteredCopy.Exists(100001);
+    filteredMoved.DisableFilter();
+    bool disabled = !filteredMoved.FilterEnabled() && filteredMoved.Exists(100001) && !filteredMoved.Exists(3) && filteredMoved.FilterStats().queries == 0;
+    printTestResult(copiesOk && disabled, "SetVec<int>::DisableFilter", "Verifica filtro dopo copie, spostamenti e disattivazione");
+
+    // Con pochi bit per chiave i falsi positivi sono frequenti, ma le risposte restano esatte
+    lasd::SetVec<int> sparseFilter, unfiltered;
+    sparseFilter.EnableFilter(2);
+    bool sameFiltered = true;
+    for (int i = 0; i < 4000; ++i) {
+      int key = (i * 7919) % 3001;
+      sameFiltered = sameFiltered && sparseFilter.Insert(key) == unfiltered.Insert(key);
+      if (i % 3 == 0) {
+        int victim = (i * 104729) % 3001;
+        sameFiltered = sameFiltered && sparseFilter.Remove(victim) == unfiltered.Remove(victim);
+      }
+      sameFiltered = sameFiltered && sparseFilter.Exists(key + 1) == unfiltered.Exists(key + 1);
+    }
+    printTestResult(sameFiltered && sparseFilter == unfiltered && sparseFilter.FilterStats().falsePositives > 0,
+                    "SetVec<int>::EnableFilter(2)", "Verifica risposte esatte con molti falsi positivi");
+
+    // I blocchi del filtro vengono allocati dall'arena dell'insieme
+    {
+      lasd::MonotonicArena arena;
+      lasd::SetVec<int, lasd::ArenaAllocator<int>> arenaSet{lasd::ArenaAllocator<int>(arena)};
+      for (int i = 0; i < 1000; ++i) { arenaSet.Insert(2 * i); }
+      ulong before = arena.Allocated();
+      arenaSet.EnableFilter();
+      bool fromArena = arena.Allocated() >= before + 1000 * 10 / 8;
+      printTestResult(fromArena && arenaSet.Exists(1998) && !arenaSet.Exists(1), "SetVec<int, ArenaAllocator>::EnableFilter",
+                      "Verifica filtro allocato dall'arena");
+    }
+
+    // Il lotto di un inserimento in blocco viene allocato dall'arena dell'insieme
+    {
+      lasd::MonotonicArena arena;
+      lasd::SetVec<int, lasd::ArenaAllocator<int>> arenaSet{lasd::ArenaAllocator<int>(arena)};
+      for (int i = 0; i < 1000; ++i) { arenaSet.Insert(2 * i); }
+      lasd::Vector<int> odd(500);
+      for (ulong i = 0; i < odd.Size(); ++i) { odd[i] = 2 * static_cast<int>(i) + 1; }
+      ulong before = arena.Allocated();
+      bool inserted = arenaSet.InsertAll(odd);
+      // Lotto, posizioni di fusione e nuovo buffer provengono tutti dall'arena
+      ulong needed = 500 * sizeof(int) + 500 * sizeof(ulong) + 1500 * sizeof(int);
+      bool fromArena = arena.Allocated() >= before + needed;
+      printTestResult(inserted && fromArena && arenaSet.Size() == 1500 && arenaSet.Exists(999),
+                      "SetVec<int, ArenaAllocator>::InsertAll", "Verifica lotto allocato dall'arena");
+    }
+
+    // ========== TEST SPAZIO IN TESTA ==========
+
+    std::cout << "\n=== Test spazio in testa ===" << std::endl;
+
+    auto strictlySorted = [](const auto& set) {
+      for (ulong i = 1; i < set.Size(); ++i) {
+        if (!(set[i - 1] < set[i])) { return false; }
+      }
+      return true;
+    };
+
+    // Coda di priorita': estrazioni del minimo alternate a inserimenti in coda
+    lasd::SetVec<int> queueSet;
+    for (int i = 0; i < 1000; ++i) { queueSet.Insert(i); }
+    bool minsInOrder = true;
+    for (int i = 0; i < 500; ++i) {
+      minsInOrder = minsInOrder && queueSet.MinNRemove() == i;
+      queueSet.Insert(2000 + i);
+    }
+    printTestResult(minsInOrder && queueSet.Size() == 1000 && queueSet.Min() == 500 && queueSet.Max() == 2499 && strictlySorted(queueSet),
+                    "SetVec<int>::MinNRemove", "Verifica estrazioni del minimo alternate a inserimenti in coda");
+
+    // Inserimenti e rimozioni vicino alla testa, a meta' e in coda
+    for (int i = 1; i <= 300; ++i) { queueSet.Insert(-i); }
+    for (int i = 0; i < 100; ++i) { queueSet.Insert(1000 + 10 * i); }
+    bool nearInserts = queueSet.Size() == 1400 && queueSet.Min() == -300 && queueSet[300] == 500 && strictlySorted(queueSet);
+    bool nearRemoves = queueSet.Remove(-150) && queueSet.Remove(2400) && queueSet.Remove(1500) && !queueSet.Remove(1501)
+                       && !queueSet.Exists(-150) && !queueSet.Exists(2400) && queueSet.Exists(-149) && queueSet.Exists(2401)
+                       && queueSet.Size() == 1397 && strictlySorted(queueSet);
+    printTestResult(nearInserts && nearRemoves, "SetVec<int>::Insert", "Verifica inserimenti e rimozioni spostando il lato piu' corto");
+
+    // Lo svuotamento dal minimo rilascia la memoria
+    while (!queueSet.Empty()) { queueSet.RemoveMin(); }
+    queueSet.Insert(7); queueSet.Insert(3);
+    printTestResult(queueSet.Capacity() <= 8 && queueSet.Size() == 2 && queueSet.Min() == 3 && queueSet.Max() == 7,
+                    "SetVec<int>::RemoveMin", "Verifica riduzione della capacita' dopo lo svuotamento dal minimo");
+
+    // Elementi con memoria propria inseriti sempre in testa
+    lasd::SetVec<std::string> frontWords;
+    for (char c = 'z'; c >= 'a'; --c) { frontWords.Insert(std::string(20, c)); }
+    bool wordsOk = frontWords.Size() == 26 && frontWords.MinNRemove() == std::string(20, 'a') && frontWords.Min() == std::string(20, 'b')
+                   && frontWords.Remove(std::string(20, 'c')) && frontWords[1] == std::string(20, 'd') && strictlySorted(frontWords);
+    lasd::SetVec<std::string> wordsCopy(frontWords);
+    printTestResult(wordsOk && wordsCopy == frontWords && wordsCopy.Size() == 24, "SetVec<string>::Insert", "Verifica inserimenti in testa con stringhe");
+
+    // Spostamenti sovrapposti con elementi non banalmente copiabili
+    lasd::SetVec<std::string> shiftedWords;
+    lasd::SetLst<std::string> referenceWords;
+    for (int i = 0; i < 400; ++i) {
+      std::string word = "chiave-lunga-" + std::to_string((i * 7919) % 1000);
+      shiftedWords.Insert(word);
+      referenceWords.Insert(word);
+      if (i % 3 == 0) {
+        std::string victim = "chiave-lunga-" + std::to_string((i * 104729) % 1000);
+        shiftedWords.Remove(victim);
+        referenceWords.Remove(victim);
+      }
+    }
+    lasd::Vector<std::string> wordVictims(100);
+    for (ulong i = 0; i < wordVictims.Size(); ++i) { wordVictims[i] = "chiave-lunga-" + std::to_string((i * 13) % 1000); }
+    shiftedWords.RemoveSome(wordVictims);
+    wordVictims.ForEach([&referenceWords](const std::string& word) { referenceWords.Remove(word); });
+    lasd::Vector<std::string> referenceOrder(referenceWords);
+    bool sameWords = shiftedWords.Size() == referenceOrder.Size() && strictlySorted(shiftedWords);
+    for (ulong i = 0; sameWords && i < shiftedWords.Size(); ++i) { sameWords = shiftedWords[i] == referenceOrder[i]; }
+    printTestResult(sameWords, "SetVec<string>::Remove", "Verifica spostamenti per move di stringhe rispetto a SetLst");
+
+    std::cout << "\n--- Test comparatore personalizzato ---" << std::endl;
+
+    // Ordine decrescente: Min e il massimo numerico, Predecessor/Successor seguono il comparatore
+    using DescSetVec = lasd::SetVec<int, std::allocator<int>, std::greater<int>>;
+    DescSetVec desc;
+    for (int i = 0; i < 40; ++i) { desc.Insert((i * 37) % 101); }
+    bool descOrder = std::ranges::is_sorted(desc, std::greater<int>()) && std::ranges::adjacent_find(desc) == desc.end();
+    printTestResult(descOrder && desc.Size() == 40 && desc.Min() == 100 && desc.Max() == 0, "SetVec<int, greater>::Insert", "Verifica ordine decrescente e Min/Max");
+    printTestResult(desc.Predecessor(50) == 53 && desc.Successor(50) == 47 && desc.Exists(74) && !desc.Exists(75),
+                    "SetVec<int, greater>::Predecessor/Successor", "Verifica vicini secondo il comparatore");
+
+    // Inserimento a lotti (ordinamento del lotto con il comparatore) e rimozione a lotti
+    lasd::Vector<int> descBatch(30);
+    for (ulong i = 0; i < descBatch.Size(); ++i) { descBatch[i] = static_cast<int>((i * 53) % 150); }
+    DescSetVec descBatched(desc);
+    descBatched.InsertAll(descBatch);
+    std::vector<int> descRef(desc.begin(), desc.end());
+    for (ulong i = 0; i < descBatch.Size(); ++i) { descRef.push_back(descBatch[i]); }
+    std::ranges::sort(descRef, std::greater<int>());
+    descRef.erase(std::unique(descRef.begin(), descRef.end()), descRef.end());
+    bool batchOk = std::ranges::equal(descBatched, descRef);
+    descBatched.RemoveAll(descBatch);
+    batchOk = batchOk && descBatched.Size() + descBatch.Size() == descRef.size() && std::ranges::is_sorted(descBatched, std::greater<int>());
+    printTestResult(batchOk, "SetVec<int, greater>::InsertAll/RemoveAll", "Verifica operazioni a lotti con comparatore");
+
+    // Un inserimento esegue una sola ricerca binaria, che rifiuta anche i duplicati
+    lasd::SetVec<int, std::allocator<int>, CountingLess> counted;
+    for (int i = 0; i < 1023; ++i) { counted.Insert(2 * i); }
+    CountingLess::calls = 0;
+    bool insertedNew = counted.Insert(1001);
+    ulong newCalls = CountingLess::calls;
+    CountingLess::calls = 0;
+    bool insertedDup = counted.Insert(1002);
+    printTestResult(insertedNew && !insertedDup && newCalls <= 12 && CountingLess::calls <= 12 && counted.Size() == 1024,
+                    "SetVec<int, CountingLess>::Insert", "Verifica una sola ricerca per inserimento");
+
+    // Un confronto che fallisce durante l'inserimento a lotti o l'unione lascia l'insieme invariato
+    {
+      using FragileSet = lasd::SetVec<std::string, std::allocator<std::string>, FragileLess>;
+      FragileSet base;
+      for (int i = 0; i < 100; ++i) { base.Insert("voce-" + std::to_string(2 * i)); }
+      lasd::Vector<std::string> extra(60);
+      for (ulong i = 0; i < extra.Size(); ++i) { extra[i] = "voce-" + std::to_string(3 * i); }
+      FragileSet extraSet(extra);
+      bool unchanged = true;
+      ulong failures = 0;
+      for (long limit = 0; limit < 1200; limit += 11) {
+        FragileSet target(base);
+        FragileSet united(base);
+        FragileLess::budget = limit;
+        try {
+          target.InsertAll(extra);
+        } catch (const std::runtime_error&) {
+          ++failures;
+          FragileLess::budget = -1;
+          unchanged = unchanged && target == base;
+        }
+        FragileLess::budget = limit;
+        try {
+          united.UnionWith(extraSet);
+        } catch (const std::runtime_error&) {
+          ++failures;
+          FragileLess::budget = -1;
+          unchanged = unchanged && united == base;
+        }
+        FragileLess::budget = -1;
+      }
+      printTestResult(unchanged && failures > 0, "SetVec<string, FragileLess>::InsertAll/UnionWith",
+                      "Verifica insieme invariato se un confronto lancia un'eccezione");
+    }
+
+    // Algebra insiemistica e layout congelato con il comparatore
+    DescSetVec descOther(descBatch);
+    std::vector<int> descUnion, descInter;
+    std::ranges::set_union(desc, descOther, std::back_inserter(descUnion), std::greater<int>());
+    std::ranges::set_intersection(desc, descOther, std::back_inserter(descInter), std::greater<int>());
+    bool algebraOk = std::ranges::equal(desc.Union(descOther), descUnion) && std::ranges::equal(desc.Intersection(descOther), descInter);
+    desc.Freeze();
+    bool frozenOk = desc.IsFrozen() && desc.Exists(100) && desc.Exists(0) && !desc.Exists(101) && !desc.Exists(-1);
+    desc.Thaw();
+    printTestResult(algebraOk && frozenOk, "SetVec<int, greater>::Union/Intersection/Freeze", "Verifica algebra e ricerca congelata con comparatore");
+
+    // Equivalenza definita dal comparatore: chiavi che differiscono solo per maiuscole
+    struct CaseInsensitiveLess {
+      bool operator()(const std::string& a, const std::string& b) const {
+        return std::ranges::lexicographical_compare(a, b, [](char x, char y) { return std::tolower(x) < std::tolower(y); });
+      }
+    };
+    lasd::SetVec<std::string, std::allocator<std::string>, CaseInsensitiveLess> caseless;
+    bool firstInsert = caseless.Insert("Mela");
+    bool dupInsert = caseless.Insert("mela");
+    caseless.Insert("banana");
+    caseless.Insert("Ciliegia");
+    printTestResult(firstInsert && !dupInsert && caseless.Size() == 3 && caseless.Exists("MELA") && caseless.Min() == "banana" && caseless.Max() == "Mela",
+                    "SetVec<string, CaseInsensitiveLess>::Insert", "Verifica equivalenza definita dal comparatore");
+
     std::cout << "=== Fine test SetVec ===" << std::endl;
 }
@@ -35,6 +35,8 @@ void executeMyTests() {
     testList();
     testSetVec();
     testSetLst();
+    testSetBTree();
+    testSetHash();
     testHeap();
     testPriorityQueue();
     
@@ -55,6 +57,8 @@ void executeDataStructureTests() {
     testList();
     testSetVec();
     testSetLst();
+    testSetBTree();
+    testSetHash();
     
     // Report total results
     std::cout << "\nTest di List, Vector e Set - Riepilogo: " << testsPassed << " passati, " 
@@ -26,6 +26,8 @@ void testList();
 void testVector();
 void testSetLst();
 void testSetVec();
+void testSetBTree();
+void testSetHash();
 void testHeap();
 void testHeapEdgeCases();
 void testHeapDataTypes();
@@ -1,9 +1,101 @@
 #include "test.hpp"
 #include "../vector/vector.hpp"
 #include "../list/list.hpp"
+#include "../allocator/arena.hpp"
+#include "../allocator/pool.hpp"
 #include <iostream>
 #include <stdexcept>
 #include <cmath> // For std::abs
+#include <limits>
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <new>
+#include <type_traits>
+
+static_assert(std::contiguous_iterator<lasd::Vector<int>::iterator>);
+static_assert(std::contiguous_iterator<lasd::Vector<int>::const_iterator>);
+static_assert(std::ranges::contiguous_range<lasd::SortableVector<int>>);
+static_assert(std::ranges::contiguous_range<const lasd::Vector<int>>);
+
+// Tipo senza costruttore di default che conta le istanze vive e le copie
+struct TrackedValue {
+    static long live;
+    static long copies;
+    int value;
+    explicit TrackedValue(int v) : value(v) { live++; }
+    TrackedValue(const TrackedValue& other) : value(other.value) { live++; copies++; }
+    TrackedValue(TrackedValue&& other) noexcept : value(other.value) { live++; }
+    TrackedValue& operator=(const TrackedValue& other) { value = other.value; copies++; return *this; }
+    TrackedValue& operator=(TrackedValue&& other) noexcept { value = other.value; return *this; }
+    ~TrackedValue() { live--; }
+    bool operator==(const TrackedValue& other) const { return value == other.value; }
+    bool operator!=(const TrackedValue& other) const { return value != other.value; }
+    bool operator<(const TrackedValue& other) const { return value < other.value; }
+};
+long TrackedValue::live = 0;
+long TrackedValue::copies = 0;
+
+// Allocatore che non si propaga e fallisce oltre un budget di elementi (restituiti alla deallocazione)
+template <typename T>
+struct BudgetAllocator {
+    using value_type = T;
+    long* budget;
+    explicit BudgetAllocator(long* b) noexcept : budget(b) {}
+    template <typename U>
+    BudgetAllocator(const BudgetAllocator<U>& other) noexcept : budget(other.budget) {}
+    T* allocate(std::size_t n) {
+        if (static_cast<long>(n) > *budget) {
+            throw std::bad_alloc();
+        }
+        *budget -= static_cast<long>(n);
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, std::size_t n) noexcept {
+        *budget += static_cast<long>(n);
+        std::allocator<T>().deallocate(p, n);
+    }
+    template <typename U>
+    bool operator==(const BudgetAllocator<U>& other) const noexcept { return budget == other.budget; }
+};
+
+static_assert(std::is_nothrow_move_assignable_v<lasd::Vector<int>>);
+static_assert(std::is_nothrow_move_assignable_v<lasd::List<int>>);
+static_assert(std::is_nothrow_move_assignable_v<lasd::Vector<int, lasd::ArenaAllocator<int>>>);
+static_assert(!std::is_nothrow_move_assignable_v<lasd::Vector<int, BudgetAllocator<int>>>);
+static_assert(!std::is_nothrow_move_assignable_v<lasd::SortableVector<int, BudgetAllocator<int>>>);
+static_assert(!std::is_nothrow_move_assignable_v<lasd::List<int, BudgetAllocator<int>>>);
+
+// Checks Exists/Sum/MinValue/MaxValue/operator== against the scalar definitions at
+// every length up to a few registers, so that each kernel tail is exercised
+template <typename T>
+static bool checkSimdKernels() {
+    for (ulong n = 1; n <= 70; n++) {
+        lasd::Vector<T> vec(n);
+        T sum = 0;
+        for (ulong i = 0; i < n; i++) {
+            vec[i] = static_cast<T>((i * 37) % 23) - 11;
+            sum += vec[i];
+        }
+        T min = *std::min_element(vec.begin(), vec.end());
+        T max = *std::max_element(vec.begin(), vec.end());
+        if (vec.Sum() != sum || vec.MinValue() != min || vec.MaxValue() != max) {
+            return false;
+        }
+        if (!vec.Exists(vec[n - 1]) || !vec.Exists(vec[n / 2]) || vec.Exists(static_cast<T>(100))) {
+            return false;
+        }
+        lasd::Vector<T> other(vec);
+        if (!(vec == other)) {
+            return false;
+        }
+        other[n - 1] = static_cast<T>(99);
+        if (vec == other) {
+            return false;
+        }
+    }
+    return true;
+}
 
 void testVector() {
     std::cout << "\nInizio test Vector" << std::endl;
@@ -191,6 +283,34 @@ void testVector() {
         1
     );
     printTestResult(product == 240000, "Vector<int>::Fold", "Verifica prodotto di tutti gli elementi");
+
+    // Test Reduce, ForEach e ForEachMut (callable inline, senza std::function)
+    printTestResult(v9.Reduce([](const int& x, long acc) { return acc + x; }, 0L) == 100, "Vector<int>::Reduce", "Verifica somma con Reduce");
+    std::string visited;
+    v9.ForEach([&visited](const int& x) { visited += std::to_string(x) + " "; });
+    std::string traversed;
+    v9.Traverse([&traversed](const int& x) { traversed += std::to_string(x) + " "; });
+    printTestResult(visited == traversed, "Vector<int>::ForEach", "Verifica stesso ordine di Traverse");
+    v9.ForEachMut([](int& x) { x += 1; });
+    printTestResult(v9.Reduce([](const int& x, int acc) { return acc + x; }, 0) == 104, "Vector<int>::ForEachMut", "Verifica modifica degli elementi");
+    v9.ForEachMut([](int& x) { x -= 1; });
+
+    // Test iteratori
+    int iterSum = 0;
+    for (const int& x : v9) {
+        iterSum += x;
+    }
+    printTestResult(iterSum == 100 && v9.end() - v9.begin() == static_cast<long>(v9.Size()), "Vector<int>::begin/end", "Verifica range-for sugli elementi");
+
+    lasd::SortableVector<int> vIter(6);
+    int seed = 6;
+    for (int& x : vIter) {
+        x = (seed-- * 7) % 10;
+    }
+    std::ranges::sort(vIter);
+    printTestResult(std::ranges::is_sorted(vIter) && vIter.Front() == 1 && vIter.Back() == 8, "SortableVector<int>::begin/end", "Verifica std::ranges::sort sugli iteratori");
+    const lasd::Vector<int>& vConst = v9;
+    printTestResult(std::ranges::find(vConst, v9[2]) == vConst.begin() + 2 && lasd::Vector<int>().begin() == lasd::Vector<int>().end(), "Vector<int>::cbegin/cend", "Verifica iteratori costanti e vettore vuoto");
     
     // ========== TEST DI MAPPABLE CONTAINER ==========
     
@@ -383,6 +503,121 @@ void testVector() {
     sv4[0] = 42;
     sv4.Sort(); // Non dovrebbe causare errori
     printTestResult(sv4[0] == 42, "SortableVector<int>::Sort", "Verifica sort su vettore con un elemento");
+
+    // Test introsort su input avversari (ordinati, inversi, costanti, a "dente di sega") e casuali
+    const ulong sortSize = 100000;
+    lasd::SortableVector<int> svAsc(sortSize), svDesc(sortSize), svEqual(sortSize), svSaw(sortSize), svRandom(sortSize);
+    unsigned int state = 12345;
+    for (ulong i = 0; i < sortSize; i++) {
+        svAsc[i] = i;
+        svDesc[i] = sortSize - i;
+        svEqual[i] = 7;
+        svSaw[i] = i % 100 < 50 ? i % 100 : 100 - i % 100;
+        state = state * 1103515245 + 12345;
+        svRandom[i] = (state >> 8) % 1000;
+    }
+    lasd::SortableVector<int> svRandomCopy(svRandom);
+    svAsc.Sort();
+    svDesc.Sort();
+    svEqual.Sort();
+    svSaw.Sort();
+    svRandom.Sort();
+    printTestResult(std::ranges::is_sorted(svAsc) && std::ranges::is_sorted(svDesc) && std::ranges::is_sorted(svEqual) && std::ranges::is_sorted(svSaw),
+                    "SortableVector<int>::Sort", "Verifica introsort su input ordinati, inversi, costanti e a dente di sega");
+    std::ranges::sort(svRandomCopy);
+    printTestResult(svRandom == svRandomCopy, "SortableVector<int>::Sort", "Verifica introsort su input casuale (confronto con std::ranges::sort)");
+
+    // Percorso generico (tramite operator[] virtuale) della classe base
+    lasd::SortableVector<std::string> svStrings(300);
+    for (ulong i = 0; i < svStrings.Size(); i++) {
+        svStrings[i] = std::to_string((i * 7919) % 300);
+    }
+    svStrings.lasd::SortableLinearContainer<std::string>::Sort();
+    printTestResult(std::ranges::is_sorted(svStrings) && svStrings.Front() == "0" && svStrings.Back() == "99", "SortableLinearContainer<string>::Sort", "Verifica percorso generico tramite operator[]");
+
+    // Ordinamento parallelo: blocchi ordinati in concorrenza e poi fusi
+    {
+        const ulong parallelSize = 5 * lasd::SortableVector<int>::ParallelSortMinChunk + 3;
+        lasd::SortableVector<int> svParallel(parallelSize);
+        for (ulong i = 0; i < parallelSize; i++) {
+            state = state * 1103515245 + 12345;
+            svParallel[i] = (state >> 8) % 100000;
+        }
+        lasd::SortableVector<int> svParallelCopy(svParallel);
+        lasd::SortableVector<int> svParallelAuto(svParallel);
+        svParallel.ParallelSort(4);
+        svParallelAuto.ParallelSort();
+        std::ranges::sort(svParallelCopy);
+        printTestResult(svParallel == svParallelCopy && svParallelAuto == svParallelCopy, "SortableVector<int>::ParallelSort", "Verifica ordinamento parallelo (confronto con std::ranges::sort)");
+
+        lasd::SortableVector<std::string> svParallelStrings(3 * lasd::SortableVector<std::string>::ParallelSortMinChunk);
+        for (ulong i = 0; i < svParallelStrings.Size(); i++) {
+            svParallelStrings[i] = std::to_string((i * 7919) % 1000);
+        }
+        svParallelStrings.ParallelSort(3);
+        printTestResult(std::ranges::is_sorted(svParallelStrings) && svParallelStrings.Front() == "0" && svParallelStrings.Back() == "999", "SortableVector<string>::ParallelSort", "Verifica ordinamento parallelo con stringhe");
+
+        lasd::SortableVector<int> svSmall(100);
+        for (ulong i = 0; i < svSmall.Size(); i++) {
+            svSmall[i] = 100 - i;
+        }
+        svSmall.ParallelSort(8);
+        printTestResult(std::ranges::is_sorted(svSmall) && svSmall.Front() == 1, "SortableVector<int>::ParallelSort", "Verifica ripiego sequenziale sotto la soglia");
+    }
+
+    // Radix sort LSD per tipi aritmetici (interi con segno, senza segno e IEEE)
+    {
+        const ulong radixSize = 5000;
+        lasd::SortableVector<int> svInts(radixSize);
+        lasd::SortableVector<unsigned long> svUlongs(radixSize);
+        lasd::SortableVector<double> svDoubles(radixSize);
+        for (ulong i = 0; i < radixSize; i++) {
+            state = state * 1103515245 + 12345;
+            svInts[i] = static_cast<int>(state) / 3;
+            svUlongs[i] = (static_cast<unsigned long>(state) << 32) | (state >> 7);
+            svDoubles[i] = (static_cast<int>(state >> 4) % 20000 - 10000) / 7.0;
+        }
+        svInts[0] = std::numeric_limits<int>::min();
+        svInts[1] = std::numeric_limits<int>::max();
+        svDoubles[0] = -std::numeric_limits<double>::infinity();
+        svDoubles[1] = std::numeric_limits<double>::infinity();
+        svDoubles[2] = -0.0;
+        svDoubles[3] = 1e-300;
+        svDoubles[4] = -1e300;
+        lasd::SortableVector<int> svIntsCopy(svInts);
+        lasd::SortableVector<unsigned long> svUlongsCopy(svUlongs);
+        lasd::SortableVector<double> svDoublesCopy(svDoubles);
+        svInts.Sort();
+        svUlongs.Sort();
+        svDoubles.Sort();
+        std::ranges::sort(svIntsCopy);
+        std::ranges::sort(svUlongsCopy);
+        std::ranges::sort(svDoublesCopy);
+        printTestResult(svInts == svIntsCopy && svUlongs == svUlongsCopy, "SortableVector<int/ulong>::Sort", "Verifica radix sort su interi con e senza segno");
+        printTestResult(svDoubles == svDoublesCopy && std::isinf(svDoubles.Front()) && svDoubles[1] == -1e300 && std::isinf(svDoubles.Back()), "SortableVector<double>::Sort", "Verifica radix sort su double negativi, zeri e infiniti");
+
+        // Valori concentrati in pochi byte, ordinati usando la capacita' libera come buffer ausiliario
+        lasd::SortableVector<long> svSkewed(radixSize);
+        svSkewed.Reserve(3 * radixSize);
+        for (ulong i = 0; i < radixSize; i++) {
+            svSkewed[i] = -1000000L + static_cast<long>((i * 7919) % 97);
+        }
+        ulong skewedCapacity = svSkewed.Capacity();
+        svSkewed.Sort();
+        printTestResult(std::ranges::is_sorted(svSkewed) && svSkewed.Front() == -1000000L && svSkewed.Back() == -1000000L + 96 && svSkewed.Capacity() == skewedCapacity,
+                        "SortableVector<long>::Sort", "Verifica radix sort su valori concentrati con buffer nella capacita' libera");
+    }
+
+    // L'ordinamento sposta gli elementi senza copiarli
+    {
+        lasd::SortableVector<TrackedValue> svTracked;
+        for (int i = 0; i < 1000; i++) {
+            svTracked.PushBack(TrackedValue((i * 37) % 1000));
+        }
+        TrackedValue::copies = 0;
+        svTracked.Sort();
+        printTestResult(TrackedValue::copies == 0 && std::is_sorted(svTracked.begin(), svTracked.end()) && svTracked.Back().value == 999, "SortableVector<TrackedValue>::Sort", "Verifica ordinamento senza copie e senza costruttore di default");
+    }
     
     // ========== TEST CASI LIMITE E SPECIALI ==========
     
@@ -415,7 +650,269 @@ void testVector() {
         doubleMapCorrect = false;
     }
     printTestResult(doubleMapCorrect, "Vector<double>::Map", "Verifica mapping con double");
-    
+
+    // ========== TEST CAPACITA' E PUSHBACK/POPBACK ==========
+
+    std::cout << "\n=== Test capacita' ===" << std::endl;
+
+    lasd::Vector<int> v20;
+    printTestResult(v20.Capacity() == 0, "Vector<int>::Capacity", "Verifica capacita' nulla su vettore vuoto");
+
+    v20.Reserve(10);
+    printTestResult(v20.Capacity() >= 10 && v20.Size() == 0, "Vector<int>::Reserve", "Verifica Reserve senza cambiare dimensione");
+
+    bool pushCorrect = true;
+    ulong reallocations = 0;
+    ulong lastCapacity = v20.Capacity();
+    for (int i = 0; i < 1000; i++) {
+        v20.PushBack(i);
+        if (v20.Capacity() != lastCapacity) {
+            reallocations++;
+            lastCapacity = v20.Capacity();
+        }
+    }
+    for (ulong i = 0; i < v20.Size(); i++) {
+        if (v20[i] != static_cast<int>(i)) {
+            pushCorrect = false;
+            break;
+        }
+    }
+    printTestResult(pushCorrect && v20.Size() == 1000, "Vector<int>::PushBack", "Verifica contenuto dopo 1000 PushBack");
+    printTestResult(reallocations <= 10, "Vector<int>::PushBack", "Verifica crescita geometrica (poche riallocazioni)");
+
+    v20.PushBack(v20[0]); // Elemento dello stesso vettore (possibile riallocazione)
+    printTestResult(v20.Back() == 0, "Vector<int>::PushBack", "Verifica PushBack di un elemento del vettore stesso");
+
+    v20.PopBack();
+    v20.PopBack();
+    printTestResult(v20.Size() == 999 && v20.Back() == 998, "Vector<int>::PopBack", "Verifica rimozione in coda");
+
+    v20.ShrinkToFit();
+    printTestResult(v20.Capacity() == v20.Size(), "Vector<int>::ShrinkToFit", "Verifica capacita' uguale alla dimensione");
+
+    v20.Resize(5);
+    printTestResult(v20.Size() == 5 && v20.Back() == 4, "Vector<int>::Resize", "Verifica riduzione con capacita' mantenuta");
+    v20.Resize(8);
+    printTestResult(v20.Size() == 8 && v20[7] == 0, "Vector<int>::Resize", "Verifica nuovi elementi azzerati dopo crescita");
+
+    v20.Clear();
+    printTestResult(v20.Empty() && v20.Capacity() == 0, "Vector<int>::Clear", "Verifica rilascio memoria con Clear");
+
+    try {
+        v20.PopBack();
+        printTestResult(false, "Vector<int>::PopBack", "Verifica eccezione su vettore vuoto");
+    } catch (std::length_error&) {
+        printTestResult(true, "Vector<int>::PopBack", "Verifica eccezione su vettore vuoto");
+    }
+
+    try {
+        v20.SetGrowthFactor(1.0);
+        printTestResult(false, "Vector<int>::SetGrowthFactor", "Verifica eccezione con fattore non valido");
+    } catch (std::invalid_argument&) {
+        printTestResult(true, "Vector<int>::SetGrowthFactor", "Verifica eccezione con fattore non valido");
+    }
+
+    lasd::Vector<std::string> v21;
+    v21.SetGrowthFactor(1.5);
+    for (int i = 0; i < 100; i++) {
+        std::string s = "s";
+        s += std::to_string(i);
+        v21.PushBack(std::move(s));
+    }
+    printTestResult(v21.Size() == 100 && v21[99] == "s99" && v21.GrowthFactor() == 1.5, "Vector<string>::PushBack", "Verifica PushBack con fattore di crescita 1.5");
+
+    // ========== TEST MEMORIA NON INIZIALIZZATA ==========
+
+    std::cout << "\n=== Test memoria non inizializzata ===" << std::endl;
+
+    {
+        lasd::Vector<TrackedValue> v22;
+        v22.Reserve(64);
+        printTestResult(TrackedValue::live == 0, "Vector<TrackedValue>::Reserve", "Verifica che Reserve non costruisca elementi");
+
+        for (int i = 0; i < 100; i++) {
+            v22.PushBack(TrackedValue(i));
+        }
+        printTestResult(TrackedValue::live == 100 && TrackedValue::copies == 0, "Vector<TrackedValue>::PushBack", "Verifica riallocazione tramite move senza copie");
+
+        v22.PopBack();
+        printTestResult(TrackedValue::live == 99 && v22.Back().value == 98, "Vector<TrackedValue>::PopBack", "Verifica distruzione dell'elemento rimosso");
+
+        lasd::Vector<TrackedValue> v23(v22);
+        printTestResult(v23 == v22 && TrackedValue::live == 198, "Vector<TrackedValue>::Vector(const Vector &)", "Verifica copia senza costruttore di default");
+
+        v23.Resize(10);
+        printTestResult(v23.Size() == 10 && TrackedValue::live == 109, "Vector<TrackedValue>::Resize", "Verifica distruzione degli elementi scartati");
+
+        v22 = std::move(v23);
+        v23.Clear();
+        printTestResult(v22.Size() == 10 && v22[9].value == 9, "Vector<TrackedValue>::operator=(Vector &&)", "Verifica spostamento senza costruttore di default");
+    }
+    printTestResult(TrackedValue::live == 0, "Vector<TrackedValue>::~Vector", "Verifica distruzione di tutti gli elementi");
+
+    // ========== TEST ALLOCATORI ==========
+
+    std::cout << "\n=== Test allocatori ===" << std::endl;
+
+    {
+        lasd::MonotonicArena arena;
+        lasd::Vector<int, lasd::ArenaAllocator<int>> v24{lasd::ArenaAllocator<int>(arena)};
+        for (int i = 0; i < 1000; i++) {
+            v24.PushBack(i);
+        }
+        printTestResult(v24.Size() == 1000 && v24[999] == 999 && arena.Allocated() >= 1000 * sizeof(int), "Vector<int, ArenaAllocator>::PushBack", "Verifica allocazione dall'arena");
+
+        lasd::Vector<int, lasd::ArenaAllocator<int>> v25(v24);
+        printTestResult(v25 == v24 && &v25.GetAllocator().Arena() == &arena, "Vector<int, ArenaAllocator>::Vector(const Vector &)", "Verifica propagazione dell'allocatore nella copia");
+
+        lasd::Vector<std::string, lasd::ArenaAllocator<std::string>> v26(3, lasd::ArenaAllocator<std::string>(arena));
+        v26[2] = "arena";
+        v26.Resize(50);
+        printTestResult(v26.Size() == 50 && v26[2] == "arena", "Vector<string, ArenaAllocator>::Resize", "Verifica ridimensionamento nell'arena");
+    }
+
+    {
+        lasd::PoolResource pool;
+        lasd::Vector<double, lasd::PoolAllocator<double>> v27(10, lasd::PoolAllocator<double>(pool));
+        for (ulong i = 0; i < 10; i++) {
+            v27[i] = i * 0.5;
+        }
+        lasd::Vector<double, lasd::PoolAllocator<double>> v28{lasd::PoolAllocator<double>(pool)};
+        v28 = v27;
+        v27.Resize(1000);
+        printTestResult(v28.Size() == 10 && v28[9] == 4.5 && v27.Size() == 1000 && v27[9] == 4.5, "Vector<double, PoolAllocator>::Resize", "Verifica allocazione dal pool (anche oltre le classi di dimensione)");
+
+        lasd::PoolResource otherPool;
+        lasd::Vector<double, lasd::PoolAllocator<double>> v29{lasd::PoolAllocator<double>(otherPool)};
+        v29 = std::move(v28);
+        printTestResult(v29.Size() == 10 && &v29.GetAllocator().Resource() == &pool, "Vector<double, PoolAllocator>::operator=(Vector &&)", "Verifica propagazione dell'allocatore nello spostamento");
+    }
+
+    {
+        long budgetSrc = 100;
+        long budgetDst = 5;
+        lasd::Vector<int, BudgetAllocator<int>> v30(10, BudgetAllocator<int>(&budgetSrc));
+        lasd::Vector<int, BudgetAllocator<int>> v31(2, BudgetAllocator<int>(&budgetDst));
+        bool thrown = false;
+        try {
+            v31 = std::move(v30);
+        } catch (const std::bad_alloc&) {
+            thrown = true;
+        }
+        printTestResult(thrown && v31.Size() == 2 && v30.Size() == 10, "Vector<int, BudgetAllocator>::operator=(Vector &&)", "Verifica bad_alloc con allocatori diversi che non si propagano");
+
+        budgetDst = 50;
+        lasd::List<int, BudgetAllocator<int>> l1{BudgetAllocator<int>(&budgetSrc)};
+        lasd::List<int, BudgetAllocator<int>> l2{BudgetAllocator<int>(&budgetDst)};
+        for (int i = 0; i < 10; i++) {
+            l1.InsertAtBack(i);
+        }
+        budgetDst = 3;
+        thrown = false;
+        try {
+            l2 = std::move(l1);
+        } catch (const std::bad_alloc&) {
+            thrown = true;
+        }
+        printTestResult(thrown, "List<int, BudgetAllocator>::operator=(List &&)", "Verifica bad_alloc con allocatori diversi che non si propagano");
+    }
+
+    {
+        // Elemento il cui costruttore di spostamento fallisce a comando
+        struct Brittle {
+            int value;
+            bool* fail;
+            Brittle(int v, bool* f) : value(v), fail(f) {}
+            Brittle(const Brittle&) = default;
+            Brittle(Brittle&& other) : value(other.value), fail(other.fail) {
+                if (*fail) {
+                    throw std::runtime_error("move failed");
+                }
+            }
+            Brittle& operator=(const Brittle&) = default;
+            bool operator==(const Brittle& other) const { return value == other.value; }
+        };
+        bool fail = false;
+        long budgetSrc = 100;
+        long budgetDst = 100;
+        lasd::Vector<Brittle, BudgetAllocator<Brittle>> v34{BudgetAllocator<Brittle>(&budgetSrc)};
+        lasd::Vector<Brittle, BudgetAllocator<Brittle>> v35{BudgetAllocator<Brittle>(&budgetDst)};
+        for (int i = 0; i < 10; i++) {
+            v34.PushBack(Brittle(i, &fail));
+        }
+        v34.ShrinkToFit();
+        v35.PushBack(Brittle(-1, &fail));
+        v35.ShrinkToFit();
+        fail = true;
+        bool thrown = false;
+        try {
+            v35 = std::move(v34);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        printTestResult(thrown && budgetDst == 99 && v35.Size() == 1 && v35[0].value == -1 && v34.Size() == 10,
+                        "Vector<Brittle, BudgetAllocator>::operator=(Vector &&)", "Verifica rilascio della memoria se lo spostamento lancia un'eccezione");
+    }
+
+    // ========== TEST ATTRAVERSAMENTO CON USCITA ANTICIPATA ==========
+
+    std::cout << "\n=== Test attraversamento con uscita anticipata ===" << std::endl;
+
+    {
+        lasd::Vector<std::string> v33(100);
+        for (ulong i = 0; i < 100; i++) {
+            v33[i] = std::to_string(i);
+        }
+        int visited = 0;
+        bool complete = v33.TraverseWhile([&visited](const std::string& value) { visited++; return value != "4"; });
+        int visitedBack = 0;
+        bool completeBack = v33.PostOrderTraverseWhile([&visitedBack](const std::string& value) { visitedBack++; return value.size() == 2; });
+        printTestResult(!complete && visited == 5 && !completeBack && visitedBack == 91, "Vector<string>::TraverseWhile", "Verifica arresto al primo false in entrambi i versi");
+
+        const std::string* found = v33.FindFirst([](const std::string& value) { return value.size() == 2 && value[1] == '7'; });
+        printTestResult(found == &v33[17] && v33.All([](const std::string& value) { return !value.empty(); }) && !v33.Any([](const std::string& value) { return value == "100"; }),
+                        "Vector<string>::FindFirst/All/Any", "Verifica ricerca e predicati");
+
+        // Percorso generico della classe base (operator[] virtuale)
+        const lasd::LinearContainer<std::string>& base = v33;
+        visited = 0;
+        bool baseAny = base.lasd::LinearContainer<std::string>::TraverseWhile([&visited](const std::string& value) { visited++; return value != "2"; });
+        printTestResult(!baseAny && visited == 3 && base.Exists("99") && !base.Exists("x"), "LinearContainer<string>::TraverseWhile", "Verifica uscita anticipata nel percorso generico");
+    }
+
+    // ========== TEST KERNEL SIMD ==========
+
+    std::cout << "\n=== Test kernel SIMD ===" << std::endl;
+
+    {
+        bool allLevels = true;
+        for (lasd::simd::Level level : {lasd::simd::Level::Scalar, lasd::simd::Level::Vector128, lasd::simd::Level::Vector256}) {
+            lasd::simd::SetLevel(level);
+            allLevels = allLevels && checkSimdKernels<int>() && checkSimdKernels<float>() && checkSimdKernels<double>() && checkSimdKernels<long>();
+        }
+        lasd::simd::SetLevel(lasd::simd::SupportedLevel());
+        printTestResult(allLevels && lasd::simd::CurrentLevel() == lasd::simd::SupportedLevel(), "Vector<int/float/double>::Exists/Sum/MinValue/MaxValue/operator==", "Verifica dei kernel su ogni livello e su ogni lunghezza di coda");
+
+        lasd::Vector<double> v30(1000), v31(1000);
+        for (ulong i = 0; i < 1000; i++) {
+            v30[i] = v31[i] = i * 0.25;
+        }
+        v30[0] = 0.0;
+        v31[0] = -0.0;
+        bool zeros = v30 == v31;
+        v30[500] = v31[500] = std::numeric_limits<double>::quiet_NaN();
+        printTestResult(zeros && !(v30 == v31) && !v30.Exists(v30[500]) && v30.Exists(249.75), "Vector<double>::operator==", "Verifica semantica IEEE (zeri con segno e NaN) nel confronto vettoriale");
+
+        lasd::Vector<float> v32;
+        bool thrown = false;
+        try {
+            v32.MinValue();
+        } catch (const std::length_error&) {
+            thrown = true;
+        }
+        printTestResult(thrown && v32.Sum() == 0.0f && !v32.Exists(0.0f), "Vector<float>::MinValue", "Verifica riduzioni su vettore vuoto");
+    }
+
     std::cout << "Fine test Vector\n" << std::endl;
 }
 